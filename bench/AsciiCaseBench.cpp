@@ -0,0 +1,258 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       AsciiCaseBench.cpp
+//
+//  Synopsis:   Measures case conversion, case-insensitive comparison and
+//              header lookups for each engine and the old byte loops
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+using namespace mikestoolbox;
+
+const uintsys BYTES_PER_RUN   = 1024 * 1024 * 1024;
+const uintsys LOOKUPS_PER_RUN = 10 * 1000 * 1000;
+
+static const char* apz_Headers[] = {
+    "Host", "User-Agent", "Accept", "Accept-Language", "Accept-Encoding",
+    "Connection", "Content-Type", "Content-Length", "Cache-Control",
+    "If-Modified-Since", "X-Forwarded-For", "Authorization"
+};
+
+const uintsys NUM_HEADERS = sizeof(apz_Headers) / sizeof(apz_Headers[0]);
+
+//+---------------------------------------------------------------------------
+//  Function:   OldLower, OldCompare
+//
+//  Synopsis:   A byte at a time, as before
+//----------------------------------------------------------------------------
+
+static String OldLower (const String& str)
+{
+    String str_Result;
+
+    uintsys      u_Length = str.Length();
+    const uchar* p        = str.PointerToFirstByte();
+    uchar*       q        = str_Result.Allocate (u_Length);
+
+    for (uintsys u = 0; u < u_Length; ++u)
+    {
+        q[u] = ByteToLower (p[u]);
+    }
+
+    return str_Result;
+}
+
+static intsys OldCompare (const uchar* ps1, const uchar* ps2,
+                          uintsys u_NumChars)
+{
+    for (uintsys u = 0; u < u_NumChars; ++u)
+    {
+        intsys n_Return = ByteCompareNoCase (*ps1++, *ps2++);
+
+        if (n_Return != 0)
+        {
+            return n_Return;
+        }
+    }
+
+    return 0;
+}
+
+static String Label (int n_Engine, const char* pz_What)
+{
+    String str_Label ((n_Engine == BYTE_SEARCH_UNKNOWN)
+                      ? "old loop"
+                      : ByteSearch::EngineName ((ByteSearchEngine) n_Engine));
+
+    str_Label.Append (", ");
+    str_Label.Append (pz_What);
+
+    return str_Label;
+}
+
+static void RunLower (Benchmark& bench, const String& str, int n_Engine)
+{
+    uintsys u_Runs  = BYTES_PER_RUN / str.Length();
+    uintsys u_Total = 0;
+
+    bench.Start();
+
+    for (uintsys u = 0; u < u_Runs; ++u)
+    {
+        u_Total += (n_Engine == BYTE_SEARCH_UNKNOWN)
+                   ? OldLower (str).Length()
+                   : str.AsLowerCase().Length();
+    }
+
+    String str_What ("lower case, ");
+
+    str_What.Append (str.Length());
+    str_What.Append (" bytes");
+
+    bench.Report (Label (n_Engine, str_What.C()),
+                  double (u_Runs) * str.Length() / 1e9, "GB");
+
+    if (u_Total == 0)
+    {
+        std::cout << "nothing done" << std::endl;
+    }
+}
+
+static void RunCompare (Benchmark& bench, const String& str1,
+                        const String& str2, int n_Engine)
+{
+    uintsys u_Runs  = BYTES_PER_RUN / str1.Length();
+    intsys  n_Total = 0;
+
+    const uchar* p1 = str1.PointerToFirstByte();
+    const uchar* p2 = str2.PointerToFirstByte();
+
+    bench.Start();
+
+    for (uintsys u = 0; u < u_Runs; ++u)
+    {
+        n_Total += (n_Engine == BYTE_SEARCH_UNKNOWN)
+                   ? OldCompare (p1, p2, str1.Length())
+                   : StringCompare (p1, p2, str1.Length(), false);
+    }
+
+    String str_What ("compare, ");
+
+    str_What.Append (str1.Length());
+    str_What.Append (" bytes");
+
+    bench.Report (Label (n_Engine, str_What.C()),
+                  double (u_Runs) * str1.Length() / 1e9, "GB");
+
+    if (n_Total != 0)
+    {
+        std::cout << "strings differ" << std::endl;
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   RunLookups
+//
+//  Synopsis:   Looks up request headers as they arrive, in any case, by
+//              lowercasing each name for an ordinary Hash or by handing
+//              it straight to a NoCaseHash
+//----------------------------------------------------------------------------
+
+static void RunLookups (Benchmark& bench, bool b_NoCase)
+{
+    Hash<String,int>            hash_Lower;
+    Hash<String,int,NoCaseHash> hash_NoCase;
+
+    StringList strl_Arriving;
+
+    for (uintsys u = 0; u < NUM_HEADERS; ++u)
+    {
+        String str (apz_Headers[u]);
+
+        hash_Lower[str.AsLowerCase()] = (int) u;
+        hash_NoCase[str]              = (int) u;
+
+        strl_Arriving.Append (str, str.AsLowerCase(), str.AsUpperCase());
+    }
+
+    uintsys u_Total = 0;
+
+    bench.Start();
+
+    for (uintsys u = 0; u < LOOKUPS_PER_RUN; ++u)
+    {
+        const String& str = strl_Arriving[u % strl_Arriving.NumItems()];
+
+        u_Total += b_NoCase ? hash_NoCase.Get (str)
+                            : hash_Lower.Get (str.AsLowerCase());
+    }
+
+    bench.Report (b_NoCase ? "NoCaseHash lookup"
+                           : "lowercase then Hash lookup",
+                  LOOKUPS_PER_RUN, "lookups");
+
+    if (u_Total == 0)
+    {
+        std::cout << "nothing found" << std::endl;
+    }
+}
+
+int main (int, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+    String str_Text;
+
+    while (str_Text.Length() < 1024 * 1024)
+    {
+        str_Text += apz_Headers[str_Text.Length() % NUM_HEADERS];
+        str_Text += ": Some Value\r\n";
+    }
+
+    for (uintsys u_Length = 16; u_Length <= 1024 * 1024; u_Length *= 256)
+    {
+        String str (str_Text.Head (u_Length));
+
+        String str_Upper (str.AsUpperCase());
+
+        for (int n_Engine = BYTE_SEARCH_UNKNOWN;
+             n_Engine <= BYTE_SEARCH_AVX2; ++n_Engine)
+        {
+            if (n_Engine != BYTE_SEARCH_UNKNOWN)
+            {
+                ByteSearch::SetEngine ((ByteSearchEngine) n_Engine);
+            }
+
+            RunLower   (bench, str, n_Engine);
+            RunCompare (bench, str, str_Upper, n_Engine);
+        }
+    }
+
+    ByteSearch::SetEngine (BYTE_SEARCH_UNKNOWN);
+
+    RunLookups (bench, false);
+    RunLookups (bench, true);
+
+    return 0;
+}
@@ -0,0 +1,263 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       Base64Bench.cpp
+//
+//  Synopsis:   Measures base64 encoding and decoding for each engine and
+//              the old group-at-a-time loops
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+using namespace mikestoolbox;
+
+const uintsys BYTES_PER_RUN = 512 * 1024 * 1024;
+
+//+---------------------------------------------------------------------------
+//  Function:   OldEncode, OldDecode
+//
+//  Synopsis:   What String::Base64Encode and Base64Decode used to do, for
+//              comparison
+//----------------------------------------------------------------------------
+
+static void AppendGroup (uintsys u_Group, uintsys u_Chars, String& str)
+{
+    uchar auc[4];
+
+    for (uintsys u = 0; u < 4; ++u)
+    {
+        auc[u] = (u < u_Chars) ? gpz_Base64[(u_Group >> (18 - 6*u)) & 63]
+                               : '=';
+    }
+
+    str.Append ((const uchar*)auc, 4);
+}
+
+static String OldEncode (const String& str, uintsys u_LineLength,
+                         const char* pz_EOL)
+{
+    String str_Result;
+
+    StringIter iter (str);
+
+    ParseError error;
+
+    uintsys u_Group = 0;
+    uintsys u_Count = 0;
+
+    while (iter.ExtractUint24BE (u_Group, error))
+    {
+        AppendGroup (u_Group, 4, str_Result);
+
+        u_Count += 4;
+
+        if (u_Count >= u_LineLength)
+        {
+            str_Result.Append (pz_EOL);
+
+            u_Count = 0;
+        }
+    }
+
+    if (iter.ExtractUint16BE (u_Group, error))
+    {
+        AppendGroup (u_Group << 8, 3, str_Result);
+
+        u_Count += 4;
+    }
+    else if (iter.ExtractUint8 (u_Group, error))
+    {
+        AppendGroup (u_Group << 16, 2, str_Result);
+
+        u_Count += 4;
+    }
+
+    if (u_Count != 0)
+    {
+        str_Result.Append (pz_EOL);
+    }
+
+    return str_Result;
+}
+
+static String OldDecode (const String& str)
+{
+    static uchar auc_Decode[256];
+
+    if (auc_Decode[0] == 0)
+    {
+        std::memset (auc_Decode, 255, 256);
+
+        for (uchar u = 0; u < 64; ++u)
+        {
+            auc_Decode[(uchar) gpz_Base64[u]] = u;
+        }
+    }
+
+    String str_Result;
+
+    str_Result.Reserve (((str.Length() + 3) / 4) * 3);
+
+    StringIter iter (str);
+
+    uintsys u_Current =  0;
+    uintsys u_Shift   = 18;
+
+    while (iter)
+    {
+        uchar uc = auc_Decode[*iter++];
+
+        if (uc >= 64)
+        {
+            continue;
+        }
+
+        u_Current |= (uc << u_Shift);
+
+        if (u_Shift == 0)
+        {
+            str_Result.AppendUint24 (u_Current);
+
+            u_Current =  0;
+            u_Shift   = 18;
+        }
+        else
+        {
+            u_Shift -= 6;
+        }
+    }
+
+    return str_Result;
+}
+
+static void Run (Benchmark& bench, const String& str_Data, bool b_Lines,
+                 bool b_Decode, int n_Engine)
+{
+    uintsys u_LineLength = b_Lines ? 76 : MAX_UINTSYS;
+    const char* pz_EOL   = b_Lines ? "\n" : "";
+
+    String str_Encoded (str_Data.Base64Encode (u_LineLength, pz_EOL));
+
+    const String& str_Input = b_Decode ? str_Encoded : str_Data;
+
+    uintsys u_Runs  = BYTES_PER_RUN / str_Input.Length();
+    uintsys u_Total = 0;
+
+    if (n_Engine == BYTE_SEARCH_UNKNOWN)
+    {
+        u_Runs /= 8;    // much slower
+    }
+    else
+    {
+        ByteSearch::SetEngine ((ByteSearchEngine) n_Engine);
+    }
+
+    bench.Start();
+
+    for (uintsys u = 0; u < u_Runs; ++u)
+    {
+        if (n_Engine == BYTE_SEARCH_UNKNOWN)
+        {
+            u_Total += b_Decode ? OldDecode (str_Input).Length()
+                                : OldEncode (str_Input, u_LineLength,
+                                             pz_EOL).Length();
+        }
+        else
+        {
+            u_Total += b_Decode ? str_Input.Base64Decode().Length()
+                                : str_Input.Base64Encode (u_LineLength,
+                                                          pz_EOL).Length();
+        }
+    }
+
+    String str_Label ((n_Engine == BYTE_SEARCH_UNKNOWN)
+                      ? "old loop"
+                      : ByteSearch::EngineName ((ByteSearchEngine) n_Engine));
+
+    str_Label.Append (b_Decode ? ", decode" : ", encode");
+    str_Label.Append (b_Lines ? " 76/line, " : ", ");
+    str_Label.Append (str_Data.Length());
+    str_Label.Append (" bytes");
+
+    bench.Report (str_Label, double (u_Runs) * str_Input.Length() / 1e9,
+                  "GB");
+
+    if (u_Total == 0)
+    {
+        std::cout << "nothing done" << std::endl;
+    }
+}
+
+int main (int, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+    uint32 u_Seed = 12345;
+
+    String str_Data;
+
+    for (uintsys u = 0; u < 1024 * 1024; ++u)
+    {
+        u_Seed = u_Seed * 1103515245 + 12345;
+
+        str_Data.Append ((char) (u_Seed >> 16));
+    }
+
+    for (uintsys u_Length = 1024; u_Length <= 1024 * 1024; u_Length *= 1024)
+    {
+        String str (str_Data.Head (u_Length));
+
+        for (int n = 0; n < 4; ++n)
+        {
+            bool b_Decode = (n & 1);
+            bool b_Lines  = (n & 2);
+
+            for (int n_Engine = BYTE_SEARCH_UNKNOWN;
+                 n_Engine <= BYTE_SEARCH_AVX2; ++n_Engine)
+            {
+                Run (bench, str, b_Lines, b_Decode, n_Engine);
+            }
+        }
+    }
+
+    return 0;
+}
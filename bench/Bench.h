@@ -0,0 +1,110 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       Bench.h
+//
+//  Synopsis:   Timing and reporting helper for the benchmark programs
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+using namespace mikestoolbox;
+
+class Benchmark
+{
+public:
+
+    Benchmark (const String& str_Name);
+
+    void Start  ();
+    void Report (const String& str_Label, double d_Count,
+                 const char* pz_Unit="ops");
+
+private:
+
+    String str_Name_;
+    Timer  timer_;
+};
+
+inline Benchmark::Benchmark (const String& str_Name)
+    : str_Name_ (str_Name)
+    , timer_    ()
+{
+    str_Name_.Replace (".*?(\\w+)", "$1");  // basename
+}
+
+inline void Benchmark::Start ()
+{
+    timer_.Reset();
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Report
+//
+//  Synopsis:   Prints the rate since the last Start() and restarts the clock
+//----------------------------------------------------------------------------
+
+inline void Benchmark::Report (const String& str_Label, double d_Count,
+                               const char* pz_Unit)
+{
+    double d_Elapsed = timer_.Elapsed();
+
+    DoubleFormat format;
+
+    format.SetPrecision (4);
+
+    String str_Line (str_Name_);
+
+    str_Line.Append (": ");
+    str_Line.Append (str_Label);
+    str_Line.Append (' ');
+    str_Line.PadEnd (56);
+    str_Line.Append (d_Count / Maximum (d_Elapsed, 1e-9), format);
+    str_Line.Append (' ');
+    str_Line.Append (pz_Unit);
+    str_Line.Append ("/sec  (");
+    str_Line.Append (d_Elapsed, format);
+    str_Line.Append (" sec)\n");
+
+    std::cout << str_Line << std::flush;
+
+    timer_.Reset();
+}
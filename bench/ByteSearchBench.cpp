@@ -0,0 +1,180 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       ByteSearchBench.cpp
+//
+//  Synopsis:   Measures substring search across needle and haystack sizes
+//              for each ByteSearch engine and the old byte-at-a-time loop
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+using namespace mikestoolbox;
+
+const uintsys BYTES_PER_RUN = 256 * 1024 * 1024;
+
+//+---------------------------------------------------------------------------
+//  Function:   OldFind
+//
+//  Synopsis:   The search String::FindFirst used to do, for comparison
+//----------------------------------------------------------------------------
+
+static const uchar* OldFind (const uchar* p_Haystack, uintsys u_Length,
+                             const uchar* p_Needle, uintsys u_NeedleLength,
+                             bool b_Case)
+{
+    for (uintsys u = 0; u + u_NeedleLength <= u_Length; ++u)
+    {
+        uintsys v = 0;
+
+        while ((v < u_NeedleLength) &&
+               (ByteCompare (p_Haystack[u + v], p_Needle[v], b_Case) == 0))
+        {
+            ++v;
+        }
+
+        if (v == u_NeedleLength)
+        {
+            return p_Haystack + u;
+        }
+    }
+
+    return 0;
+}
+
+static void Run (Benchmark& bench, const String& str_Haystack,
+                 const String& str_Needle, bool b_Case, int n_Engine)
+{
+    const uchar* p_Haystack = str_Haystack.PointerToFirstByte();
+    const uchar* p_Needle   = str_Needle.PointerToFirstByte();
+
+    uintsys u_Length = str_Haystack.Length();
+    uintsys u_Needle = str_Needle.Length();
+    uintsys u_Runs   = BYTES_PER_RUN / u_Length;
+
+    if (n_Engine == BYTE_SEARCH_UNKNOWN)
+    {
+        u_Runs /= 16;   // much slower
+    }
+    else
+    {
+        ByteSearch::SetEngine ((ByteSearchEngine) n_Engine);
+    }
+
+    uintsys u_Found = 0;
+
+    bench.Start();
+
+    for (uintsys u = 0; u < u_Runs; ++u)
+    {
+        const uchar* p = (n_Engine == BYTE_SEARCH_UNKNOWN)
+            ? OldFind (p_Haystack, u_Length, p_Needle, u_Needle, b_Case)
+            : ByteSearch::Find (p_Haystack, u_Length, p_Needle, u_Needle,
+                                b_Case);
+        u_Found += (p != 0);
+    }
+
+    String str_Label ((n_Engine == BYTE_SEARCH_UNKNOWN)
+                      ? "old loop"
+                      : ByteSearch::EngineName ((ByteSearchEngine) n_Engine));
+
+    str_Label.Append (b_Case ? ", case, " : ", nocase, ");
+    str_Label.Append (u_Needle);
+    str_Label.Append (" in ");
+    str_Label.Append (u_Length);
+
+    bench.Report (str_Label, double (u_Runs) * u_Length / 1e6, "MB");
+
+    if (u_Found != 0)
+    {
+        std::cout << "unexpected match" << std::endl;
+    }
+}
+
+int main (int, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+    String str_Text ("The quick brown fox jumps over the lazy dog. ");
+    String str_Missing;
+
+    while (str_Missing.Length() < 1024)
+    {
+        str_Missing += "the lazy dog jumps over the quick brown fox ";
+    }
+
+    str_Missing += '!';     // so that no needle appears in the haystack
+
+    for (uintsys u_Length = 64; u_Length <= 1024 * 1024; u_Length *= 128)
+    {
+        String str_Haystack;
+
+        while (str_Haystack.Length() < u_Length)
+        {
+            str_Haystack += str_Text;
+        }
+
+        str_Haystack.Truncate (u_Length);
+
+        for (uintsys u_Needle = 1; u_Needle <= 1024; u_Needle *= 4)
+        {
+            if (u_Needle > u_Length)
+            {
+                break;
+            }
+
+            String str_Needle (str_Missing.Tail (u_Needle));
+
+            for (int n = 0; n < 2; ++n)
+            {
+                for (int n_Engine = BYTE_SEARCH_UNKNOWN;
+                     n_Engine <= BYTE_SEARCH_AVX2; ++n_Engine)
+                {
+                    Run (bench, str_Haystack, str_Needle, (n == 0),
+                         n_Engine);
+                }
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,201 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       ConditionBench.cpp
+//
+//  Synopsis:   Measures Condition wakeup latency: ping-pong between two
+//              threads, predicate waits with a Mutex, polling for
+//              comparison, and how far timed waits overshoot
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+using namespace mikestoolbox;
+
+const uintsys NUM_ROUNDS = 20000;
+
+Condition       gcond_Ping;
+Condition       gcond_Pong;
+Mutex           gmutex_Turn;
+uintsys         gu_Turn = 0;
+Atomic<uintsys> gu_Flag (0);
+
+void PongEvent (void*)
+{
+    for (uintsys u = 0; u < NUM_ROUNDS; ++u)
+    {
+        gcond_Ping.Wait();
+        gcond_Pong.Signal();
+    }
+}
+
+bool IsOdd ()
+{
+    return (gu_Turn & 1) == 1;
+}
+
+void PongPredicate (void*)
+{
+    MutexLocker locker (gmutex_Turn);
+
+    for (uintsys u = 0; u < NUM_ROUNDS; ++u)
+    {
+        gcond_Ping.Wait (gmutex_Turn, IsOdd);
+
+        ++gu_Turn;
+
+        gcond_Pong.Signal();
+    }
+}
+
+bool IsEven ()
+{
+    return (gu_Turn & 1) == 0;
+}
+
+void PongPolling (void*)
+{
+    for (uintsys u = 0; u < NUM_ROUNDS; ++u)
+    {
+        Backoff backoff;
+
+        while (gu_Flag.Load() != 1)
+        {
+            backoff.Pause();
+        }
+
+        gu_Flag.Store (0);
+    }
+}
+
+int main (int, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+    (new SimpleThread (PongEvent, 0))->Run();
+
+    bench.Start();
+
+    for (uintsys u = 0; u < NUM_ROUNDS; ++u)
+    {
+        gcond_Ping.Signal();
+        gcond_Pong.Wait();
+    }
+
+    bench.Report ("Signal/Wait round trips", NUM_ROUNDS, "trips");
+
+    (new SimpleThread (PongPredicate, 0))->Run();
+
+    bench.Start();
+
+    {
+        MutexLocker locker (gmutex_Turn);
+
+        for (uintsys u = 0; u < NUM_ROUNDS; ++u)
+        {
+            ++gu_Turn;
+
+            gcond_Ping.Signal();
+            gcond_Pong.Wait (gmutex_Turn, IsEven);
+        }
+    }
+
+    bench.Report ("Wait (mutex, predicate) round trips", NUM_ROUNDS,
+                  "trips");
+
+    (new SimpleThread (PongPolling, 0))->Run();
+
+    bench.Start();
+
+    for (uintsys u = 0; u < NUM_ROUNDS; ++u)
+    {
+        gu_Flag.Store (1);
+
+        Backoff backoff;
+
+        while (gu_Flag.Load() != 0)
+        {
+            backoff.Pause();
+        }
+    }
+
+    bench.Report ("Backoff polling round trips", NUM_ROUNDS, "trips");
+
+    Condition cond;
+
+    bench.Start();
+
+    for (uintsys u = 0; u < NUM_ROUNDS; ++u)
+    {
+        cond.Signal();
+    }
+
+    bench.Report ("Signal with no waiters", NUM_ROUNDS, "calls");
+
+    const uintsys u_Waits = 50;
+
+    Timer  timer;
+    double d_Overshoot = 0.0;
+
+    for (uintsys u = 0; u < u_Waits; ++u)
+    {
+        timer.Reset();
+
+        cond.Wait (1);
+
+        d_Overshoot += timer.Elapsed() - 0.001;
+    }
+
+    DoubleFormat format;
+
+    format.SetPrecision (3);
+
+    String str_Line ("ConditionBench: Wait (1 ms) average overshoot ");
+
+    str_Line.PadEnd (56);
+    str_Line.Append (d_Overshoot / u_Waits * 1e6, format);
+    str_Line.Append (" usec\n");
+
+    std::cout << str_Line << std::flush;
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       FileWriterBench.cpp
+//
+//  Synopsis:   Compares repeated File::Append calls with a FileWriter
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+using namespace mikestoolbox;
+
+const uintsys NUM_LINES   = 100000;
+const uintsys NUM_THREADS = 8;
+
+Mutex   gmutex_Done;
+uintsys gu_Done = 0;
+
+class AppendThread : public Thread
+{
+public:
+
+    AppendThread (FileWriter& writer, const String& str_Line, bool b_Sync)
+        : writer_ (writer), str_Line_ (str_Line), b_Sync_ (b_Sync) { }
+
+private:
+
+    FileWriter& writer_;
+    String      str_Line_;
+    bool        b_Sync_;
+
+    intsys Main_ ();
+};
+
+intsys AppendThread::Main_ ()
+{
+    for (uintsys u = 0; u < NUM_LINES / NUM_THREADS; ++u)
+    {
+        writer_.Append (str_Line_);
+
+        if (b_Sync_ && ((u % 64) == 63))
+        {
+            writer_.Sync();
+        }
+    }
+
+    MutexLocker locker (gmutex_Done);
+
+    ++gu_Done;
+
+    return 0;
+}
+
+static void RunThreads (FileWriter& writer, const String& str_Line,
+                        bool b_Sync)
+{
+    gu_Done = 0;
+
+    for (uintsys u = 0; u < NUM_THREADS; ++u)
+    {
+        (new AppendThread (writer, str_Line, b_Sync))->Run();
+    }
+
+    for (;;)
+    {
+        {
+            MutexLocker locker (gmutex_Done);
+
+            if (gu_Done == NUM_THREADS)
+            {
+                break;
+            }
+        }
+
+        millisleep (1);
+    }
+}
+
+int main (int, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+    String str_Line ("2024-01-01 00:00:00 audit event user=someone "
+                     "action=login result=success\n");
+
+    File file ("BenchFileWriter.log");
+
+    file.Delete();
+
+    bench.Start();
+
+    for (uintsys u = 0; u < NUM_LINES; ++u)
+    {
+        file.Append (str_Line);
+    }
+
+    bench.Report ("File::Append", NUM_LINES, "lines");
+
+    file.Delete();
+
+    {
+        FileWriter writer (file.Name());
+
+        bench.Start();
+
+        for (uintsys u = 0; u < NUM_LINES; ++u)
+        {
+            writer.Append (str_Line);
+        }
+
+        writer.Flush();
+
+        bench.Report ("FileWriter::Append", NUM_LINES, "lines");
+    }
+
+    file.Delete();
+
+    {
+        FileWriter writer (file.Name());
+
+        bench.Start();
+
+        RunThreads (writer, str_Line, false);
+
+        writer.Flush();
+
+        bench.Report ("FileWriter::Append, 8 threads", NUM_LINES, "lines");
+
+        RunThreads (writer, str_Line, true);
+
+        bench.Report ("FileWriter::Sync every 64, 8 threads",
+                      NUM_LINES, "lines");
+    }
+
+    file.Delete();
+
+    return 0;
+}
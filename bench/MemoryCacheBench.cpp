@@ -0,0 +1,122 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       MemoryCacheBench.cpp
+//
+//  Synopsis:   Measures building and destroying short strings on several
+//              threads with and without the per-thread block cache
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+using namespace mikestoolbox;
+
+const uintsys NUM_STRINGS = 200000;
+const uintsys MAX_THREADS = 8;
+
+Atomic<uintsys> gu_Done (0);
+
+void BuildStrings (void*)
+{
+    for (uintsys u = 0; u < NUM_STRINGS; ++u)
+    {
+        String str ("key=");
+
+        str += "value";
+        str += ", another=";
+        str += "something a little longer than the first one";
+    }
+
+    gu_Done.Increment();
+}
+
+static void Run (Benchmark& bench, uintsys u_Threads, const char* pz_Label)
+{
+    gu_Done.Store (0);
+
+    bench.Start();
+
+    for (uintsys u = 0; u < u_Threads; ++u)
+    {
+        (new SimpleThread (BuildStrings, 0))->Run();
+    }
+
+    while (gu_Done.Load() < u_Threads)
+    {
+        millisleep (1);
+    }
+
+    String str_Label (pz_Label);
+
+    str_Label.Append (", ");
+    str_Label.Append (u_Threads);
+    str_Label.Append (" threads");
+
+    bench.Report (str_Label, u_Threads * NUM_STRINGS, "strings");
+}
+
+int main (int, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+    uintsys u_Limit = MemoryCache::Limit();
+
+    for (uintsys u_Threads = 1; u_Threads <= MAX_THREADS; u_Threads *= 2)
+    {
+        MemoryCache::SetLimit (u_Limit);
+
+        Run (bench, u_Threads, "cached");
+
+        MemoryCache::SetLimit (0);
+
+        Run (bench, u_Threads, "uncached");
+    }
+
+    MemoryCache::SetLimit (u_Limit);
+
+    MemoryCacheStats stats (MemoryCache::Stats());
+
+    std::cout << "hit rate " << (100.0 * stats.HitRate()) << "%"
+              << std::endl;
+
+    return 0;
+}
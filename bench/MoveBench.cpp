@@ -0,0 +1,277 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       MoveBench.cpp
+//
+//  Synopsis:   Counts reference count operations and block allocations
+//              per operation when values are copied and when they are moved
+//
+//  Notes:      Build the library and this once as they are and once with
+//              DEFINES=-DENABLE_MOVE_SEMANTICS (and a C++11 or later
+//              compiler) to compare before and after move semantics
+//----------------------------------------------------------------------------
+
+#define COUNT_REFERENCES
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+#include <vector>
+
+using namespace mikestoolbox;
+
+#ifdef HAVE_MOVE_SEMANTICS
+#define MOVE(x) std::move(x)
+#else
+#define MOVE(x) (x)
+#endif
+
+const uintsys NUM_OPERATIONS = 200000;
+
+//+---------------------------------------------------------------------------
+//  Class:      Counters
+//
+//  Synopsis:   Snapshot of the reference count and allocation tallies
+//----------------------------------------------------------------------------
+
+class Counters
+{
+public:
+
+    Counters ();
+
+    void Report (Benchmark& bench, const char* pz_Label, bool b_Move);
+
+private:
+
+    static uint64  Allocations_ ();
+
+    uint64  u_Allocations_;
+};
+
+inline Counters::Counters ()
+    : u_Allocations_ (Allocations_())
+{
+    RefCount::ResetOperations();
+}
+
+inline uint64 Counters::Allocations_ ()
+{
+    MemoryCacheStats stats (MemoryCache::ThreadStats());
+
+    return stats.Hits() + stats.Misses();
+}
+
+void Counters::Report (Benchmark& bench, const char* pz_Label, bool b_Move)
+{
+    double d_Refs   = RefCount::Operations();
+    double d_Allocs = Allocations_() - u_Allocations_;
+
+    String str_Label (pz_Label);
+
+    str_Label.Append (b_Move ? ", move" : ", copy");
+
+    bench.Report (str_Label, NUM_OPERATIONS, "ops");
+
+    std::cout << "    " << (d_Refs / NUM_OPERATIONS) << " refcount ops, "
+              << (d_Allocs / NUM_OPERATIONS) << " allocations per op"
+              << std::endl;
+}
+
+static List<String> BuildList ()
+{
+    List<String> list;
+
+    list.Append (String ("alpha"));
+    list.Append (String ("beta"));
+
+    return list;
+}
+
+static void AppendTemporaries (Benchmark& bench, bool b_Move)
+{
+    StringList strl;
+
+    bench.Start();
+
+    Counters counters;
+
+    for (uintsys u = 0; u < NUM_OPERATIONS; ++u)
+    {
+        String str ("a short temporary string");
+
+        if (b_Move)
+        {
+            strl.Append (MOVE (str));
+        }
+        else
+        {
+            strl.Append (str);
+        }
+    }
+
+    counters.Report (bench, "StringList::Append", b_Move);
+}
+
+static void AssignReturnedList (Benchmark& bench, bool b_Move)
+{
+    List<String> list;
+
+    bench.Start();
+
+    Counters counters;
+
+    for (uintsys u = 0; u < NUM_OPERATIONS; ++u)
+    {
+        if (b_Move)
+        {
+            list = BuildList();
+        }
+        else
+        {
+            const List<String> list_Copy (BuildList());
+
+            list = list_Copy;
+        }
+    }
+
+    counters.Report (bench, "List returned by value", b_Move);
+}
+
+static void SetTemporaries (Benchmark& bench, bool b_Move)
+{
+    Map<String,String> map;
+    String             str_Key ("key");
+
+    bench.Start();
+
+    Counters counters;
+
+    for (uintsys u = 0; u < NUM_OPERATIONS; ++u)
+    {
+        String str_Value ("a value to store");
+
+        if (b_Move)
+        {
+            map.Set (str_Key, MOVE (str_Value));
+        }
+        else
+        {
+            map.Set (str_Key, str_Value);
+        }
+    }
+
+    counters.Report (bench, "Map::Set", b_Move);
+}
+
+static void SwapStrings (Benchmark& bench, bool b_Move)
+{
+    String str1 ("first");
+    String str2 ("second");
+
+    bench.Start();
+
+    Counters counters;
+
+    for (uintsys u = 0; u < NUM_OPERATIONS; ++u)
+    {
+        if (b_Move)
+        {
+            std::swap (str1, str2);
+        }
+        else
+        {
+            const String str_Temp (str1);
+
+            str1 = str2;
+            str2 = str_Temp;
+        }
+    }
+
+    counters.Report (bench, "std::swap of Strings", b_Move);
+}
+
+static void GrowVector (Benchmark& bench, bool b_Move)
+{
+    std::vector<String> v;
+
+    bench.Start();
+
+    Counters counters;
+
+    for (uintsys u = 0; u < NUM_OPERATIONS; ++u)
+    {
+        String str ("element");
+
+        if (b_Move)
+        {
+            v.push_back (MOVE (str));
+        }
+        else
+        {
+            v.push_back (str);
+        }
+    }
+
+    counters.Report (bench, "std::vector<String> growth", b_Move);
+}
+
+int main (int, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+#ifndef HAVE_MOVE_SEMANTICS
+    std::cout << "built without move semantics" << std::endl;
+#endif
+
+    for (int n = 0; n < 2; ++n)
+    {
+        bool b_Move = (n == 1);
+
+        AppendTemporaries  (bench, b_Move);
+        AssignReturnedList (bench, b_Move);
+        SetTemporaries     (bench, b_Move);
+        SwapStrings        (bench, b_Move);
+        GrowVector         (bench, b_Move);
+    }
+
+    return 0;
+}
@@ -0,0 +1,231 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       MultiPatternBench.cpp
+//
+//  Synopsis:   Measures StringList::Grep for many literal keywords with a
+//              MultiPattern, a regex alternation and a loop of Contains
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+using namespace mikestoolbox;
+
+const uintsys NUM_LINES = 20000;
+
+static uint32 gu_Seed = 2024;
+
+static uintsys Random (uintsys u_Limit)
+{
+    gu_Seed = gu_Seed * 1103515245 + 12345;
+
+    return (gu_Seed >> 8) % u_Limit;
+}
+
+static String RandomWord ()
+{
+    String str;
+
+    for (uintsys u = 3 + Random (8); u > 0; --u)
+    {
+        str.Append ((char) ('a' + Random (26)));
+    }
+
+    return str;
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   MakeLines
+//
+//  Synopsis:   Log-like lines of about 100 bytes; every 50th one has a
+//              keyword in it
+//----------------------------------------------------------------------------
+
+static StringList MakeLines (const StringList& strl_Keywords)
+{
+    StringList strl_Lines;
+
+    for (uintsys u = 0; u < NUM_LINES; ++u)
+    {
+        String str_Line ("2024-05-01 12:00:00 worker ");
+
+        while (str_Line.Length() < 100)
+        {
+            str_Line.Append (RandomWord());
+            str_Line.Append (' ');
+        }
+
+        if (u % 50 == 0)
+        {
+            str_Line.Append (strl_Keywords[Random (strl_Keywords.NumItems())]);
+        }
+
+        strl_Lines.Append (str_Line);
+    }
+
+    return strl_Lines;
+}
+
+static String Label (const char* pz_Method, uintsys u_Keywords)
+{
+    String str_Label (pz_Method);
+
+    str_Label.Append (", ");
+    str_Label.Append (u_Keywords);
+    str_Label.Append (" keywords");
+
+    return str_Label;
+}
+
+static void Run (Benchmark& bench, const StringList& strl_Keywords,
+                 const char* pz_Name)
+{
+    StringList strl_Lines (MakeLines (strl_Keywords));
+
+    uintsys u_Keywords = strl_Keywords.NumItems();
+    uintsys u_Found    = 0;
+
+    bench.Start();
+
+    MultiPattern patterns (strl_Keywords);
+
+    bench.Report (Label ("compile MultiPattern", u_Keywords), 1, "sets");
+
+    u_Found += strl_Lines.Grep (patterns).NumItems();   // warm up
+
+    for (int n = BYTE_SEARCH_AVX2; n >= BYTE_SEARCH_SCALAR; --n)
+    {
+        ByteSearch::SetEngine ((ByteSearchEngine) n);
+
+        String str_Label (pz_Name);
+
+        str_Label.Append (" MultiPattern ");
+        str_Label.Append (ByteSearch::EngineName ((ByteSearchEngine) n));
+
+        bench.Start();
+
+        for (int r = 0; r < 10; ++r)
+        {
+            u_Found += strl_Lines.Grep (patterns).NumItems();
+        }
+
+        bench.Report (Label (str_Label.C(), u_Keywords), 10 * NUM_LINES,
+                      "lines");
+    }
+
+    ByteSearch::SetEngine (BYTE_SEARCH_UNKNOWN);
+
+    // the others are much slower with many keywords, so they get fewer lines
+
+    uintsys u_Lines = Minimum (NUM_LINES, NUM_LINES * 10 / u_Keywords);
+
+    strl_Lines.Truncate (u_Lines);
+
+    String str_Label (pz_Name);
+
+    str_Label.Append (" regex alternation");
+
+    bench.Start();
+
+    PerlRegex regex ("(?:" + strl_Keywords.Join ('|') + ")");
+
+    u_Found += strl_Lines.Grep (regex).NumItems();
+
+    bench.Report (Label (str_Label.C(), u_Keywords), u_Lines, "lines");
+
+    str_Label = pz_Name;
+    str_Label.Append (" loop of Contains");
+
+    bench.Start();
+
+    StringListIter iter (strl_Lines);
+
+    for (; iter; ++iter)
+    {
+        StringListIter iter_Keyword (strl_Keywords);
+
+        for (; iter_Keyword; ++iter_Keyword)
+        {
+            if (iter->Contains (*iter_Keyword))
+            {
+                ++u_Found;
+                break;
+            }
+        }
+    }
+
+    bench.Report (Label (str_Label.C(), u_Keywords), u_Lines, "lines");
+
+    if (u_Found == 0)
+    {
+        std::cout << "nothing found" << std::endl;
+    }
+}
+
+int main (int, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+    // a few keywords that start with rarely used bytes
+
+    StringList strl_Alerts;
+
+    strl_Alerts.Append ("ERROR", "FATAL", "panic:", "Exception");
+
+    Run (bench, strl_Alerts, "alerts");
+
+    // many ordinary words, which can start with any letter
+
+    for (uintsys u_Keywords = 10; u_Keywords <= 1000; u_Keywords *= 10)
+    {
+        StringList strl_Keywords;
+
+        while (strl_Keywords.NumItems() < u_Keywords)
+        {
+            strl_Keywords.Append (RandomWord() + RandomWord());
+        }
+
+        Run (bench, strl_Keywords, "words");
+    }
+
+    return 0;
+}
@@ -0,0 +1,200 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       MutexBench.cpp
+//
+//  Synopsis:   Compares Mutex, AdaptiveMutex and ReadWriteMutex guarding a
+//              Map at 1 to 64 threads with read-heavy and write-heavy mixes
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+using namespace mikestoolbox;
+
+const uintsys NUM_OPS  = 400000;
+const uintsys NUM_KEYS = 1024;
+
+Map<uintsys, uintsys> gmap_Table;
+Atomic<uintsys>       gu_Done (0);
+
+//+---------------------------------------------------------------------------
+//  Classes:    MutexPolicy, AdaptivePolicy, ReadWritePolicy
+//
+//  Synopsis:   Uniform read/write locking over the three lock types
+//----------------------------------------------------------------------------
+
+class MutexPolicy
+{
+public:
+    void ReadLock    () { mutex_.Lock(); }
+    void ReadUnlock  () { mutex_.Unlock(); }
+    void WriteLock   () { mutex_.Lock(); }
+    void WriteUnlock () { mutex_.Unlock(); }
+private:
+    Mutex mutex_;
+};
+
+class AdaptivePolicy
+{
+public:
+    void ReadLock    () { mutex_.Lock(); }
+    void ReadUnlock  () { mutex_.Unlock(); }
+    void WriteLock   () { mutex_.Lock(); }
+    void WriteUnlock () { mutex_.Unlock(); }
+private:
+    AdaptiveMutex mutex_;
+};
+
+class ReadWritePolicy
+{
+public:
+    void ReadLock    () { rwmutex_.LockShared(); }
+    void ReadUnlock  () { rwmutex_.UnlockShared(); }
+    void WriteLock   () { rwmutex_.Lock(); }
+    void WriteUnlock () { rwmutex_.Unlock(); }
+private:
+    ReadWriteMutex rwmutex_;
+};
+
+template<typename POLICY>
+class WorkerThread : public Thread
+{
+public:
+
+    WorkerThread (POLICY& policy, uintsys u_Ops, uintsys u_WriteEvery,
+                  uintsys u_Seed)
+        : policy_ (policy), u_Ops_ (u_Ops), u_WriteEvery_ (u_WriteEvery)
+        , u_Seed_ (u_Seed) { }
+
+private:
+
+    POLICY& policy_;
+    uintsys u_Ops_;
+    uintsys u_WriteEvery_;
+    uintsys u_Seed_;
+
+    intsys Main_ ()
+    {
+        uintsys u_Key = u_Seed_;
+        uintsys u_Value;
+
+        for (uintsys u = 0; u < u_Ops_; ++u)
+        {
+            u_Key = (u_Key * 1103515245 + 12345) % NUM_KEYS;
+
+            if ((u % u_WriteEvery_) == 0)
+            {
+                policy_.WriteLock();
+                gmap_Table.Set (u_Key, u);
+                policy_.WriteUnlock();
+            }
+            else
+            {
+                policy_.ReadLock();
+                gmap_Table.Find (u_Key, u_Value);
+                policy_.ReadUnlock();
+            }
+        }
+
+        gu_Done.Increment();
+
+        return 0;
+    }
+};
+
+template<typename POLICY>
+static void Run (Benchmark& bench, const char* pz_Name, uintsys u_Threads,
+                 uintsys u_WriteEvery, const char* pz_Mix)
+{
+    POLICY policy;
+
+    gu_Done.Store (0);
+
+    bench.Start();
+
+    for (uintsys u = 0; u < u_Threads; ++u)
+    {
+        (new WorkerThread<POLICY> (policy, NUM_OPS / u_Threads,
+                                   u_WriteEvery, u))->Run();
+    }
+
+    while (gu_Done.Load() < u_Threads)
+    {
+        millisleep (1);
+    }
+
+    String str_Label (pz_Name);
+
+    str_Label.Append (", ");
+    str_Label.Append (pz_Mix);
+    str_Label.Append (", ");
+    str_Label.Append (u_Threads);
+    str_Label.Append (" threads");
+
+    bench.Report (str_Label, NUM_OPS);
+}
+
+int main (int, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+    for (uintsys u = 0; u < NUM_KEYS; ++u)
+    {
+        gmap_Table.Set (u, u);
+    }
+
+    for (uintsys u_Threads = 1; u_Threads <= 64; u_Threads *= 2)
+    {
+        Run<MutexPolicy>     (bench, "Mutex",          u_Threads, 20, "5% w");
+        Run<AdaptivePolicy>  (bench, "AdaptiveMutex",  u_Threads, 20, "5% w");
+        Run<ReadWritePolicy> (bench, "ReadWriteMutex", u_Threads, 20, "5% w");
+    }
+
+    for (uintsys u_Threads = 1; u_Threads <= 64; u_Threads *= 2)
+    {
+        Run<MutexPolicy>     (bench, "Mutex",          u_Threads, 2, "50% w");
+        Run<AdaptivePolicy>  (bench, "AdaptiveMutex",  u_Threads, 2, "50% w");
+        Run<ReadWritePolicy> (bench, "ReadWriteMutex", u_Threads, 2, "50% w");
+    }
+
+    return 0;
+}
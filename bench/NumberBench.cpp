@@ -0,0 +1,228 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       NumberBench.cpp
+//
+//  Synopsis:   Measures formatting and parsing integers and doubles as
+//              String does it now against printf, strtod and the old
+//              digit-at-a-time loop
+//----------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+using namespace mikestoolbox;
+
+const uintsys NUM_VALUES = 1000000;
+
+static uint32 gu_Seed = 12345;
+
+static uintsys Random (uintsys u_Limit)
+{
+    gu_Seed = gu_Seed * 1103515245 + 12345;
+
+    return (gu_Seed >> 8) % u_Limit;
+}
+
+//  What String (int64) used to do
+
+static String OldFormat (int64 n)
+{
+    String str;
+
+    bool   b_Negative = (n < 0);
+    uint64 u          = b_Negative ? 0 - (uint64) n : (uint64) n;
+
+    do
+    {
+        str.Append ((char) ('0' + u % 10));
+
+        u /= 10;
+    }
+    while (u != 0);
+
+    if (b_Negative)
+    {
+        str.Append ('-');
+    }
+
+    str.Reverse();
+
+    return str;
+}
+
+static String Printf (const char* pz_Format, double d)
+{
+    char ac[64];
+
+    snprintf (ac, sizeof(ac), pz_Format, d);
+
+    return String (ac);
+}
+
+int main (int, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+    // counters and gauges: integers of every size, and doubles that are
+    // mostly a few decimal places with some full-precision ratios mixed in
+
+    int64*  an_Ints    = new int64  [NUM_VALUES];
+    double* ad_Doubles = new double [NUM_VALUES];
+    String* as_Ints    = new String [NUM_VALUES];
+    String* as_Doubles = new String [NUM_VALUES];
+
+    for (uintsys u = 0; u < NUM_VALUES; ++u)
+    {
+        int64 n = 1;
+
+        for (uintsys u_Digits = Random (19); u_Digits != 0; --u_Digits)
+        {
+            n = n * 10 + Random (10);
+        }
+
+        an_Ints[u] = Random (4) ? n : -n;
+
+        switch (Random (3))
+        {
+            case 0:  ad_Doubles[u] = Random (10000000) / 1000.0; break;
+            case 1:  ad_Doubles[u] = Random (100) / 7.0;         break;
+            default: ad_Doubles[u] = Random (1000000) * 1e-9;    break;
+        }
+    }
+
+    uintsys u_Total = 0;
+
+    bench.Start();
+
+    for (uintsys u = 0; u < NUM_VALUES; ++u)
+    {
+        u_Total += OldFormat (an_Ints[u]).Length();
+    }
+
+    bench.Report ("format integers, old loop", NUM_VALUES, "numbers");
+
+    for (uintsys u = 0; u < NUM_VALUES; ++u)
+    {
+        u_Total += String (an_Ints[u]).Length();
+    }
+
+    bench.Report ("format integers", NUM_VALUES, "numbers");
+
+    for (uintsys u = 0; u < NUM_VALUES; ++u)
+    {
+        u_Total += Printf ("%1.8g", ad_Doubles[u]).Length();
+    }
+
+    bench.Report ("format doubles, snprintf %.8g", NUM_VALUES, "numbers");
+
+    for (uintsys u = 0; u < NUM_VALUES; ++u)
+    {
+        u_Total += String (ad_Doubles[u]).Length();
+    }
+
+    bench.Report ("format doubles, precision 8", NUM_VALUES, "numbers");
+
+    for (uintsys u = 0; u < NUM_VALUES; ++u)
+    {
+        u_Total += Printf ("%.17g", ad_Doubles[u]).Length();
+    }
+
+    bench.Report ("format doubles, snprintf %.17g", NUM_VALUES, "numbers");
+
+    DoubleFormat format;
+
+    format.UseShortestDigits();
+
+    for (uintsys u = 0; u < NUM_VALUES; ++u)
+    {
+        u_Total += String (ad_Doubles[u], format).Length();
+    }
+
+    bench.Report ("format doubles, shortest", NUM_VALUES, "numbers");
+
+    for (uintsys u = 0; u < NUM_VALUES; ++u)
+    {
+        as_Ints[u]    = String (an_Ints[u]);
+        as_Doubles[u] = String (ad_Doubles[u], format);
+    }
+
+    bench.Start();
+
+    for (uintsys u = 0; u < NUM_VALUES; ++u)
+    {
+        u_Total += std::strtol (as_Ints[u].C(), 0, 10);
+    }
+
+    bench.Report ("parse integers, strtol", NUM_VALUES, "numbers");
+
+    for (uintsys u = 0; u < NUM_VALUES; ++u)
+    {
+        u_Total += as_Ints[u].AsInt();
+    }
+
+    bench.Report ("parse integers", NUM_VALUES, "numbers");
+
+    double d_Total = 0;
+
+    for (uintsys u = 0; u < NUM_VALUES; ++u)
+    {
+        d_Total += std::strtod (as_Doubles[u].C(), 0);
+    }
+
+    bench.Report ("parse doubles, strtod", NUM_VALUES, "numbers");
+
+    for (uintsys u = 0; u < NUM_VALUES; ++u)
+    {
+        d_Total += as_Doubles[u].AsDouble();
+    }
+
+    bench.Report ("parse doubles", NUM_VALUES, "numbers");
+
+    delete [] an_Ints;
+    delete [] ad_Doubles;
+    delete [] as_Ints;
+    delete [] as_Doubles;
+
+    return (u_Total + (uintsys) d_Total) == 0;
+}
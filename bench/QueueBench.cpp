@@ -0,0 +1,239 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       QueueBench.cpp
+//
+//  Synopsis:   Compares SPSCQueue and MPMCQueue with a Mutex protected List
+//              for 1 to 32 producer and consumer threads
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+using namespace mikestoolbox;
+
+const uintsys NUM_ITEMS      = 1 << 20;
+const uintsys QUEUE_CAPACITY = 1024;
+
+Atomic<uintsys> gu_Done (0);
+
+//+---------------------------------------------------------------------------
+//  Class:      LockedQueue
+//
+//  Synopsis:   The pattern the lock-free queues replace: a bounded List
+//              guarded by a Mutex, polled with the same backoff
+//----------------------------------------------------------------------------
+
+class LockedQueue
+{
+public:
+
+    LockedQueue (uintsys u_Capacity)
+        : mutex_ (), list_ (), u_Capacity_ (u_Capacity), b_Closed_ (false) { }
+
+    bool Push (uintsys u)
+    {
+        Backoff backoff;
+
+        for (;;)
+        {
+            {
+                MutexLocker locker (mutex_);
+
+                if (list_.NumItems() < u_Capacity_)
+                {
+                    list_.Append (u);
+
+                    return true;
+                }
+            }
+
+            backoff.Pause();
+        }
+    }
+
+    bool Pop (uintsys& u)
+    {
+        Backoff backoff;
+
+        for (;;)
+        {
+            {
+                MutexLocker locker (mutex_);
+
+                if (!list_.IsEmpty())
+                {
+                    u = list_.Shift();
+
+                    return true;
+                }
+
+                if (b_Closed_)
+                {
+                    return false;
+                }
+            }
+
+            backoff.Pause();
+        }
+    }
+
+    void Close ()
+    {
+        MutexLocker locker (mutex_);
+
+        b_Closed_ = true;
+    }
+
+private:
+
+    Mutex         mutex_;
+    List<uintsys> list_;
+    uintsys       u_Capacity_;
+    bool          b_Closed_;
+};
+
+template<typename QUEUE>
+class ProducerThread : public Thread
+{
+public:
+
+    ProducerThread (QUEUE& queue, uintsys u_Count)
+        : queue_ (queue), u_Count_ (u_Count) { }
+
+private:
+
+    QUEUE&  queue_;
+    uintsys u_Count_;
+
+    intsys Main_ ()
+    {
+        for (uintsys u = 0; u < u_Count_; ++u)
+        {
+            queue_.Push (u);
+        }
+
+        gu_Done.Increment();
+
+        return 0;
+    }
+};
+
+template<typename QUEUE>
+class ConsumerThread : public Thread
+{
+public:
+
+    ConsumerThread (QUEUE& queue) : queue_ (queue) { }
+
+private:
+
+    QUEUE& queue_;
+
+    intsys Main_ ()
+    {
+        uintsys u_Item;
+
+        while (queue_.Pop (u_Item))
+        {
+            // nothing
+        }
+
+        gu_Done.Increment();
+
+        return 0;
+    }
+};
+
+static void WaitForThreads (uintsys u_Count)
+{
+    while (gu_Done.Load() < u_Count)
+    {
+        millisleep (1);
+    }
+}
+
+template<typename QUEUE>
+static void RunQueue (Benchmark& bench, const char* pz_Name,
+                      uintsys u_Threads)
+{
+    QUEUE queue (QUEUE_CAPACITY);
+
+    gu_Done.Store (0);
+
+    bench.Start();
+
+    for (uintsys u = 0; u < u_Threads; ++u)
+    {
+        (new ConsumerThread<QUEUE> (queue))->Run();
+        (new ProducerThread<QUEUE> (queue, NUM_ITEMS / u_Threads))->Run();
+    }
+
+    WaitForThreads (u_Threads);
+
+    queue.Close();
+
+    WaitForThreads (2 * u_Threads);
+
+    String str_Label (pz_Name);
+
+    str_Label.Append (", ");
+    str_Label.Append (u_Threads);
+    str_Label.Append (" x ");
+    str_Label.Append (u_Threads);
+
+    bench.Report (str_Label, NUM_ITEMS, "items");
+}
+
+int main (int, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+    RunQueue<SPSCQueue<uintsys> > (bench, "SPSCQueue", 1);
+
+    for (uintsys u_Threads = 1; u_Threads <= 32; u_Threads *= 2)
+    {
+        RunQueue<MPMCQueue<uintsys> > (bench, "MPMCQueue", u_Threads);
+        RunQueue<LockedQueue>         (bench, "Mutex + List", u_Threads);
+    }
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       StringBuilderBench.cpp
+//
+//  Synopsis:   Compares building a large output with String::Append,
+//              StringList::Join and StringBuilder, and writing it to a file
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+using namespace mikestoolbox;
+
+const uintsys NUM_PIECES = 64 * 1024;
+
+static void BuildString (Benchmark& bench, const String& str_Piece)
+{
+    bench.Start();
+
+    String str;
+
+    for (uintsys u = 0; u < NUM_PIECES; ++u)
+    {
+        str.Append (str_Piece);
+    }
+
+    File file ("BenchStringBuilder");
+
+    file.Write (str);
+
+    String str_Label ("String::Append, ");
+
+    str_Label.Append (str_Piece.Length());
+    str_Label.Append (" byte pieces");
+
+    bench.Report (str_Label, NUM_PIECES, "pieces");
+}
+
+static void BuildList (Benchmark& bench, const String& str_Piece)
+{
+    bench.Start();
+
+    StringList strl;
+
+    for (uintsys u = 0; u < NUM_PIECES; ++u)
+    {
+        strl.Append (str_Piece);
+    }
+
+    File file ("BenchStringBuilder");
+
+    file.Write (strl.Join());
+
+    String str_Label ("StringList::Join, ");
+
+    str_Label.Append (str_Piece.Length());
+    str_Label.Append (" byte pieces");
+
+    bench.Report (str_Label, NUM_PIECES, "pieces");
+}
+
+static void BuildRope (Benchmark& bench, const String& str_Piece,
+                       bool b_Flatten)
+{
+    bench.Start();
+
+    StringBuilder sb;
+
+    for (uintsys u = 0; u < NUM_PIECES; ++u)
+    {
+        sb.Append (str_Piece);
+    }
+
+    File file ("BenchStringBuilder");
+
+    if (b_Flatten)
+    {
+        file.Write (sb.ToString());
+    }
+    else
+    {
+        file.Write (sb);
+    }
+
+    String str_Label (b_Flatten ? "StringBuilder, flattened, "
+                                : "StringBuilder, gathered, ");
+
+    str_Label.Append (str_Piece.Length());
+    str_Label.Append (" byte pieces");
+
+    bench.Report (str_Label, NUM_PIECES, "pieces");
+}
+
+int main (int, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+    for (uintsys u_Size = 16; u_Size <= 4096; u_Size *= 16)
+    {
+        String str_Piece ('x', Repeat(u_Size));
+
+        BuildString (bench, str_Piece);
+        BuildList   (bench, str_Piece);
+        BuildRope   (bench, str_Piece, true);
+        BuildRope   (bench, str_Piece, false);
+    }
+
+    File ("BenchStringBuilder").Delete();
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       StringGrowthBench.cpp
+//
+//  Synopsis:   Measures growing a string to 100 MB one Append at a time,
+//              and building strings of 1 GB and 4 GB from 1 MB appends
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+using namespace mikestoolbox;
+
+const uintsys TARGET_SIZE = 100 * 1024 * 1024;
+const uintsys LARGE_CHUNK = 1024 * 1024;
+
+static void Grow (Benchmark& bench, uintsys u_Chunk, bool b_Secure)
+{
+    String str_Chunk ('x', Repeat(u_Chunk));
+
+    bench.Start();
+
+    String str;
+
+    str.SetSecure (b_Secure);
+
+    while (str.Length() < TARGET_SIZE)
+    {
+        str.Append (str_Chunk);
+    }
+
+    String str_Label (b_Secure ? "secure" : "normal");
+
+    str_Label.Append (", ");
+    str_Label.Append (u_Chunk);
+    str_Label.Append (" byte appends");
+
+    bench.Report (str_Label, str.Length() / u_Chunk, "appends");
+}
+
+static void Build (Benchmark& bench, uint64 u_Size, double d_Factor,
+                   bool b_Secure)
+{
+    if (u_Size > ~uintsys(0))
+    {
+        return;     // 32-bit build
+    }
+
+    HeapMemory::SetGrowthFactor (d_Factor);
+
+    String str_Chunk ('x', Repeat(LARGE_CHUNK));
+
+    bench.Start();
+
+    {
+        String str;
+
+        str.SetSecure (b_Secure);
+
+        while (str.Length() < u_Size)
+        {
+            str.Append (str_Chunk);
+        }
+    }
+
+    String str_Label (b_Secure ? "secure" : "normal");
+
+    str_Label.Append (", ");
+    str_Label.Append (u_Size >> 30);
+    str_Label.Append (" GB, factor ");
+    str_Label.Append (d_Factor);
+
+    bench.Report (str_Label, double (u_Size) / LARGE_CHUNK, "MB");
+}
+
+int main (int, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+    for (uintsys u_Chunk = 16; u_Chunk <= 4096; u_Chunk *= 16)
+    {
+        Grow (bench, u_Chunk, false);
+        Grow (bench, u_Chunk, true);
+    }
+
+    const uint64 u_GB = 1024 * 1024 * 1024;
+
+    Build (bench, 1 * u_GB, 1.5, false);
+    Build (bench, 1 * u_GB, 1.5, true);     // copies on every growth
+    Build (bench, 4 * u_GB, 1.5, false);
+    Build (bench, 4 * u_GB, 2.0, false);
+
+    return 0;
+}
@@ -0,0 +1,294 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       StringIterBench.cpp
+//
+//  Synopsis:   Measures StringIter's binary extraction one value at a time
+//              for each width and byte order, into arrays, and a few bits
+//              at a time with StringBitIter
+//
+//  Notes:      An argument gives the number of megabytes to read per row
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+using namespace mikestoolbox;
+
+const uintsys DATA_SIZE   = 16 * 1024 * 1024;
+const uintsys ARRAY_BYTES = 64 * 1024;
+
+static uint32 gu_Seed = 12345;
+
+static uintsys Random (uintsys u_Limit)
+{
+    gu_Seed = gu_Seed * 1103515245 + 12345;
+
+    return (gu_Seed >> 8) % u_Limit;
+}
+
+static void Report (Benchmark& bench, const String& str_Label,
+                    uintsys u_Passes, uint64 u_Sum)
+{
+    String str (str_Label);
+
+    str.Append (", sum ");
+    str.Append (u_Sum);
+
+    bench.Report (str, (double) u_Passes * DATA_SIZE / 1048576, "MB");
+}
+
+static String Label (const char* pz_Name, bool b_LittleEndian)
+{
+    String str (pz_Name);
+
+    str.Append (b_LittleEndian ? "LE" : "BE");
+
+    return str;
+}
+
+static void ExtractValues (Benchmark& bench, const String& str_Data,
+                           uintsys u_Passes, uintsys u_Width,
+                           bool b_LittleEndian)
+{
+    uint64     u_Sum = 0;
+    ParseError error;
+
+    bench.Start();
+
+    for (uintsys u_Pass = 0; u_Pass < u_Passes; ++u_Pass)
+    {
+        StringIter iter (str_Data);
+        uintsys    u = 0;
+        uint64     u64 = 0;
+
+        if (b_LittleEndian)
+        {
+            iter.SetLittleEndian();
+        }
+
+        switch (u_Width)
+        {
+            case 2:
+                while (iter.ExtractUint16 (u, error)) u_Sum += u;
+                break;
+
+            case 3:
+                while (iter.ExtractUint24 (u, error)) u_Sum += u;
+                break;
+
+            case 4:
+                while (iter.ExtractUint32 (u, error)) u_Sum += u;
+                break;
+
+            default:
+                while (iter.ExtractUint64 (u64, error)) u_Sum += u64;
+                break;
+        }
+    }
+
+    String str_Name ("ExtractUint");
+
+    str_Name.Append (u_Width * 8);
+
+    Report (bench, Label (str_Name.C(), b_LittleEndian), u_Passes, u_Sum);
+}
+
+static void ExtractReals (Benchmark& bench, const String& str_Data,
+                          uintsys u_Passes, bool b_Double,
+                          bool b_LittleEndian)
+{
+    double     d_Sum = 0;
+    ParseError error;
+
+    bench.Start();
+
+    for (uintsys u_Pass = 0; u_Pass < u_Passes; ++u_Pass)
+    {
+        StringIter iter (str_Data);
+        float      f = 0;
+        double     d = 0;
+
+        if (b_LittleEndian)
+        {
+            iter.SetLittleEndian();
+        }
+
+        if (b_Double)
+        {
+            while (iter.ExtractDouble (d, error)) d_Sum += (d == d);
+        }
+        else
+        {
+            while (iter.ExtractFloat (f, error)) d_Sum += (f == f);
+        }
+    }
+
+    Report (bench, Label (b_Double ? "ExtractDouble" : "ExtractFloat",
+                          b_LittleEndian),
+            u_Passes, (uint64) d_Sum);
+}
+
+//  Decodes the data an array of ARRAY_BYTES at a time
+
+static void ExtractArrays (Benchmark& bench, const String& str_Data,
+                           uintsys u_Passes, uintsys u_Width,
+                           bool b_LittleEndian)
+{
+    static uint16 au16 [ARRAY_BYTES / 2];
+    static uint32 au32 [ARRAY_BYTES / 4];
+    static uint64 au64 [ARRAY_BYTES / 8];
+
+    uint64     u_Sum = 0;
+    ParseError error;
+
+    uintsys u_Count = ARRAY_BYTES / u_Width;
+
+    bench.Start();
+
+    for (uintsys u_Pass = 0; u_Pass < u_Passes; ++u_Pass)
+    {
+        StringIter iter (str_Data);
+
+        if (b_LittleEndian)
+        {
+            iter.SetLittleEndian();
+        }
+
+        for (bool b_OK = true; b_OK; )
+        {
+            switch (u_Width)
+            {
+                case 2:
+                    b_OK = iter.ExtractUint16Array (au16, u_Count, error);
+                    u_Sum += au16[0];
+                    break;
+
+                case 4:
+                    b_OK = iter.ExtractUint32Array (au32, u_Count, error);
+                    u_Sum += au32[0];
+                    break;
+
+                default:
+                    b_OK = iter.ExtractUint64Array (au64, u_Count, error);
+                    u_Sum += au64[0];
+                    break;
+            }
+        }
+    }
+
+    String str_Name ("ExtractUint");
+
+    str_Name.Append (u_Width * 8);
+    str_Name.Append ("Array");
+
+    Report (bench, Label (str_Name.C(), b_LittleEndian), u_Passes, u_Sum);
+}
+
+static void ExtractBits (Benchmark& bench, const String& str_Data,
+                         uintsys u_Passes, uintsys u_NumBits,
+                         bool b_LittleEndian)
+{
+    uint64     u_Sum = 0;
+    ParseError error;
+
+    bench.Start();
+
+    for (uintsys u_Pass = 0; u_Pass < u_Passes; ++u_Pass)
+    {
+        StringBitIter iter (str_Data);
+        uintsys       u = 0;
+
+        if (b_LittleEndian)
+        {
+            iter.SetLittleEndian();
+        }
+
+        while (iter.ExtractBits (u_NumBits, u, error))
+        {
+            u_Sum += u;
+        }
+    }
+
+    String str_Name ("ExtractBits ");
+
+    str_Name.Append (u_NumBits);
+    str_Name.Append (' ');
+
+    Report (bench, Label (str_Name.C(), b_LittleEndian), u_Passes, u_Sum);
+}
+
+int main (int argc, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+    uintsys u_Megabytes = (argc > 1) ? String (argv[1]).AsUint() : 256;
+    uintsys u_Passes    = Maximum<uintsys> (u_Megabytes / 16, 1);
+
+    String str_Data;
+
+    str_Data.Reserve (DATA_SIZE);
+
+    for (uintsys u = 0; u < DATA_SIZE; u += 2)
+    {
+        str_Data.AppendUint16 (Random (0x10000));
+    }
+
+    for (uintsys u_Little = 0; u_Little < 2; ++u_Little)
+    {
+        bool b_Little = (u_Little == 1);
+
+        ExtractValues (bench, str_Data, u_Passes, 2, b_Little);
+        ExtractValues (bench, str_Data, u_Passes, 3, b_Little);
+        ExtractValues (bench, str_Data, u_Passes, 4, b_Little);
+        ExtractValues (bench, str_Data, u_Passes, 8, b_Little);
+        ExtractReals  (bench, str_Data, u_Passes, false, b_Little);
+        ExtractReals  (bench, str_Data, u_Passes, true,  b_Little);
+        ExtractArrays (bench, str_Data, u_Passes, 2, b_Little);
+        ExtractArrays (bench, str_Data, u_Passes, 4, b_Little);
+        ExtractArrays (bench, str_Data, u_Passes, 8, b_Little);
+        ExtractBits   (bench, str_Data, u_Passes, 1,  b_Little);
+        ExtractBits   (bench, str_Data, u_Passes, 13, b_Little);
+        ExtractBits   (bench, str_Data, u_Passes, 32, b_Little);
+    }
+
+    return 0;
+}
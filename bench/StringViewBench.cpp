@@ -0,0 +1,261 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+//+---------------------------------------------------------------------------
+//  File:       StringViewBench.cpp
+//
+//  Synopsis:   Measures tokenizing 1 GB of CSV (a 64 MB file read over and
+//              over) into Strings, into StringViews and with a
+//              StringSplitIter
+//
+//  Notes:      An argument gives the total number of megabytes to tokenize
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+using namespace mikestoolbox;
+
+const uintsys FILE_SIZE = 64 * 1024 * 1024;
+
+static uint32 gu_Seed = 12345;
+
+static uintsys Random (uintsys u_Limit)
+{
+    gu_Seed = gu_Seed * 1103515245 + 12345;
+
+    return (gu_Seed >> 8) % u_Limit;
+}
+
+//  Lines that look like an access log exported to CSV
+
+static String MakeCSV ()
+{
+    static const char* apz_Methods[] = { "GET", "POST", "PUT", "DELETE" };
+
+    String str (Preallocate (FILE_SIZE + 256));
+
+    while (str.Length() < FILE_SIZE)
+    {
+        str.Append ((uint32) (1700000000 + Random (100000000)));
+        str.Append (",user");
+        str.Append ((uint32) Random (100000));
+        str.Append (',');
+        str.Append (apz_Methods[Random (4)]);
+        str.Append (",/api/v1/items/");
+        str.Append ((uint32) Random (1000000));
+        str.Append (',');
+        str.Append ((uint32) (200 + 100 * Random (4)));
+        str.Append (',');
+        str.Append ((double) Random (100000) / 1000);
+        str.Append ('\n');
+    }
+
+    return str;
+}
+
+static void Report (Benchmark& bench, const char* pz_Label,
+                    uintsys u_Passes, uintsys u_Fields, uintsys u_Sum)
+{
+    String str_Label (pz_Label);
+
+    str_Label.Append (", ");
+    str_Label.Append (u_Fields);
+    str_Label.Append (" fields, sum ");
+    str_Label.Append (u_Sum);
+
+    bench.Report (str_Label, (double) u_Passes * FILE_SIZE / 1048576, "MB");
+}
+
+static void SplitStrings (Benchmark& bench, const String& str_CSV,
+                          uintsys u_Passes)
+{
+    uintsys u_Fields = 0;
+    uintsys u_Sum    = 0;
+
+    bench.Start();
+
+    for (uintsys u = 0; u < u_Passes; ++u)
+    {
+        StringList     strl_Lines (str_CSV.Split ('\n'));
+        StringListIter iter (strl_Lines);
+
+        for (; iter; ++iter)
+        {
+            StringList strl_Fields (iter->Split (','));
+
+            u_Fields += strl_Fields.NumItems();
+            u_Sum    += strl_Fields.Shift().AsUint();
+        }
+    }
+
+    Report (bench, "Split into Strings", u_Passes, u_Fields, u_Sum);
+}
+
+static void SplitViews (Benchmark& bench, const String& str_CSV,
+                        uintsys u_Passes)
+{
+    uintsys u_Fields = 0;
+    uintsys u_Sum    = 0;
+
+    bench.Start();
+
+    for (uintsys u = 0; u < u_Passes; ++u)
+    {
+        StringViewList          list_Lines (str_CSV.SplitView ('\n'));
+        ListIter<StringView>    iter (list_Lines);
+
+        for (; iter; ++iter)
+        {
+            StringViewList list_Fields (iter->Split (','));
+
+            u_Fields += list_Fields.NumItems();
+            u_Sum    += list_Fields.Shift().AsUint();
+        }
+    }
+
+    Report (bench, "Split into StringViews", u_Passes, u_Fields, u_Sum);
+}
+
+static void SplitLazily (Benchmark& bench, const String& str_CSV,
+                         uintsys u_Passes)
+{
+    uintsys u_Fields = 0;
+    uintsys u_Sum    = 0;
+
+    bench.Start();
+
+    for (uintsys u = 0; u < u_Passes; ++u)
+    {
+        StringSplitIter iter_Line (str_CSV, '\n');
+
+        for (; iter_Line; ++iter_Line)
+        {
+            StringSplitIter iter (*iter_Line, ',');
+
+            u_Sum += iter->AsUint();
+
+            for (; iter; ++iter)
+            {
+                ++u_Fields;
+            }
+        }
+    }
+
+    Report (bench, "StringSplitIter", u_Passes, u_Fields, u_Sum);
+}
+
+//  Walks the fields without building lists, so that only the cost of
+//  making each field is compared
+
+static void SegmentStrings (Benchmark& bench, const String& str_CSV,
+                            uintsys u_Passes)
+{
+    StringView view (str_CSV);
+
+    uintsys u_Fields = 0;
+    uintsys u_Sum    = 0;
+
+    bench.Start();
+
+    for (uintsys u = 0; u < u_Passes; ++u)
+    {
+        intsys n_Start = 0;
+        intsys n_End   = 0;
+
+        while ((n_End = view.FindFirst (',', n_Start)) >= 0)
+        {
+            String str_Field (str_CSV.Segment (n_Start, n_End - n_Start));
+
+            u_Sum   += str_Field.Length();
+            n_Start  = n_End + 1;
+
+            ++u_Fields;
+        }
+    }
+
+    Report (bench, "Segment into Strings", u_Passes, u_Fields, u_Sum);
+}
+
+static void SegmentViews (Benchmark& bench, const String& str_CSV,
+                          uintsys u_Passes)
+{
+    StringView view (str_CSV);
+
+    uintsys u_Fields = 0;
+    uintsys u_Sum    = 0;
+
+    bench.Start();
+
+    for (uintsys u = 0; u < u_Passes; ++u)
+    {
+        intsys n_Start = 0;
+        intsys n_End   = 0;
+
+        while ((n_End = view.FindFirst (',', n_Start)) >= 0)
+        {
+            StringView view_Field (view.Segment (n_Start, n_End - n_Start));
+
+            u_Sum   += view_Field.Length();
+            n_Start  = n_End + 1;
+
+            ++u_Fields;
+        }
+    }
+
+    Report (bench, "Segment into StringViews", u_Passes, u_Fields, u_Sum);
+}
+
+int main (int argc, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+    uintsys u_Megabytes = (argc > 1) ? String (argv[1]).AsUint() : 1024;
+    uintsys u_Passes    = Maximum (u_Megabytes / 64, (uintsys) 1);
+
+    String str_CSV (MakeCSV());
+
+    SplitStrings   (bench, str_CSV, u_Passes);
+    SplitViews     (bench, str_CSV, u_Passes);
+    SplitLazily    (bench, str_CSV, u_Passes);
+    SegmentStrings (bench, str_CSV, u_Passes);
+    SegmentViews   (bench, str_CSV, u_Passes);
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       ThreadPoolBench.cpp
+//
+//  Synopsis:   Measures the per-task scheduling overhead of ThreadPool
+//              against creating a Thread for each task
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+using namespace mikestoolbox;
+
+const uintsys NUM_TASKS   = 200000;
+const uintsys NUM_THREADS = 1000;
+
+Atomic<uintsys> gu_Count (0);
+
+void EmptyTask (void*)
+{
+    gu_Count.Increment();
+}
+
+void EmptyRange (uintsys u_Begin, uintsys u_End, void*)
+{
+    gu_Count.FetchAdd (u_End - u_Begin);
+}
+
+//+---------------------------------------------------------------------------
+//  Class:      SpawnTask
+//
+//  Synopsis:   Submits its tasks from a worker so they go onto the worker's
+//              own deque and are stolen by the others
+//----------------------------------------------------------------------------
+
+class SpawnTask : public Task
+{
+public:
+
+    SpawnTask (ThreadPool& pool) : pool_ (pool) { }
+
+private:
+
+    ThreadPool& pool_;
+
+    void Main_ ()
+    {
+        TaskHandle handle;
+
+        for (uintsys u = 0; u < NUM_TASKS; ++u)
+        {
+            handle = pool_.Submit (EmptyTask, 0);
+        }
+
+        handle.Wait();
+    }
+};
+
+static void WaitForCount (uintsys u_Count)
+{
+    while (gu_Count.Load() < u_Count)
+    {
+        YieldThread();
+    }
+}
+
+int main (int, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+    gu_Count.Store (0);
+
+    bench.Start();
+
+    for (uintsys u = 0; u < NUM_THREADS; ++u)
+    {
+        (new SimpleThread (EmptyTask, 0))->Run();
+    }
+
+    WaitForCount (NUM_THREADS);
+
+    bench.Report ("SimpleThread per task", NUM_THREADS, "tasks");
+
+    ThreadPool pool;
+
+    gu_Count.Store (0);
+
+    bench.Start();
+
+    for (uintsys u = 0; u < NUM_TASKS; ++u)
+    {
+        pool.Submit (EmptyTask, 0);
+    }
+
+    WaitForCount (NUM_TASKS);
+
+    bench.Report ("ThreadPool::Submit from outside", NUM_TASKS, "tasks");
+
+    gu_Count.Store (0);
+
+    bench.Start();
+
+    pool.Submit (new SpawnTask (pool)).Wait();
+
+    WaitForCount (NUM_TASKS);
+
+    bench.Report ("ThreadPool::Submit from a worker", NUM_TASKS, "tasks");
+
+    gu_Count.Store (0);
+
+    bench.Start();
+
+    pool.ParallelFor (0, NUM_TASKS, EmptyRange, 0, 1);
+
+    bench.Report ("ThreadPool::ParallelFor, grain 1", NUM_TASKS, "items");
+
+    return 0;
+}
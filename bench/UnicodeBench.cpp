@@ -0,0 +1,237 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       UnicodeBench.cpp
+//
+//  Synopsis:   Measures UTF-8 validation and UTF-8/UTF-16 transcoding on
+//              ASCII, Latin, CJK and emoji text, for each engine and the
+//              old character-at-a-time loops
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Bench.h"
+
+using namespace mikestoolbox;
+
+const uintsys BYTES_PER_RUN = 512 * 1024 * 1024;
+
+enum Operation
+{
+    VALIDATE,
+    TO_UTF16,
+    FROM_UTF16
+};
+
+static const char* apz_Operation[] = { "validate", "to UTF-16",
+                                       "from UTF-16" };
+
+//+---------------------------------------------------------------------------
+//  Function:   OldIsValid, OldToUTF16, OldFromUTF16
+//
+//  Synopsis:   What String::IsValidUTF8 and UTF16ToUTF8 used to do, and
+//              the same kind of loop the other way, for comparison
+//----------------------------------------------------------------------------
+
+static bool OldIsValid (const String& str)
+{
+    ParseError error;
+    uintsys    u = 0;
+
+    StringIter iter (str);
+
+    while (iter.ParseUTF8Char (u, error))
+    {
+        // nothing
+    }
+
+    return !iter;
+}
+
+static String OldToUTF16 (const String& str)
+{
+    String str_Result (Preallocate (2 * str.Length()));
+
+    StringIter iter (str);
+    ParseError error;
+    uintsys    u = 0;
+
+    while (iter.ParseUTF8Char (u, error))
+    {
+        str_Result.AppendUTF16 (u);
+    }
+
+    return str_Result;
+}
+
+static String OldFromUTF16 (const String& str)
+{
+    String str_Result (Preallocate (str.Length()));
+
+    StringIter iter (str);
+    ParseError error;
+    uintsys    u = 0;
+
+    while (iter.ParseUTF16Char (u, error))
+    {
+        str_Result.AppendUTF8 (u);
+    }
+
+    return str_Result;
+}
+
+static uintsys Once (const String& str, Operation op, bool b_Old)
+{
+    switch (op)
+    {
+    case VALIDATE:
+        return b_Old ? OldIsValid (str) : str.IsValidUTF8();
+    case TO_UTF16:
+        return b_Old ? OldToUTF16 (str).Length()
+                     : UTF8ToUTF16 (str).Length();
+    default:
+        return b_Old ? OldFromUTF16 (str).Length()
+                     : UTF16ToUTF8 (str).Length();
+    }
+}
+
+static void Run (Benchmark& bench, const String& str_Text,
+                 const char* pz_Text, Operation op, int n_Engine)
+{
+    const String str_Input ((op == FROM_UTF16) ? UTF8ToUTF16 (str_Text)
+                                               : str_Text);
+
+    bool    b_Old   = (n_Engine == BYTE_SEARCH_UNKNOWN);
+    uintsys u_Runs  = BYTES_PER_RUN / str_Input.Length();
+    uintsys u_Total = 0;
+
+    if (b_Old)
+    {
+        u_Runs /= 8;    // much slower
+    }
+    else
+    {
+        ByteSearch::SetEngine ((ByteSearchEngine) n_Engine);
+    }
+
+    bench.Start();
+
+    for (uintsys u = 0; u < u_Runs; ++u)
+    {
+        u_Total += Once (str_Input, op, b_Old);
+    }
+
+    String str_Label (b_Old ? "old loop"
+                      : ByteSearch::EngineName ((ByteSearchEngine) n_Engine));
+
+    str_Label.Append (", ");
+    str_Label.Append (apz_Operation[op]);
+    str_Label.Append (", ");
+    str_Label.Append (pz_Text);
+
+    bench.Report (str_Label, double (u_Runs) * str_Input.Length() / 1e9,
+                  "GB");
+
+    if (u_Total == 0)
+    {
+        std::cout << "nothing done" << std::endl;
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   MakeText
+//
+//  Synopsis:   Makes about a megabyte of text in which one character in
+//              u_Every comes from the given range and the rest are ASCII
+//----------------------------------------------------------------------------
+
+static String MakeText (uintsys u_First, uintsys u_Count, uintsys u_Every)
+{
+    uint32 u_Seed = 12345;
+
+    String str;
+
+    while (str.Length() < 1024 * 1024)
+    {
+        u_Seed = u_Seed * 1103515245 + 12345;
+
+        uintsys u = u_Seed >> 8;
+
+        if ((u_Every != 0) && ((u % u_Every) == 0))
+        {
+            str.AppendUTF8 (u_First + (u >> 4) % u_Count);
+        }
+        else
+        {
+            str.Append ((char) (' ' + (u >> 4) % 95));
+        }
+    }
+
+    return str;
+}
+
+int main (int, char** argv)
+{
+    Benchmark bench (argv[0]);
+
+    const String astr_Text[] = {
+        MakeText (0,       0,       0),     // ASCII
+        MakeText (0xC0,    0x40,    8),     // accented Latin
+        MakeText (0x4E00,  0x5200,  1),     // CJK
+        MakeText (0x1F300, 0x300,   2)      // emoji between ASCII
+    };
+
+    const char* apz_Text[] = { "ASCII", "Latin", "CJK", "emoji" };
+
+    for (int n_Op = VALIDATE; n_Op <= FROM_UTF16; ++n_Op)
+    {
+        for (uintsys u = 0; u < 4; ++u)
+        {
+            for (int n_Engine = BYTE_SEARCH_UNKNOWN;
+                 n_Engine <= BYTE_SEARCH_AVX2; ++n_Engine)
+            {
+                Run (bench, astr_Text[u], apz_Text[u], (Operation) n_Op,
+                     n_Engine);
+            }
+        }
+    }
+
+    return 0;
+}
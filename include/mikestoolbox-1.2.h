@@ -48,7 +48,10 @@
 #include "mikestoolbox-1.2/Backup.class"
 #include "mikestoolbox-1.2/Exception.class"
 #include "mikestoolbox-1.2/Mutex.class"
+#include "mikestoolbox-1.2/Atomic.class"
 #include "mikestoolbox-1.2/Condition.class"
+#include "mikestoolbox-1.2/AdaptiveMutex.class"
+#include "mikestoolbox-1.2/ReadWriteMutex.class"
 #include "mikestoolbox-1.2/RefCount.class"
 #include "mikestoolbox-1.2/Unsigned.class"
 #include "mikestoolbox-1.2/Repeat.class"
@@ -56,6 +59,7 @@
 #include "mikestoolbox-1.2/Index.class"
 #include "mikestoolbox-1.2/PointerHolder.class"
 #include "mikestoolbox-1.2/DoubleFormat.class"
+#include "mikestoolbox-1.2/Number.class"
 #include "mikestoolbox-1.2/SmartNumber.class"
 #include "mikestoolbox-1.2/Shared.class"
 #include "mikestoolbox-1.2/ContainerType.class"
@@ -66,20 +70,37 @@
 #include "mikestoolbox-1.2/Hash.class"
 #include "mikestoolbox-1.2/CharRef.class"
 #include "mikestoolbox-1.2/PerlRegex.class"
+#include "mikestoolbox-1.2/ByteSearch.class"
+#include "mikestoolbox-1.2/AsciiCase.class"
+#include "mikestoolbox-1.2/ByteOrder.class"
 #include "mikestoolbox-1.2/Memory.class"
 #include "mikestoolbox-1.2/ParseError.class"
 #include "mikestoolbox-1.2/String.class"
 #include "mikestoolbox-1.2/StringIter.class"
+#include "mikestoolbox-1.2/StringView.class"
+#include "mikestoolbox-1.2/StringSplitIter.class"
+#include "mikestoolbox-1.2/Base64.class"
+#include "mikestoolbox-1.2/Hex.class"
+#include "mikestoolbox-1.2/Unicode.class"
 #include "mikestoolbox-1.2/WindowsString.class"
 #include "mikestoolbox-1.2/Timer.class"
+#include "mikestoolbox-1.2/MutexProfile.class"
 #include "mikestoolbox-1.2/StringException.class"
 #include "mikestoolbox-1.2/StringList.class"
+#include "mikestoolbox-1.2/MultiPattern.class"
+#include "mikestoolbox-1.2/StringBuilder.class"
 #include "mikestoolbox-1.2/Date.class"
 #include "mikestoolbox-1.2/DateParts.class"
 #include "mikestoolbox-1.2/LocalDate.class"
 #include "mikestoolbox-1.2/File.class"
+#include "mikestoolbox-1.2/FileReader.class"
+#include "mikestoolbox-1.2/FileWriter.class"
 #include "mikestoolbox-1.2/Thread.class"
 #include "mikestoolbox-1.2/SimpleThread.class"
+#include "mikestoolbox-1.2/Queue.class"
+#include "mikestoolbox-1.2/ThreadPool.class"
+#include "mikestoolbox-1.2/Future.class"
+#include "mikestoolbox-1.2/FileWatcher.class"
 #include "mikestoolbox-1.2/SocketAddress.class"
 #include "mikestoolbox-1.2/BerkeleySocket.class"
 #include "mikestoolbox-1.2/Socket.class"
@@ -91,7 +112,11 @@
 #include "mikestoolbox-1.2/Exception.inl"
 #include "mikestoolbox-1.2/Timer.inl"
 #include "mikestoolbox-1.2/Mutex.inl"
+#include "mikestoolbox-1.2/Atomic.inl"
 #include "mikestoolbox-1.2/Condition.inl"
+#include "mikestoolbox-1.2/AdaptiveMutex.inl"
+#include "mikestoolbox-1.2/ReadWriteMutex.inl"
+#include "mikestoolbox-1.2/Queue.inl"
 #include "mikestoolbox-1.2/RefCount.inl"
 #include "mikestoolbox-1.2/PointerHolder.inl"
 #include "mikestoolbox-1.2/Unsigned.inl"
@@ -112,15 +137,26 @@
 #include "mikestoolbox-1.2/ListSort.inl"
 #include "mikestoolbox-1.2/Map.inl"
 #include "mikestoolbox-1.2/Memory.inl"
+#include "mikestoolbox-1.2/ByteOrder.inl"
 #include "mikestoolbox-1.2/PerlRegex.inl"
 #include "mikestoolbox-1.2/CharRef.inl"
 #include "mikestoolbox-1.2/String.inl"
+#include "mikestoolbox-1.2/StringView.inl"
+#include "mikestoolbox-1.2/StringSplitIter.inl"
 #include "mikestoolbox-1.2/WindowsString.inl"
 #include "mikestoolbox-1.2/StringException.inl"
 #include "mikestoolbox-1.2/StringList.inl"
+#include "mikestoolbox-1.2/MultiPattern.inl"
+#include "mikestoolbox-1.2/StringBuilder.inl"
+#include "mikestoolbox-1.2/MutexProfile.inl"
 #include "mikestoolbox-1.2/File.inl"
+#include "mikestoolbox-1.2/FileReader.inl"
+#include "mikestoolbox-1.2/FileWriter.inl"
 #include "mikestoolbox-1.2/Date.inl"
 #include "mikestoolbox-1.2/Thread.inl"
+#include "mikestoolbox-1.2/ThreadPool.inl"
+#include "mikestoolbox-1.2/Future.inl"
+#include "mikestoolbox-1.2/FileWatcher.inl"
 #include "mikestoolbox-1.2/SocketAddress.inl"
 #include "mikestoolbox-1.2/BerkeleySocket.inl"
 #include "mikestoolbox-1.2/Socket.inl"
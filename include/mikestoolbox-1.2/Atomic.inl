@@ -0,0 +1,271 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       Atomic.inl
+//
+//  Synopsis:   Implementation of atomic operations
+//----------------------------------------------------------------------------
+
+namespace mikestoolbox {
+
+inline void CpuRelax ()
+{
+#if defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__ ("yield");
+#endif
+}
+
+inline void YieldThread ()
+{
+#ifdef PLATFORM_WINDOWS
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+inline void AtomicFence ()
+{
+#ifndef SINGLE_THREADED
+    __atomic_thread_fence (__ATOMIC_SEQ_CST);
+#endif
+}
+
+#ifdef SINGLE_THREADED
+
+template<typename T>
+inline Atomic<T>::Atomic (T t)
+    : t_ (t)
+{
+    // nothing
+}
+
+template<typename T>
+inline T Atomic<T>::Load () const
+{
+    return t_;
+}
+
+template<typename T>
+inline T Atomic<T>::LoadRelaxed () const
+{
+    return t_;
+}
+
+template<typename T>
+inline void Atomic<T>::Store (T t)
+{
+    t_ = t;
+}
+
+template<typename T>
+inline void Atomic<T>::StoreRelaxed (T t)
+{
+    t_ = t;
+}
+
+template<typename T>
+inline T Atomic<T>::Exchange (T t)
+{
+    T t_Old = t_;
+
+    t_ = t;
+
+    return t_Old;
+}
+
+template<typename T>
+inline bool Atomic<T>::CompareExchange (T& t_Expected, T t_Desired)
+{
+    if (t_ == t_Expected)
+    {
+        t_ = t_Desired;
+
+        return true;
+    }
+
+    t_Expected = t_;
+
+    return false;
+}
+
+template<typename T>
+inline T Atomic<T>::FetchAdd (T t)
+{
+    T t_Old = t_;
+
+    t_ += t;
+
+    return t_Old;
+}
+
+template<typename T>
+inline T Atomic<T>::FetchSub (T t)
+{
+    T t_Old = t_;
+
+    t_ -= t;
+
+    return t_Old;
+}
+
+#else
+
+template<typename T>
+inline Atomic<T>::Atomic (T t)
+    : t_ (t)
+{
+    __atomic_thread_fence (__ATOMIC_SEQ_CST);
+}
+
+template<typename T>
+inline T Atomic<T>::Load () const
+{
+    return __atomic_load_n (&t_, __ATOMIC_ACQUIRE);
+}
+
+template<typename T>
+inline T Atomic<T>::LoadRelaxed () const
+{
+    return __atomic_load_n (&t_, __ATOMIC_RELAXED);
+}
+
+template<typename T>
+inline void Atomic<T>::Store (T t)
+{
+    __atomic_store_n (&t_, t, __ATOMIC_RELEASE);
+}
+
+template<typename T>
+inline void Atomic<T>::StoreRelaxed (T t)
+{
+    __atomic_store_n (&t_, t, __ATOMIC_RELAXED);
+}
+
+template<typename T>
+inline T Atomic<T>::Exchange (T t)
+{
+    return __atomic_exchange_n (&t_, t, __ATOMIC_SEQ_CST);
+}
+
+template<typename T>
+inline bool Atomic<T>::CompareExchange (T& t_Expected, T t_Desired)
+{
+    return __atomic_compare_exchange_n (&t_, &t_Expected, t_Desired, false,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_ACQUIRE);
+}
+
+template<typename T>
+inline T Atomic<T>::FetchAdd (T t)
+{
+    return __atomic_fetch_add (&t_, t, __ATOMIC_SEQ_CST);
+}
+
+template<typename T>
+inline T Atomic<T>::FetchSub (T t)
+{
+    return __atomic_fetch_sub (&t_, t, __ATOMIC_SEQ_CST);
+}
+
+#endif // SINGLE_THREADED
+
+template<typename T>
+inline T Atomic<T>::Increment ()
+{
+    return FetchAdd (1) + 1;
+}
+
+template<typename T>
+inline T Atomic<T>::Decrement ()
+{
+    return FetchSub (1) - 1;
+}
+
+template<typename T>
+inline T* Atomic<T>::Address ()
+{
+    return &t_;
+}
+
+inline Backoff::Backoff ()
+    : u_Count_ (0)
+{
+    // nothing
+}
+
+inline void Backoff::Reset ()
+{
+    u_Count_ = 0;
+}
+
+inline void Backoff::Pause ()
+{
+#ifdef SINGLE_THREADED
+    throw Exception ("Backoff::Pause: no other thread can make progress");
+#else
+    const uintsys u_SpinLimit  = 64;
+    const uintsys u_YieldLimit = 128;
+
+    if (u_Count_ < u_SpinLimit)
+    {
+        for (uintsys u = 0; u < (1U << (u_Count_ / 16)); ++u)
+        {
+            CpuRelax();
+        }
+    }
+    else if (u_Count_ < u_YieldLimit)
+    {
+        YieldThread();
+    }
+    else
+    {
+        millisleep (1);
+
+        return;
+    }
+
+    ++u_Count_;
+#endif
+}
+
+} // namespace mikestoolbox
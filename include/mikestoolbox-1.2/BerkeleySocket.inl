@@ -68,6 +68,12 @@ inline SOCKET BerkeleySocket::GetHandle () const
     return h_Socket_;
 }
 
+inline intsys BerkeleySocket::Send (const StringBuilder& sb_Data,
+                                    intsys n_Flags)
+{
+    return Send (sb_Data.Pieces(), n_Flags);
+}
+
 inline BerkeleySocket::operator bool () const
 {
     return h_Socket_ != INVALID_SOCKET;
@@ -0,0 +1,138 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       ByteOrder.inl
+//
+//  Synopsis:   Implementation of the inline ByteOrder methods
+//----------------------------------------------------------------------------
+
+namespace mikestoolbox {
+
+inline bool ByteOrder::IsLittleEndian ()
+{
+#ifdef SYSTEM_BIG_ENDIAN
+    return false;
+#else
+    return true;
+#endif
+}
+
+inline uint16 ByteOrder::Swap16 (uint16 u)
+{
+    return (uint16) ((u >> 8) | (u << 8));
+}
+
+inline uint32 ByteOrder::Swap32 (uint32 u)
+{
+#ifdef __GNUC__
+    return __builtin_bswap32 (u);
+#else
+    return ((u & 0xFF000000) >> 24) |
+           ((u & 0x00FF0000) >>  8) |
+           ((u & 0x0000FF00) <<  8) |
+           ((u & 0x000000FF) << 24);
+#endif
+}
+
+inline uint64 ByteOrder::Swap64 (uint64 u)
+{
+#ifdef __GNUC__
+    return __builtin_bswap64 (u);
+#else
+    return ((uint64) Swap32 ((uint32) u) << 32) | Swap32 ((uint32) (u >> 32));
+#endif
+}
+
+inline uint16 ByteOrder::LoadUint16BE (const uchar* p)
+{
+    uint16 u = 0;
+
+    std::memcpy (&u, p, 2);
+
+    return IsLittleEndian() ? Swap16 (u) : u;
+}
+
+inline uint16 ByteOrder::LoadUint16LE (const uchar* p)
+{
+    uint16 u = 0;
+
+    std::memcpy (&u, p, 2);
+
+    return IsLittleEndian() ? u : Swap16 (u);
+}
+
+inline uint32 ByteOrder::LoadUint32BE (const uchar* p)
+{
+    uint32 u = 0;
+
+    std::memcpy (&u, p, 4);
+
+    return IsLittleEndian() ? Swap32 (u) : u;
+}
+
+inline uint32 ByteOrder::LoadUint32LE (const uchar* p)
+{
+    uint32 u = 0;
+
+    std::memcpy (&u, p, 4);
+
+    return IsLittleEndian() ? u : Swap32 (u);
+}
+
+inline uint64 ByteOrder::LoadUint64BE (const uchar* p)
+{
+    uint64 u = 0;
+
+    std::memcpy (&u, p, 8);
+
+    return IsLittleEndian() ? Swap64 (u) : u;
+}
+
+inline uint64 ByteOrder::LoadUint64LE (const uchar* p)
+{
+    uint64 u = 0;
+
+    std::memcpy (&u, p, 8);
+
+    return IsLittleEndian() ? u : Swap64 (u);
+}
+
+} // namespace mikestoolbox
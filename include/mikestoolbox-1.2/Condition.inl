@@ -68,6 +68,11 @@ inline void Condition::Signal ()
     b_Signaled_ = true;
 }
 
+inline void Condition::Broadcast ()
+{
+    // nothing
+}
+
 inline void Condition::Wait ()
 {
     if (b_Signaled_)
@@ -80,126 +85,223 @@ inline void Condition::Wait ()
     }
 }
 
+inline bool Condition::Wait (uintsys)
+{
+    bool b_Signaled = b_Signaled_;
+
+    b_Signaled_ = false;
+
+    return b_Signaled;
+}
+
+inline bool Condition::WaitUntil (const Date&)
+{
+    return Wait (0);
+}
+
+template<typename PREDICATE>
+inline void Condition::Wait (const Mutex&, PREDICATE predicate)
+{
+    if (!predicate())
+    {
+        throw Exception ("Condition::Wait: predicate can never become true");
+    }
+}
+
+template<typename PREDICATE>
+inline bool Condition::Wait (const Mutex&, PREDICATE predicate, uintsys)
+{
+    return predicate();
+}
+
+template<typename PREDICATE>
+inline bool Condition::WaitUntil (const Mutex&, PREDICATE predicate,
+                                  const Date&)
+{
+    return predicate();
+}
+
 #else
 
 //+---------------------------------------------------------------------------
-//  Synopsis:   UNIX implementation
+//  Synopsis:   multi-threaded implementation.  Block_ and Wake_ are
+//              implemented per platform.
 //----------------------------------------------------------------------------
 
-#ifdef PLATFORM_UNIX
-
 inline Condition::Condition ()
-    : mutex_      ()
-    , condition_  ()
-    , b_Signaled_ (false)
+    : b_Signaled_  (false)
+    , u_Sequence_  (0)
+    , u_Broadcast_ (0)
+    , u_Waiters_   (0)
+#if defined(PLATFORM_UNIX) && !defined(HAVE_FUTEX)
+    , mutex_       ()
+    , condition_   ()
+#endif
+#ifdef PLATFORM_WINDOWS
+    , h_Semaphore_ (0)
+#endif
 {
+#ifndef HAVE_FUTEX
+#ifdef PLATFORM_UNIX
     if (pthread_cond_init (&condition_, 0) != internal::gn_MultiThreadedZero)
     {
         throw Exception ("Condition: failed to initialize condition");
     }
+#endif
+
+#ifdef PLATFORM_WINDOWS
+    h_Semaphore_ = CreateSemaphore (0, 0, LONG_MAX, 0);
+
+    if (h_Semaphore_ == 0)
+    {
+        throw Exception ("Condition: failed to initialize condition");
+    }
+#endif
+#endif
 }
 
 inline Condition::~Condition ()
 {
+#ifndef HAVE_FUTEX
+#ifdef PLATFORM_UNIX
     pthread_cond_destroy (&condition_);
+#endif
+
+#ifdef PLATFORM_WINDOWS
+    CloseHandle (h_Semaphore_);
+#endif
+#endif
 }
 
-inline bool Condition::Test_ ()
+inline void Condition::Wait ()
 {
-    return b_Signaled_;
+    Wait_ (-1.0);
 }
 
-inline void Condition::Set_ ()
+inline bool Condition::Wait (uintsys u_TimeoutMilliseconds)
 {
-    b_Signaled_ = true;
+    if (u_TimeoutMilliseconds == WAIT_FOREVER)
+    {
+        return Wait_ (-1.0);
+    }
+
+    return Wait_ (u_TimeoutMilliseconds / 1000.0);
 }
 
-inline void Condition::Reset_ ()
+inline bool Condition::WaitUntil (const Date& date)
 {
-    b_Signaled_ = false;
+    return Wait_ (Maximum (date.SecondsMoreThan (Date::Now()), 0.0));
 }
 
-inline void Condition::Wait_ ()
+//+---------------------------------------------------------------------------
+//  Method:     Signal
+//
+//  Synopsis:   Sets the flag for the next Wait() and wakes one waiter.  The
+//              fence pairs with the one in Wait_ so that either we see the
+//              waiter or the waiter sees the flag.
+//----------------------------------------------------------------------------
+
+inline void Condition::Signal ()
 {
-    if (pthread_cond_wait (&condition_, &mutex_.mutex_) != 0)
+    b_Signaled_.Store (true);
+
+    AtomicFence();
+
+    if (u_Waiters_.Load() != 0)
     {
-        throw Exception ("Condition::Wait failed to wait for condition");
+        u_Sequence_.Increment();
+
+        Wake_ (false);
     }
 }
 
-inline void Condition::Signal_ ()
+inline void Condition::Broadcast ()
 {
-    if (pthread_cond_signal (&condition_) != 0)
+    u_Broadcast_.Increment();
+
+    AtomicFence();
+
+    if (u_Waiters_.Load() != 0)
     {
-        throw Exception ("Condition::Signal failed to signal condition");
+        u_Sequence_.Increment();
+
+        Wake_ (true);
     }
 }
 
-inline void Condition::Wait ()
+//+---------------------------------------------------------------------------
+//  Method:     Wait
+//
+//  Synopsis:   Waits with the caller's Mutex locked until predicate()
+//              returns true
+//
+//  Notes:      We register as a waiter and read the sequence number before
+//              testing the predicate, so a Signal() made after the state
+//              changes can never be missed -- even by a thread that
+//              changes the state without holding the Mutex.
+//----------------------------------------------------------------------------
+
+template<typename PREDICATE>
+inline bool Condition::Wait (const Mutex& mutex, PREDICATE predicate,
+                             uintsys u_TimeoutMilliseconds)
 {
-    MutexLocker locker (mutex_);
+    if (predicate())
+    {
+        return true;
+    }
+
+    bool   b_Forever = (u_TimeoutMilliseconds == WAIT_FOREVER);
+    double d_Seconds = b_Forever ? -1.0 : u_TimeoutMilliseconds / 1000.0;
+    Timer  timer;
 
     for (;;)
     {
-        if (Test_())
-        {
-            Reset_();
-
-            break;
-        }
+        u_Waiters_.Increment();
 
-        Wait_();
-    }
-}
+        uint32 u_Sequence = u_Sequence_.Load();
 
-inline void Condition::Signal ()
-{
-    MutexLocker locker (mutex_);
+        if (predicate())
+        {
+            u_Waiters_.Decrement();
 
-    Set_();
+            return true;
+        }
 
-    Signal_();
-}
+        mutex.Unlock();
 
-#endif // PLATFORM_UNIX
+        bool b_Woken = Block_ (u_Sequence, d_Seconds);
 
-//+---------------------------------------------------------------------------
-//  Synopsis:   Windows implementation
-//----------------------------------------------------------------------------
+        mutex.Lock();
 
-#ifdef PLATFORM_WINDOWS
+        u_Waiters_.Decrement();
 
-inline Condition::Condition ()
-    : condition_ (0)
-{
-    condition_ = CreateSemaphore (0, internal::gn_MultiThreadedZero, 1, 0);
+        if (!b_Forever)
+        {
+            d_Seconds -= timer.Elapsed();
 
-    if (condition_ == 0)
-    {
-        throw Exception ("Condition: failed to initialize condition");
+            if (!b_Woken || (d_Seconds <= 0.0))
+            {
+                return predicate();
+            }
+        }
     }
 }
 
-inline Condition::~Condition ()
+template<typename PREDICATE>
+inline void Condition::Wait (const Mutex& mutex, PREDICATE predicate)
 {
-    CloseHandle (condition_);
+    Wait (mutex, predicate, WAIT_FOREVER);
 }
 
-inline void Condition::Wait ()
+template<typename PREDICATE>
+inline bool Condition::WaitUntil (const Mutex& mutex, PREDICATE predicate,
+                                  const Date& date)
 {
-    if (WaitForSingleObject (condition_, INFINITE) != WAIT_OBJECT_0)
-    {
-        throw Exception ("Condition::Wait failed to wait for condition");
-    }
-}
+    double d_Seconds = Maximum (date.SecondsMoreThan (Date::Now()), 0.0);
 
-inline void Condition::Signal ()
-{
-    ReleaseSemaphore (condition_, 1, 0);
+    return Wait (mutex, predicate, (uintsys) (d_Seconds * 1000));
 }
 
-#endif // PLATFORM_WINDOWS
 #endif // SINGLE_THREADED
 
 } // namespace mikestoolbox
-
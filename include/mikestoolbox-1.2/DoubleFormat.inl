@@ -52,6 +52,7 @@ namespace mikestoolbox {
 
 inline DoubleFormat::DoubleFormat ()
     : n_Precision_  (n_DefaultPrecision_)
+    , b_Shortest_   (b_DefaultShortest_)
     , b_Scientific_ (b_DefaultScientific_)
     , b_Decimal_    (b_DefaultDecimal_)
 {
@@ -61,6 +62,12 @@ inline DoubleFormat::DoubleFormat ()
 inline void DoubleFormat::SetPrecision (int n_Precision)
 {
     n_Precision_ = n_Precision;
+    b_Shortest_  = false;
+}
+
+inline void DoubleFormat::UseShortestDigits ()
+{
+    b_Shortest_ = true;
 }
 
 inline void DoubleFormat::UseScientificNotation ()
@@ -84,6 +91,12 @@ inline void DoubleFormat::AutoSelectNotation ()
 inline void DoubleFormat::SetDefaultPrecision (int n_Precision)
 {
     n_DefaultPrecision_ = n_Precision;
+    b_DefaultShortest_  = false;
+}
+
+inline void DoubleFormat::SetDefaultShortest ()
+{
+    b_DefaultShortest_ = true;
 }
 
 inline void DoubleFormat::SetDefaultScientific ()
@@ -104,22 +117,5 @@ inline void DoubleFormat::SetDefaultAuto ()
     b_DefaultDecimal_    = false;
 }
 
-inline intsys DoubleFormat::Print (double d, char* ps_Buffer,
-                                   uintsys u_Capacity) const
-{
-    const char* pz_Format = "%1.*g";
-
-    if (b_Scientific_)
-    {
-        pz_Format = "%1.*e";
-    }
-    else if (b_Decimal_)
-    {
-        pz_Format = "%1.*f";
-    }
-
-    return snprintf (ps_Buffer, u_Capacity, pz_Format, n_Precision_, d);
-}
-
 } // namespace mikestoolbox
 
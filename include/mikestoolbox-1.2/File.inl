@@ -64,9 +64,14 @@ inline String File::Name () const
     return str_Name_;
 }
 
-inline bool File::Append (const StringList& strl_Lines, int n_Flags)
+inline bool File::Append (const StringBuilder& sb_Contents, int n_Flags)
 {
-    return Append (strl_Lines.Join(), n_Flags);
+    return Append (sb_Contents.Pieces(), n_Flags);
+}
+
+inline bool File::Write (const StringBuilder& sb_Contents, int n_Flags)
+{
+    return Write (sb_Contents.Pieces(), n_Flags);
 }
 
 inline bool File::Read (StringList& strl_Lines) const
@@ -85,11 +90,6 @@ inline bool File::Read (StringList& strl_Lines) const
     return true;
 }
 
-inline bool File::Write (const StringList& strl_Lines, int n_Flags)
-{
-    return Write (strl_Lines.Join(), n_Flags);
-}
-
 inline File operator+ (const File& dir, const File& file)
 {
     String str_File (file.Name());
@@ -0,0 +1,123 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       FileWatcher.inl
+//
+//  Synopsis:   Implementation of inline FileEvent and FileWatcher methods
+//----------------------------------------------------------------------------
+
+namespace mikestoolbox {
+
+inline FileEvent::FileEvent (const String& str_Path, uintsys u_Events)
+    : str_Path_ (str_Path)
+    , u_Events_ (u_Events)
+{
+    // nothing
+}
+
+inline FileEvent::FileEvent ()
+    : str_Path_ ()
+    , u_Events_ (0)
+{
+    // nothing
+}
+
+inline String FileEvent::Path () const
+{
+    return str_Path_;
+}
+
+inline uintsys FileEvent::Events () const
+{
+    return u_Events_;
+}
+
+inline bool FileEvent::IsCreate () const
+{
+    return (u_Events_ & FILE_EVENT_CREATE) != 0;
+}
+
+inline bool FileEvent::IsModify () const
+{
+    return (u_Events_ & FILE_EVENT_MODIFY) != 0;
+}
+
+inline bool FileEvent::IsDelete () const
+{
+    return (u_Events_ & FILE_EVENT_DELETE) != 0;
+}
+
+inline bool FileEvent::IsMove () const
+{
+    return (u_Events_ & FILE_EVENT_MOVE) != 0;
+}
+
+inline bool FileEvent::IsOverflow () const
+{
+    return (u_Events_ & FILE_EVENT_OVERFLOW) != 0;
+}
+
+inline bool FileEvent::operator== (const FileEvent& event) const
+{
+    return (u_Events_ == event.u_Events_) && (str_Path_ == event.str_Path_);
+}
+
+inline bool FileWatcher::IsOpen () const
+{
+    return (h_Notify_ >= 0);
+}
+
+inline void FileWatcher::SetCoalesceDelay (uintsys u_Milliseconds)
+{
+    u_CoalesceDelay_ = u_Milliseconds;
+}
+
+inline FileWatcherThread::FileWatcherThread (FileWatcher& watcher,
+                                             FileEventFunction func,
+                                             void* p_Arg)
+    : watcher_ (watcher)
+    , func_    (func)
+    , p_Arg_   (p_Arg)
+{
+    // nothing
+}
+
+} // namespace mikestoolbox
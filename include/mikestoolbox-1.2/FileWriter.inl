@@ -0,0 +1,113 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       FileWriter.inl
+//
+//  Synopsis:   Implementation of inline FileWriter methods
+//----------------------------------------------------------------------------
+
+namespace mikestoolbox {
+
+inline String FileWriter::Name () const
+{
+    return str_Name_;
+}
+
+inline bool FileWriter::IsOpen () const
+{
+    MutexLocker locker (mutex_Buffer_);
+
+    return b_IsOpen_;
+}
+
+inline bool FileWriter::Append (const StringList& strl_Lines)
+{
+    return Append (strl_Lines.Join());
+}
+
+inline bool FileWriter::Append (const StringBuilder& sb_Contents)
+{
+    return Append (sb_Contents.Pieces());
+}
+
+inline bool FileWriter::Flush ()
+{
+    MutexLocker locker (mutex_Write_);
+
+    return Flush_();
+}
+
+inline void FileWriter::SetBufferSize (uintsys u_NumBytes)
+{
+    MutexLocker locker (mutex_Buffer_);
+
+    u_BufferSize_ = u_NumBytes;
+}
+
+inline void FileWriter::SetFlushInterval (double d_Seconds)
+{
+    MutexLocker locker (mutex_Buffer_);
+
+    d_FlushInterval_ = d_Seconds;
+}
+
+inline uint64 FileWriter::BytesAppended () const
+{
+    MutexLocker locker (mutex_Buffer_);
+
+    return u_BytesAppended_;
+}
+
+inline uint64 FileWriter::BytesWritten () const
+{
+    MutexLocker locker (mutex_Write_);
+
+    return u_BytesWritten_;
+}
+
+inline uint64 FileWriter::BytesSynced () const
+{
+    MutexLocker locker (mutex_Sync_);
+
+    return u_BytesSynced_;
+}
+
+} // namespace mikestoolbox
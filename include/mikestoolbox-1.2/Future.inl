@@ -0,0 +1,732 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       Future.inl
+//
+//  Synopsis:   Implementation of Future and Promise classes
+//----------------------------------------------------------------------------
+
+namespace mikestoolbox {
+
+inline FutureContinuation::FutureContinuation (Task* p_Task,
+                                               Executor* p_Executor)
+    : p_Task_     (p_Task)
+    , p_Executor_ (p_Executor)
+{
+    // nothing
+}
+
+inline FutureContinuation::FutureContinuation ()
+    : p_Task_     (0)
+    , p_Executor_ (0)
+{
+    // nothing
+}
+
+inline FutureReady::FutureReady (const Atomic<bool>& b_Ready)
+    : b_Ready_ (b_Ready)
+{
+    // nothing
+}
+
+inline bool FutureReady::operator() () const
+{
+    return b_Ready_.Load();
+}
+
+//+---------------------------------------------------------------------------
+//  FutureState
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline FutureState<T>::FutureState ()
+    : mutex_              ()
+    , cond_Ready_         ()
+    , b_Ready_            (false)
+    , u_References_       (0)
+    , u_Promises_         (0)
+    , value_              ()
+    , b_Exception_        (false)
+    , str_Exception_      ()
+    , list_Continuations_ ()
+{
+    // nothing
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     ~FutureState
+//
+//  Synopsis:   Continuations hold a Future, so any left here were never
+//              going to run
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline FutureState<T>::~FutureState ()
+{
+    while (!list_Continuations_.IsEmpty())
+    {
+        delete list_Continuations_.Shift().p_Task_;
+    }
+}
+
+template<typename T>
+inline bool FutureState<T>::IsReady () const
+{
+    return b_Ready_.Load();
+}
+
+template<typename T>
+inline bool FutureState<T>::Wait (uintsys u_TimeoutMilliseconds) const
+{
+    if (IsReady())
+    {
+        return true;
+    }
+
+    MutexLocker locker (mutex_);
+
+    return cond_Ready_.Wait (mutex_, FutureReady (b_Ready_),
+                             u_TimeoutMilliseconds);
+}
+
+template<typename T>
+inline bool FutureState<T>::SetValue (const T& value)
+{
+    List<FutureContinuation> list_Continuations;
+
+    {
+        MutexLocker locker (mutex_);
+
+        if (IsReady())
+        {
+            return false;
+        }
+
+        value_ = value;
+
+        b_Ready_.Store (true);
+
+        list_Continuations.Swap (list_Continuations_);
+    }
+
+    Satisfied_ (list_Continuations);
+
+    return true;
+}
+
+template<typename T>
+inline bool FutureState<T>::SetException (const String& str_Message)
+{
+    List<FutureContinuation> list_Continuations;
+
+    {
+        MutexLocker locker (mutex_);
+
+        if (IsReady())
+        {
+            return false;
+        }
+
+        b_Exception_   = true;
+        str_Exception_ = str_Message;
+
+        b_Ready_.Store (true);
+
+        list_Continuations.Swap (list_Continuations_);
+    }
+
+    Satisfied_ (list_Continuations);
+
+    return true;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Satisfied_
+//
+//  Synopsis:   Wakes the waiters and hands each continuation to its
+//              executor once the result has been published
+//
+//  Notes:      Called without the mutex held, so that an InlineExecutor
+//              may run a continuation which waits on this state
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline void FutureState<T>::Satisfied_ (
+    List<FutureContinuation>& list_Continuations)
+{
+    cond_Ready_.Broadcast();
+
+    while (!list_Continuations.IsEmpty())
+    {
+        FutureContinuation continuation (list_Continuations.Shift());
+
+        continuation.p_Executor_->Execute (continuation.p_Task_);
+    }
+}
+
+template<typename T>
+inline void FutureState<T>::OnReady (Task* p_Task, Executor& executor)
+{
+    {
+        MutexLocker locker (mutex_);
+
+        if (!IsReady())
+        {
+            list_Continuations_.Append (FutureContinuation (p_Task,
+                                                            &executor));
+            return;
+        }
+    }
+
+    executor.Execute (p_Task);
+}
+
+template<typename T>
+inline const T& FutureState<T>::Value () const
+{
+    return value_;
+}
+
+template<typename T>
+inline bool FutureState<T>::ExceptionCaught () const
+{
+    return IsReady() && b_Exception_;
+}
+
+template<typename T>
+inline String FutureState<T>::ExceptionMessage () const
+{
+    return IsReady() ? str_Exception_ : String();
+}
+
+template<typename T>
+inline void FutureState<T>::AddReference ()
+{
+    u_References_.Increment();
+}
+
+template<typename T>
+inline void FutureState<T>::Release ()
+{
+    if (u_References_.Decrement() == 0)
+    {
+        delete this;
+    }
+}
+
+template<typename T>
+inline void FutureState<T>::AddPromise ()
+{
+    u_Promises_.Increment();
+}
+
+template<typename T>
+inline void FutureState<T>::ReleasePromise ()
+{
+    if ((u_Promises_.Decrement() == 0) && !IsReady())
+    {
+        SetException ("broken promise");
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Future
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline Future<T>::Future ()
+    : p_State_ (0)
+{
+    // nothing
+}
+
+template<typename T>
+inline Future<T>::Future (FutureState<T>* p_State)
+    : p_State_ (p_State)
+{
+    p_State_->AddReference();
+}
+
+template<typename T>
+inline Future<T>::Future (const Future& future)
+    : p_State_ (future.p_State_)
+{
+    if (p_State_ != 0)
+    {
+        p_State_->AddReference();
+    }
+}
+
+template<typename T>
+inline Future<T>::~Future ()
+{
+    if (p_State_ != 0)
+    {
+        p_State_->Release();
+    }
+}
+
+template<typename T>
+inline Future<T>& Future<T>::operator= (const Future& future)
+{
+    if (future.p_State_ != 0)
+    {
+        future.p_State_->AddReference();
+    }
+
+    if (p_State_ != 0)
+    {
+        p_State_->Release();
+    }
+
+    p_State_ = future.p_State_;
+
+    return *this;
+}
+
+template<typename T>
+inline bool Future<T>::IsValid () const
+{
+    return p_State_ != 0;
+}
+
+template<typename T>
+inline bool Future<T>::IsReady () const
+{
+    return (p_State_ != 0) && p_State_->IsReady();
+}
+
+template<typename T>
+inline void Future<T>::Wait () const
+{
+    Wait (WAIT_FOREVER);
+}
+
+template<typename T>
+inline bool Future<T>::Wait (uintsys u_TimeoutMilliseconds) const
+{
+    if (p_State_ == 0)
+    {
+        throw Exception ("Future::Wait: future has no promise");
+    }
+
+    return p_State_->Wait (u_TimeoutMilliseconds);
+}
+
+template<typename T>
+inline const T& Future<T>::Get () const
+{
+    Wait();
+
+    if (p_State_->ExceptionCaught())
+    {
+        throw StringException (p_State_->ExceptionMessage());
+    }
+
+    return p_State_->Value();
+}
+
+template<typename T>
+inline bool Future<T>::ExceptionCaught () const
+{
+    return (p_State_ != 0) && p_State_->ExceptionCaught();
+}
+
+template<typename T>
+inline String Future<T>::ExceptionMessage () const
+{
+    return (p_State_ != 0) ? p_State_->ExceptionMessage() : String();
+}
+
+template<typename T>
+inline void Future<T>::OnReady (Task* p_Task, Executor& executor) const
+{
+    if (p_State_ == 0)
+    {
+        delete p_Task;
+
+        throw Exception ("Future::OnReady: future has no promise");
+    }
+
+    p_State_->OnReady (p_Task, executor);
+}
+
+template<typename T>
+template<typename U>
+inline Future<U> Future<T>::Then (U (*func) (const T& value)) const
+{
+    return Then (func, InlineExecutor::Instance());
+}
+
+template<typename T>
+template<typename U>
+inline Future<U> Future<T>::Then (U (*func) (const T& value),
+                                  Executor& executor) const
+{
+    ThenTask<T,U>* p_Task = new ThenTask<T,U> (*this, func);
+    Future<U>      future (p_Task->Result());
+
+    OnReady (p_Task, executor);
+
+    return future;
+}
+
+//+---------------------------------------------------------------------------
+//  Promise
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline Promise<T>::Promise ()
+    : p_State_ (new FutureState<T>)
+{
+    p_State_->AddReference();
+    p_State_->AddPromise();
+}
+
+template<typename T>
+inline Promise<T>::Promise (const Promise& promise)
+    : p_State_ (promise.p_State_)
+{
+    p_State_->AddReference();
+    p_State_->AddPromise();
+}
+
+template<typename T>
+inline Promise<T>::~Promise ()
+{
+    p_State_->ReleasePromise();
+    p_State_->Release();
+}
+
+template<typename T>
+inline Promise<T>& Promise<T>::operator= (const Promise& promise)
+{
+    promise.p_State_->AddReference();
+    promise.p_State_->AddPromise();
+
+    p_State_->ReleasePromise();
+    p_State_->Release();
+
+    p_State_ = promise.p_State_;
+
+    return *this;
+}
+
+template<typename T>
+inline Future<T> Promise<T>::GetFuture () const
+{
+    return Future<T> (p_State_);
+}
+
+template<typename T>
+inline bool Promise<T>::IsSatisfied () const
+{
+    return p_State_->IsReady();
+}
+
+template<typename T>
+inline bool Promise<T>::SetValue (const T& value)
+{
+    return p_State_->SetValue (value);
+}
+
+template<typename T>
+inline bool Promise<T>::SetException (const String& str_Message)
+{
+    return p_State_->SetException (str_Message);
+}
+
+//+---------------------------------------------------------------------------
+//  ThenTask and AsyncTask catch exceptions the same way Thread and Task do
+//----------------------------------------------------------------------------
+
+template<typename T, typename U>
+inline ThenTask<T,U>::ThenTask (const Future<T>& future,
+                                U (*func) (const T& value))
+    : future_  (future)
+    , func_    (func)
+    , promise_ ()
+{
+    // nothing
+}
+
+template<typename T, typename U>
+inline Future<U> ThenTask<T,U>::Result () const
+{
+    return promise_.GetFuture();
+}
+
+template<typename T, typename U>
+inline void ThenTask<T,U>::Main_ ()
+{
+    if (future_.ExceptionCaught())
+    {
+        promise_.SetException (future_.ExceptionMessage());
+
+        return;
+    }
+
+    try
+    {
+        promise_.SetValue (func_ (future_.Get()));
+    }
+    catch (StringException& e)
+    {
+        promise_.SetException (e.StringMessage());
+    }
+    catch (Exception& e)
+    {
+        promise_.SetException (e.Message());
+    }
+    catch (...)
+    {
+        promise_.SetException (String());
+    }
+}
+
+template<typename T>
+inline AsyncTask<T>::AsyncTask (T (*func) (void* p_Arg), void* p_Arg)
+    : func_    (func)
+    , p_Arg_   (p_Arg)
+    , promise_ ()
+{
+    // nothing
+}
+
+template<typename T>
+inline Future<T> AsyncTask<T>::Result () const
+{
+    return promise_.GetFuture();
+}
+
+template<typename T>
+inline void AsyncTask<T>::Main_ ()
+{
+    try
+    {
+        promise_.SetValue (func_ (p_Arg_));
+    }
+    catch (StringException& e)
+    {
+        promise_.SetException (e.StringMessage());
+    }
+    catch (Exception& e)
+    {
+        promise_.SetException (e.Message());
+    }
+    catch (...)
+    {
+        promise_.SetException (String());
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  WhenAll and WhenAny
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline WhenAllJoin<T>::WhenAllJoin (const List<Future<T> >& list_Futures)
+    : list_Futures_ (list_Futures)
+    , u_Remaining_  (list_Futures.NumItems())
+    , promise_      ()
+{
+    // nothing
+}
+
+template<typename T>
+inline Future<List<T> > WhenAllJoin<T>::Result () const
+{
+    return promise_.GetFuture();
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Arrive
+//
+//  Synopsis:   Called as each Future becomes ready.  The last arrival
+//              collects the values, or fails with the first exception in
+//              list order.
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline void WhenAllJoin<T>::Arrive (uintsys)
+{
+    if (u_Remaining_.Decrement() != 0)
+    {
+        return;
+    }
+
+    List<T> list_Values;
+
+    for (ListIter<Future<T> > iter (list_Futures_); iter; ++iter)
+    {
+        if (iter->ExceptionCaught())
+        {
+            promise_.SetException (iter->ExceptionMessage());
+
+            break;
+        }
+
+        list_Values.Append (iter->Get());
+    }
+
+    promise_.SetValue (list_Values);
+
+    delete this;
+}
+
+inline WhenAnyJoin::WhenAnyJoin (uintsys u_Count)
+    : u_Remaining_ (u_Count)
+    , promise_     ()
+{
+    // nothing
+}
+
+inline Future<uintsys> WhenAnyJoin::Result () const
+{
+    return promise_.GetFuture();
+}
+
+inline void WhenAnyJoin::Arrive (uintsys u_Index)
+{
+    promise_.SetValue (u_Index);
+
+    if (u_Remaining_.Decrement() == 0)
+    {
+        delete this;
+    }
+}
+
+template<typename JOIN>
+inline JoinTask<JOIN>::JoinTask (JOIN* p_Join, uintsys u_Index)
+    : p_Join_  (p_Join)
+    , u_Index_ (u_Index)
+{
+    // nothing
+}
+
+template<typename JOIN>
+inline void JoinTask<JOIN>::Main_ ()
+{
+    p_Join_->Arrive (u_Index_);
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   Async
+//
+//  Synopsis:   Runs func(p_Arg) on an executor and returns a Future for
+//              its result
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline Future<T> Async (T (*func) (void* p_Arg), void* p_Arg,
+                        Executor& executor)
+{
+    AsyncTask<T>* p_Task = new AsyncTask<T> (func, p_Arg);
+    Future<T>     future (p_Task->Result());
+
+    executor.Execute (p_Task);
+
+    return future;
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   WhenAll
+//
+//  Synopsis:   Returns a Future for the values of every Future in the
+//              list, in order.  It is ready once all of them are.
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline Future<List<T> > WhenAll (const List<Future<T> >& list_Futures)
+{
+    if (list_Futures.IsEmpty())
+    {
+        Promise<List<T> > promise;
+
+        promise.SetValue (List<T>());
+
+        return promise.GetFuture();
+    }
+
+    WhenAllJoin<T>*  p_Join = new WhenAllJoin<T> (list_Futures);
+    Future<List<T> > future (p_Join->Result());
+
+    uintsys u_Index = 0;
+
+    for (ListIter<Future<T> > iter (list_Futures); iter; ++iter, ++u_Index)
+    {
+        iter->OnReady (new JoinTask<WhenAllJoin<T> > (p_Join, u_Index),
+                       InlineExecutor::Instance());
+    }
+
+    return future;
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   WhenAny
+//
+//  Synopsis:   Returns a Future for the index of the first Future in the
+//              list to become ready, whether with a value or an exception
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline Future<uintsys> WhenAny (const List<Future<T> >& list_Futures)
+{
+    if (list_Futures.IsEmpty())
+    {
+        throw Exception ("WhenAny: the list of futures is empty");
+    }
+
+    WhenAnyJoin*    p_Join = new WhenAnyJoin (list_Futures.NumItems());
+    Future<uintsys> future (p_Join->Result());
+
+    uintsys u_Index = 0;
+
+    for (ListIter<Future<T> > iter (list_Futures); iter; ++iter, ++u_Index)
+    {
+        iter->OnReady (new JoinTask<WhenAnyJoin> (p_Join, u_Index),
+                       InlineExecutor::Instance());
+    }
+
+    return future;
+}
+
+} // namespace mikestoolbox
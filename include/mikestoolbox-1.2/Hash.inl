@@ -83,11 +83,13 @@ inline uint32 FowlerNollVoHash32::ComputeHash (const T& t)
     return ComputeHash ((const uchar*)&t, sizeof(T));
 }
 
-inline uint32 FowlerNollVoHash32::ComputeHash (const String& str)
+// Strings and views hash their characters folded to lower case, seeded
+// with the length, so a view hashes the same as a String of its bytes
+
+inline uint32 FowlerNollVoHash32::HashChars_ (const uchar* ps_Chars,
+                                              uintsys u_NumChars)
 {
-    const uchar* ps_Chars   = str.PointerToFirstByte();
-    uintsys      u_NumChars = str.Length();
-    uint32       u_Hash     = ComputeHash (u_NumChars);
+    uint32 u_Hash = ComputeHash (u_NumChars);
 
     while (u_NumChars)
     {
@@ -101,6 +103,16 @@ inline uint32 FowlerNollVoHash32::ComputeHash (const String& str)
     return u_Hash;
 }
 
+inline uint32 FowlerNollVoHash32::ComputeHash (const String& str)
+{
+    return HashChars_ (str.PointerToFirstByte(), str.Length());
+}
+
+inline uint32 FowlerNollVoHash32::ComputeHash (const StringView& view)
+{
+    return HashChars_ (view.PointerToFirstByte(), view.Length());
+}
+
 inline uint32 FowlerNollVoHash32::ComputeHash (const char* pz)
 {
     String str (pz);
@@ -108,6 +120,54 @@ inline uint32 FowlerNollVoHash32::ComputeHash (const char* pz)
     return ComputeHash (str);
 }
 
+inline uint32 NoCaseHash::ComputeHash (const String& str)
+{
+    return AsciiCase::Hash (str.PointerToFirstByte(), str.Length());
+}
+
+inline uint32 NoCaseHash::ComputeHash (const StringView& view)
+{
+    return AsciiCase::Hash (view.PointerToFirstByte(), view.Length());
+}
+
+inline uint32 NoCaseHash::ComputeHash (const char* pz)
+{
+    return AsciiCase::Hash ((const uchar*)pz, std::strlen (pz));
+}
+
+inline bool NoCaseHash::Equal (const String& str1, const String& str2)
+{
+    return (str1.Length() == str2.Length()) &&
+           (AsciiCase::Compare (str1.PointerToFirstByte(),
+                                str2.PointerToFirstByte(),
+                                str1.Length()) == 0);
+}
+
+inline bool NoCaseHash::Equal (const StringView& view1,
+                               const StringView& view2)
+{
+    return (view1.Compare (view2, false) == 0);
+}
+
+template<typename H>
+template<typename T>
+inline bool HashKeyCompare<H>::Equal (const T& t1, const T& t2)
+{
+    return t1 == t2;
+}
+
+inline bool HashKeyCompare<NoCaseHash>::Equal (const String& str1,
+                                               const String& str2)
+{
+    return NoCaseHash::Equal (str1, str2);
+}
+
+inline bool HashKeyCompare<NoCaseHash>::Equal (const StringView& view1,
+                                               const StringView& view2)
+{
+    return NoCaseHash::Equal (view1, view2);
+}
+
 template<typename K, typename V, typename H>
 inline HashItem<K,V,H>::HashItem (const HashItem<K,V,H>& item)
     : key_       (item.key_)
@@ -177,6 +237,25 @@ inline HashStorage<K,V,H>::HashStorage ()
     // nothing
 }
 
+template<typename K, typename V, typename H>
+inline HashStorage<K,V,H>::HashStorage (AlwaysShared)
+    : SharedData    (AlwaysShared())
+    , pp_Buckets_   (0)
+    , u_NumBuckets_ (0)
+    , u_HashMask_   (0)
+    , u_NumItems_   (0)
+{
+    // nothing
+}
+
+template<typename K, typename V, typename H>
+inline HashStorage<K,V,H>* HashStorage<K,V,H>::Undef ()
+{
+    static Storage undef_ ((AlwaysShared()));
+
+    return &undef_;
+}
+
 template<typename K, typename V, typename H>
 void HashStorage<K,V,H>::Destroy_ ()
 {
@@ -268,6 +347,42 @@ inline Hash<K,V,H>::Hash ()
     // nothing
 }
 
+template<typename K, typename V, typename H>
+inline Hash<K,V,H>::Hash (const Hash<K,V,H>& hash)
+    : SharedResource (hash)
+{
+    // nothing
+}
+
+#ifdef HAVE_MOVE_SEMANTICS
+template<typename K, typename V, typename H>
+inline Hash<K,V,H>::Hash (Hash<K,V,H>&& hash) noexcept
+    : SharedResource (RESOURCE_COPY_ON_WRITE, Storage::Undef())
+{
+    Swap (hash);    // leaves the shared empty hash behind, no allocation
+}
+#endif
+
+template<typename K, typename V, typename H>
+inline Hash<K,V,H>& Hash<K,V,H>::operator= (const Hash<K,V,H>& hash)
+{
+    SharedResource::operator= (hash);
+
+    return *this;
+}
+
+#ifdef HAVE_MOVE_SEMANTICS
+template<typename K, typename V, typename H>
+inline Hash<K,V,H>& Hash<K,V,H>::operator= (Hash<K,V,H>&& hash) noexcept
+{
+    Hash<K,V,H> hash_Old (std::move (hash));
+
+    Swap (hash_Old);
+
+    return *this;
+}
+#endif
+
 template<typename K, typename V, typename H>
 inline const HashStorage<K,V,H>* Hash<K,V,H>::ViewData () const
 {
@@ -452,7 +567,8 @@ const HashItem<K,V,H>* Hash<K,V,H>::FindItem_ (const K& key) const
 
     while (p_Item != 0)
     {
-        if ((p_Item->KeyHash() == u_Hash) && (p_Item->Key() == key))
+        if ((p_Item->KeyHash() == u_Hash) &&
+            HashKeyCompare<H>::Equal (p_Item->Key(), key))
         {
             break;
         }
@@ -484,7 +600,8 @@ HashItem<K,V,H>* Hash<K,V,H>::FindItem_ (const K& key)
 
     while (p_Item)
     {
-        if ((p_Item->KeyHash() == u_Hash) && (p_Item->Key() == key))
+        if ((p_Item->KeyHash() == u_Hash) &&
+            HashKeyCompare<H>::Equal (p_Item->Key(), key))
         {
             break;
         }
@@ -517,7 +634,8 @@ HashItem<K,V,H>* Hash<K,V,H>::CreateItem_ (const K& key, const V& value,
 
     while (p_Item)
     {
-        if ((p_Item->KeyHash() == u_Hash) && (p_Item->Key() == key))
+        if ((p_Item->KeyHash() == u_Hash) &&
+            HashKeyCompare<H>::Equal (p_Item->Key(), key))
         {
             p_Item->SetValue_ (value);
 
@@ -603,6 +721,16 @@ inline void Hash<K,V,H>::Set (const K& key, const V& value)
     CreateItem_ (key, value);
 }
 
+#ifdef HAVE_MOVE_SEMANTICS
+template<typename K, typename V, typename H>
+inline void Hash<K,V,H>::Set (const K& key, V&& value)
+{
+    // insert an empty value, then move the real one into place
+
+    CreateItem_ (key, V())->value_ = std::move (value);
+}
+#endif
+
 template<typename K, typename V, typename H>
 inline const V Hash<K,V,H>::Get (const K& key, const V& v_Default)
 {
@@ -744,7 +872,8 @@ bool Hash<K,V,H>::Delete (const K& key)
 
     while (p_Item != 0)
     {
-        if ((p_Item->KeyHash() == u_Hash) && (p_Item->Key() == key))
+        if ((p_Item->KeyHash() == u_Hash) &&
+            HashKeyCompare<H>::Equal (p_Item->Key(), key))
         {
             if (p_Prev == 0)
             {
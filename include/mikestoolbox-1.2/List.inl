@@ -59,6 +59,22 @@ inline List<T>::List ()
     // nothing
 }
 
+template<typename T>
+inline List<T>::List (const List<T>& list)
+    : SharedResource (list)
+{
+    // nothing
+}
+
+#ifdef HAVE_MOVE_SEMANTICS
+template<typename T>
+inline List<T>::List (List<T>&& list) noexcept
+    : SharedResource (RESOURCE_COPY_ON_WRITE, Data::Undef())
+{
+    Swap (list);    // leaves the shared empty list behind, no refcounting
+}
+#endif
+
 template<typename T>
 inline List<T>::List (Data* p_Data)
     : SharedResource (RESOURCE_COPY_ON_WRITE, p_Data)
@@ -99,6 +115,18 @@ inline List<T>& List<T>::operator= (const List<T>& l)
     return *this;
 }
 
+#ifdef HAVE_MOVE_SEMANTICS
+template<typename T>
+inline List<T>& List<T>::operator= (List<T>&& list) noexcept
+{
+    ListType list_Old (std::move (list));
+
+    Swap (list_Old);
+
+    return *this;
+}
+#endif
+
 template<typename T>
 inline List<T>& List<T>::operator= (const T& item)
 {
@@ -186,6 +214,16 @@ inline List<T>& List<T>::Append (const T& item)
     return *this;
 }
 
+#ifdef HAVE_MOVE_SEMANTICS
+template<typename T>
+inline List<T>& List<T>::Append (T&& item)
+{
+    ModifyData()->Append (std::move (item));
+
+    return *this;
+}
+#endif
+
 template<typename T>
 template<typename CONTAINER>
 inline List<T>& List<T>::Append (const CONTAINER& c)
@@ -97,6 +97,21 @@ inline ListItem<T>* ListAllocator<T>::CreateItem (const T& item)
     return p_Item;
 }
 
+#ifdef HAVE_MOVE_SEMANTICS
+template<typename T>
+inline ListItem<T>* ListAllocator<T>::CreateItem (T&& item)
+{
+    Item* p_Item = new (std::nothrow) Item (std::move (item));
+
+    if (p_Item == 0)
+    {
+        throw Exception ("List: Out of memory");
+    }
+
+    return p_Item;
+}
+#endif
+
 template<typename T>
 inline ListItem<T>* ListAllocator<T>::CreateItem (const Item* p_Copy)
 {
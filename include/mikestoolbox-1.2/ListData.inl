@@ -345,6 +345,14 @@ inline void ListData<T>::Append (const T& item)
     ++u_NumItems_;
 }
 
+#ifdef HAVE_MOVE_SEMANTICS
+template<typename T>
+inline void ListData<T>::Append (T&& item)
+{
+    Append (GetAllocator()->CreateItem (std::move (item)), 1);
+}
+#endif
+
 template<typename T>
 inline void ListData<T>::Append (const T& item, Repeat repeat)
 {
@@ -66,6 +66,18 @@ inline ListItem<T>::ListItem (const T& item)
     // nothing
 }
 
+#ifdef HAVE_MOVE_SEMANTICS
+template<typename T>
+inline ListItem<T>::ListItem (T&& item)
+    : t_      (std::move (item))
+    , p_Next_ (this)
+    , p_Prev_ (this)
+    , u_SortPos_ (0)
+{
+    // nothing
+}
+#endif
+
 template<typename T>
 template<typename U>
 inline ListItem<T>::ListItem (const U& item)
@@ -735,12 +735,29 @@ inline MapStorage<K,V,CMP>::MapStorage ()
     // nothing
 }
 
+template<typename K, typename V, class CMP>
+inline MapStorage<K,V,CMP>::MapStorage (AlwaysShared)
+    : SharedData  (AlwaysShared())
+    , p_Root_     (0)
+    , u_NumItems_ (0)
+{
+    // nothing
+}
+
 template<typename K, typename V, class CMP>
 inline MapStorage<K,V,CMP>::~MapStorage ()
 {
     delete p_Root_;
 }
 
+template<typename K, typename V, class CMP>
+inline MapStorage<K,V,CMP>* MapStorage<K,V,CMP>::Undef ()
+{
+    static Storage undef_ ((AlwaysShared()));
+
+    return &undef_;
+}
+
 template<typename K, typename V, class CMP>
 StringList MapStorage<K,V,CMP>::Debug () const
 {
@@ -781,6 +798,42 @@ inline Map<K,V,CMP>::Map ()
     // nothing
 }
 
+template<typename K, typename V, class CMP>
+inline Map<K,V,CMP>::Map (const Map<K,V,CMP>& map)
+    : SharedResource (map)
+{
+    // nothing
+}
+
+#ifdef HAVE_MOVE_SEMANTICS
+template<typename K, typename V, class CMP>
+inline Map<K,V,CMP>::Map (Map<K,V,CMP>&& map) noexcept
+    : SharedResource (RESOURCE_COPY_ON_WRITE, Storage::Undef())
+{
+    Swap (map);     // leaves the shared empty map behind, no allocation
+}
+#endif
+
+template<typename K, typename V, class CMP>
+inline Map<K,V,CMP>& Map<K,V,CMP>::operator= (const Map<K,V,CMP>& map)
+{
+    SharedResource::operator= (map);
+
+    return *this;
+}
+
+#ifdef HAVE_MOVE_SEMANTICS
+template<typename K, typename V, class CMP>
+inline Map<K,V,CMP>& Map<K,V,CMP>::operator= (Map<K,V,CMP>&& map) noexcept
+{
+    Map<K,V,CMP> map_Old (std::move (map));
+
+    Swap (map_Old);
+
+    return *this;
+}
+#endif
+
 template<typename K, typename V, class CMP>
 inline const MapStorage<K,V,CMP>* Map<K,V,CMP>::ViewData () const
 {
@@ -1305,6 +1358,16 @@ inline void Map<K,V,CMP>::Set (const K& key, const V& value)
     CreateItem_ (key, value);
 }
 
+#ifdef HAVE_MOVE_SEMANTICS
+template<typename K, typename V, class CMP>
+inline void Map<K,V,CMP>::Set (const K& key, V&& value)
+{
+    // insert an empty value, then move the real one into place
+
+    CreateItem_ (key, V())->value_ = std::move (value);
+}
+#endif
+
 template<typename K, typename V, class CMP>
 inline void Map<K,V,CMP>::Swap (Map<K,V,CMP>& map)
 {
@@ -46,6 +46,61 @@
 
 namespace mikestoolbox {
 
+//+---------------------------------------------------------------------------
+//  Class:      MemoryCacheStats
+//----------------------------------------------------------------------------
+
+inline MemoryCacheStats::MemoryCacheStats ()
+    : u_Hits_        (0)
+    , u_Misses_      (0)
+    , u_Recycled_    (0)
+    , u_Released_    (0)
+    , u_BytesCached_ (0)
+{
+    // nothing
+}
+
+inline uint64 MemoryCacheStats::Hits () const
+{
+    return u_Hits_;
+}
+
+inline uint64 MemoryCacheStats::Misses () const
+{
+    return u_Misses_;
+}
+
+inline uint64 MemoryCacheStats::Recycled () const
+{
+    return u_Recycled_;
+}
+
+inline uint64 MemoryCacheStats::Released () const
+{
+    return u_Released_;
+}
+
+inline uint64 MemoryCacheStats::BytesCached () const
+{
+    return u_BytesCached_;
+}
+
+inline double MemoryCacheStats::HitRate () const
+{
+    uint64 u_Total = u_Hits_ + u_Misses_;
+
+    return (u_Total == 0) ? 0.0 : double (u_Hits_) / double (u_Total);
+}
+
+inline void MemoryCacheStats::Add (const MemoryCacheStats& stats)
+{
+    u_Hits_        += stats.u_Hits_;
+    u_Misses_      += stats.u_Misses_;
+    u_Recycled_    += stats.u_Recycled_;
+    u_Released_    += stats.u_Released_;
+    u_BytesCached_ += stats.u_BytesCached_;
+}
+
 //+---------------------------------------------------------------------------
 //  Class:      HeapMemory
 //----------------------------------------------------------------------------
@@ -75,6 +130,7 @@ inline HeapMemory::HeapMemory (const HeapMemory& mem)
     , u_Offset_   (0)
     , u_Length_   (0)
     , u_Capacity_ (0)
+    , b_Secure_   (b_DefaultSecure_ || mem.b_Secure_)
 {
     uintsys u_Length = mem.Length();
 
@@ -90,6 +146,7 @@ inline HeapMemory::HeapMemory (const MEMORY& mem)
     , u_Offset_   (0)
     , u_Length_   (0)
     , u_Capacity_ (0)
+    , b_Secure_   (b_DefaultSecure_)
 {
     uintsys u_Length = mem.Length();
 
@@ -104,6 +161,7 @@ inline HeapMemory::HeapMemory (const char* pz)
     , u_Offset_   (0)
     , u_Length_   (0)
     , u_Capacity_ (0)
+    , b_Secure_   (b_DefaultSecure_)
 {
     if (pz != 0)
     {
@@ -121,6 +179,7 @@ inline HeapMemory::HeapMemory (Preallocate amount)
     , u_Offset_   (0)
     , u_Length_   (0)
     , u_Capacity_ (0)
+    , b_Secure_   (b_DefaultSecure_)
 {
     Reserve (amount);
 }
@@ -130,6 +189,7 @@ inline HeapMemory::HeapMemory ()
     , u_Offset_   (0)
     , u_Length_   (0)
     , u_Capacity_ (0)
+    , b_Secure_   (b_DefaultSecure_)
 {
     // nothing
 }
@@ -138,11 +198,7 @@ inline HeapMemory::~HeapMemory ()
 {
     if (p_Memory_ != 0)
     {
-        // destroy string contents
-
-        ZeroMemory (p_Memory_, u_Capacity_);
-
-        delete [] p_Memory_;
+        Free_ (p_Memory_, u_Capacity_, b_Secure_);
     }
 }
 
@@ -183,10 +239,15 @@ inline void HeapMemory::Clear ()
 {
     if (p_Memory_ != 0)
     {
-        ZeroMemory (p_Memory_, u_Offset_ + u_Length_);
+        if (b_Secure_)
+        {
+            WipeMemory (p_Memory_, u_Offset_ + u_Length_);
+        }
 
         u_Offset_ = 0;
         u_Length_ = 0;
+
+        NullTerminate_();
     }
 }
 
@@ -194,7 +255,7 @@ inline void HeapMemory::Destroy ()
 {
     if (p_Memory_ != 0)
     {
-        ZeroMemory (p_Memory_, u_Capacity_);
+        WipeMemory (p_Memory_, u_Capacity_);
 
         u_Offset_ = 0;
         u_Length_ = 0;
@@ -354,16 +415,34 @@ inline void HeapMemory::Swap (HeapMemory& mem)
     uintsys u_Offset   = u_Offset_;
     uintsys u_Length   = u_Length_;
     uintsys u_Capacity = u_Capacity_;
+    bool    b_Secure   = b_Secure_;
 
     p_Memory_   = mem.p_Memory_;
     u_Offset_   = mem.u_Offset_;
     u_Length_   = mem.u_Length_;
     u_Capacity_ = mem.u_Capacity_;
+    b_Secure_   = mem.b_Secure_;
 
     mem.p_Memory_   = p_Memory;
     mem.u_Offset_   = u_Offset;
     mem.u_Length_   = u_Length;
     mem.u_Capacity_ = u_Capacity;
+    mem.b_Secure_   = b_Secure;
+}
+
+inline bool HeapMemory::IsSecure () const
+{
+    return b_Secure_;
+}
+
+inline void HeapMemory::SetSecure (bool b_Secure)
+{
+    b_Secure_ = b_Secure;
+}
+
+inline void HeapMemory::SetDefaultSecure (bool b_Secure)
+{
+    b_DefaultSecure_ = b_Secure;
 }
 
 inline HeapMemory& HeapMemory::operator= (const HeapMemory& mem)
@@ -373,6 +452,8 @@ inline HeapMemory& HeapMemory::operator= (const HeapMemory& mem)
         return *this;
     }
 
+    b_Secure_ = b_Secure_ || mem.b_Secure_;
+
     uintsys u_NewLength = mem.Length();
 
     if (u_NewLength == 0)
@@ -583,6 +664,15 @@ inline SharedMemory<MEMORY>::SharedMemory (const SharedMemory& mem)
     IncrementRefs_();
 }
 
+#ifdef HAVE_MOVE_SEMANTICS
+template<class MEMORY>
+inline SharedMemory<MEMORY>::SharedMemory (SharedMemory&& mem) noexcept
+    : p_Data_ (mem.p_Data_)
+{
+    mem.p_Data_ = &data_Empty_;     // no reference counting needed
+}
+#endif
+
 template<class MEMORY>
 template<class MEMORY2>
 inline SharedMemory<MEMORY>::SharedMemory (const MEMORY2& mem)
@@ -625,6 +715,11 @@ inline SharedMemory<MEMORY>::SharedMemory ()
 template<class MEMORY>
 inline SharedMemory<MEMORY>::~SharedMemory ()
 {
+    if (p_Data_ == &data_Empty_)
+    {
+        return;     // left behind by a move, or never allocated
+    }
+
     if ((References_() == 1) || (DecrementRefs_() == 0))
     {
         delete p_Data_;
@@ -682,6 +777,18 @@ inline uchar* SharedMemory<MEMORY>::EditInPlace ()
     return ModifyData_()->mem_.EditInPlace();
 }
 
+template<class MEMORY>
+inline bool SharedMemory<MEMORY>::IsSecure () const
+{
+    return p_Data_->mem_.IsSecure();
+}
+
+template<class MEMORY>
+inline void SharedMemory<MEMORY>::SetSecure (bool b_Secure)
+{
+    ModifyData_()->mem_.SetSecure (b_Secure);
+}
+
 template<class MEMORY>
 inline void
     SharedMemory<MEMORY>::Append (const uchar* ps_Data, uintsys u_AppendLength)
@@ -719,7 +826,14 @@ inline void SharedMemory<MEMORY>::Clear ()
     }
     else
     {
+        bool b_Secure = IsSecure();
+
         p_Data_ = &data_Empty_;
+
+        if (b_Secure)
+        {
+            SetSecure();    // the shared empty block is not secure
+        }
     }
 }
 
@@ -816,11 +930,44 @@ inline SharedMemory<MEMORY>&
 {
     SharedMemory<MEMORY> mem_New (mem);
 
+    if (IsSecure() && !mem_New.IsSecure())
+    {
+        mem_New.SetSecure();    // unshares, so that our copy gets wiped
+    }
+
     Swap (mem_New);
 
     return *this;
 }
 
+#ifdef HAVE_MOVE_SEMANTICS
+template<class MEMORY>
+inline SharedMemory<MEMORY>&
+    SharedMemory<MEMORY>::operator= (SharedMemory<MEMORY>&& mem) noexcept
+{
+    // a block of its own can simply be marked secure, but a shared one
+    // must be copied (and running out of memory here terminates)
+
+    if (IsSecure() && !mem.IsSecure())
+    {
+        if (mem.References_() == 1)
+        {
+            mem.p_Data_->mem_.SetSecure();
+        }
+        else
+        {
+            return operator= (static_cast<const SharedMemory&> (mem));
+        }
+    }
+
+    SharedMemory<MEMORY> mem_Old (std::move (mem));
+
+    Swap (mem_Old);     // our old block is released with mem_Old
+
+    return *this;
+}
+#endif
+
 template<class MEMORY>
 template<class MEMORY2>
 inline SharedMemory<MEMORY>&
@@ -828,6 +975,11 @@ inline SharedMemory<MEMORY>&
 {
     SharedMemory<MEMORY> mem_New (mem);
 
+    if (IsSecure() && !mem_New.IsSecure())
+    {
+        mem_New.SetSecure();
+    }
+
     Swap (mem_New);
 
     return *this;
@@ -838,6 +990,11 @@ inline SharedMemory<MEMORY>& SharedMemory<MEMORY>::operator= (const char* pz)
 {
     SharedMemory<MEMORY> mem_New (pz);
 
+    if (IsSecure() && !mem_New.IsSecure())
+    {
+        mem_New.SetSecure();
+    }
+
     Swap (mem_New);
 
     return *this;
@@ -947,6 +1104,8 @@ void SharedMemory<MEMORY>::Reserve (uintsys u_NumBytes)
 
     mem_New.p_Data_ = p_NewData;
 
+    p_NewData->mem_.SetSecure (IsSecure());
+
     p_NewData->mem_.Reserve (u_NumBytes);
 
     uintsys u_Length = Length();
@@ -978,6 +1137,8 @@ uchar* SharedMemory<MEMORY>::Expand (uintsys u_NumCharsBefore,
 
     mem_New.p_Data_ = p_NewData;
 
+    p_NewData->mem_.SetSecure (IsSecure());
+
     uintsys u_OriginalLength = Length();
     uintsys u_ExtraChars     = u_NumCharsBefore + u_NumCharsAfter;
     uintsys u_TotalChars     = u_OriginalLength + u_ExtraChars;
@@ -1017,6 +1178,8 @@ uchar* SharedMemory<MEMORY>::Allocate (uintsys u_NumBytes)
 
     mem_New.p_Data_ = p_NewData;
 
+    p_NewData->mem_.SetSecure (IsSecure());
+
     uchar* p_Buffer = p_NewData->mem_.Allocate (u_NumBytes);
 
     Swap (mem_New);
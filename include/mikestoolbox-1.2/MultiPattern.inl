@@ -0,0 +1,234 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       MultiPattern.inl
+//
+//  Synopsis:   Inline methods for objects that search for many literal
+//              strings at once
+//----------------------------------------------------------------------------
+
+namespace mikestoolbox {
+
+inline MultiPatternMatch::MultiPatternMatch ()
+    : u_Pattern_ (0)
+    , u_Offset_  (0)
+    , u_Length_  (0)
+{
+    // nothing
+}
+
+inline MultiPatternMatch::MultiPatternMatch (uintsys u_Pattern,
+                                             uintsys u_Offset,
+                                             uintsys u_Length)
+    : u_Pattern_ (u_Pattern)
+    , u_Offset_  (u_Offset)
+    , u_Length_  (u_Length)
+{
+    // nothing
+}
+
+inline uintsys MultiPatternMatch::Pattern () const
+{
+    return u_Pattern_;
+}
+
+inline uintsys MultiPatternMatch::Offset () const
+{
+    return u_Offset_;
+}
+
+inline uintsys MultiPatternMatch::Length () const
+{
+    return u_Length_;
+}
+
+inline bool MultiPatternMatch::operator== (const MultiPatternMatch& match)
+    const
+{
+    return (u_Pattern_ == match.u_Pattern_) &&
+           (u_Offset_  == match.u_Offset_)  &&
+           (u_Length_  == match.u_Length_);
+}
+
+inline MultiPatternData* MultiPatternData::Undef ()
+{
+    static MultiPatternData undef_ ((AlwaysShared()));
+
+    return &undef_;
+}
+
+inline MultiPattern::MultiPattern ()
+    : SharedResource (RESOURCE_NEW_ON_WRITE, MultiPatternData::Undef())
+{
+    // nothing
+}
+
+inline MultiPattern::MultiPattern (const MultiPattern& patterns)
+    : SharedResource (patterns)
+{
+    // nothing
+}
+
+#ifdef HAVE_MOVE_SEMANTICS
+inline MultiPattern::MultiPattern (MultiPattern&& patterns) noexcept
+    : SharedResource (RESOURCE_NEW_ON_WRITE, MultiPatternData::Undef())
+{
+    Swap (patterns);
+}
+#endif
+
+inline MultiPattern& MultiPattern::operator= (const MultiPattern& patterns)
+{
+    SharedResource::operator= (patterns);
+
+    return *this;
+}
+
+#ifdef HAVE_MOVE_SEMANTICS
+inline MultiPattern& MultiPattern::operator= (MultiPattern&& patterns)
+    noexcept
+{
+    MultiPattern mp_Old (std::move (patterns));
+
+    Swap (mp_Old);
+
+    return *this;
+}
+#endif
+
+inline const MultiPatternData* MultiPattern::ViewData () const
+{
+    return (const MultiPatternData*) SharedResource::ViewData();
+}
+
+inline MultiPatternData* MultiPattern::ModifyData ()
+{
+    return (MultiPatternData*) SharedResource::ModifyData();
+}
+
+inline MultiPatternData* MultiPattern::MakeNewSharedData () const
+{
+    MultiPatternData* p_NewData = new(std::nothrow) MultiPatternData;
+
+    if (p_NewData == 0)
+    {
+        throw Exception ("MultiPattern: Out of memory");
+    }
+
+    return p_NewData;
+}
+
+inline void MultiPattern::Swap (MultiPattern& patterns)
+{
+    SharedResource::Swap (patterns);
+}
+
+inline MultiPattern::operator bool () const
+{
+    return (ViewData()->u_NumStates_ > 1);
+}
+
+inline bool MultiPattern::IsCaseSensitive () const
+{
+    return ViewData()->b_CaseSensitive_;
+}
+
+inline uintsys MultiPattern::NumPatterns () const
+{
+    return ViewData()->strl_Patterns_.NumItems();
+}
+
+inline const StringList& MultiPattern::Patterns () const
+{
+    return ViewData()->strl_Patterns_;
+}
+
+inline const String MultiPattern::Pattern (uintsys u_Index) const
+{
+    return ViewData()->strl_Patterns_[u_Index];
+}
+
+inline bool MultiPattern::Contains (const uchar* p, uintsys u_Length) const
+{
+    return Scan_ (p, u_Length, 0, 0) != 0;
+}
+
+inline bool MultiPattern::Contains (const String& str) const
+{
+    return Contains (str.PointerToFirstByte(), str.Length());
+}
+
+inline bool MultiPattern::FindFirst (const uchar* p, uintsys u_Length,
+                                     MultiPatternMatch& match) const
+{
+    return Scan_ (p, u_Length, &match, 0) != 0;
+}
+
+inline bool MultiPattern::FindFirst (const String& str,
+                                     MultiPatternMatch& match) const
+{
+    return FindFirst (str.PointerToFirstByte(), str.Length(), match);
+}
+
+inline uintsys MultiPattern::FindAll (const uchar* p, uintsys u_Length,
+                                      MultiPatternMatchList& list) const
+{
+    return Scan_ (p, u_Length, 0, &list);
+}
+
+inline uintsys MultiPattern::FindAll (const String& str,
+                                      MultiPatternMatchList& list) const
+{
+    return FindAll (str.PointerToFirstByte(), str.Length(), list);
+}
+
+} // namespace mikestoolbox
+
+namespace std {
+
+template<>
+inline void swap<mikestoolbox::MultiPattern> (mikestoolbox::MultiPattern& mp1,
+                                              mikestoolbox::MultiPattern& mp2)
+{
+    mp1.Swap (mp2);
+}
+
+} // namespace std
@@ -0,0 +1,163 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       MutexProfile.inl
+//
+//  Synopsis:   Inline methods for lock contention statistics
+//----------------------------------------------------------------------------
+
+namespace mikestoolbox {
+
+inline MutexStats::MutexStats (const String& str_Name)
+    : str_Name_       (str_Name)
+    , u_Acquisitions_ (0)
+    , u_Contentions_  (0)
+    , d_TotalWait_    (0.0)
+    , d_MaxWait_      (0.0)
+    , d_TotalHold_    (0.0)
+    , d_MaxHold_      (0.0)
+{
+    // nothing
+}
+
+inline MutexStats::MutexStats ()
+    : str_Name_       ()
+    , u_Acquisitions_ (0)
+    , u_Contentions_  (0)
+    , d_TotalWait_    (0.0)
+    , d_MaxWait_      (0.0)
+    , d_TotalHold_    (0.0)
+    , d_MaxHold_      (0.0)
+{
+    // nothing
+}
+
+inline const String& MutexStats::Name () const
+{
+    return str_Name_;
+}
+
+inline uint64 MutexStats::Acquisitions () const
+{
+    return u_Acquisitions_;
+}
+
+inline uint64 MutexStats::Contentions () const
+{
+    return u_Contentions_;
+}
+
+inline double MutexStats::TotalWait () const
+{
+    return d_TotalWait_;
+}
+
+inline double MutexStats::MaxWait () const
+{
+    return d_MaxWait_;
+}
+
+inline double MutexStats::TotalHold () const
+{
+    return d_TotalHold_;
+}
+
+inline double MutexStats::MaxHold () const
+{
+    return d_MaxHold_;
+}
+
+inline void MutexStats::Add (const MutexStats& stats)
+{
+    u_Acquisitions_ += stats.u_Acquisitions_;
+    u_Contentions_  += stats.u_Contentions_;
+    d_TotalWait_    += stats.d_TotalWait_;
+    d_TotalHold_    += stats.d_TotalHold_;
+    d_MaxWait_       = Maximum (d_MaxWait_, stats.d_MaxWait_);
+    d_MaxHold_       = Maximum (d_MaxHold_, stats.d_MaxHold_);
+}
+
+inline void MutexStats::Clear ()
+{
+    u_Acquisitions_ = 0;
+    u_Contentions_  = 0;
+    d_TotalWait_    = 0.0;
+    d_MaxWait_      = 0.0;
+    d_TotalHold_    = 0.0;
+    d_MaxHold_      = 0.0;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Acquired_
+//
+//  Synopsis:   Called by the thread which now holds the mutex
+//----------------------------------------------------------------------------
+
+inline void MutexProfile::Acquired_ (bool b_Contended, double d_Wait)
+{
+    ++stats_.u_Acquisitions_;
+
+    if (b_Contended)
+    {
+        ++stats_.u_Contentions_;
+
+        stats_.d_TotalWait_ += d_Wait;
+        stats_.d_MaxWait_    = Maximum (stats_.d_MaxWait_, d_Wait);
+    }
+
+    timer_Hold_.Reset();
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Released_
+//
+//  Synopsis:   Called by the holder just before the mutex is unlocked
+//----------------------------------------------------------------------------
+
+inline void MutexProfile::Released_ ()
+{
+    double d_Hold = timer_Hold_.Elapsed();
+
+    stats_.d_TotalHold_ += d_Hold;
+    stats_.d_MaxHold_    = Maximum (stats_.d_MaxHold_, d_Hold);
+}
+
+} // namespace mikestoolbox
@@ -193,12 +193,61 @@ inline PerlRegexData::PerlRegexData ()
     // nothing
 }
 
+inline PerlRegexData::PerlRegexData (AlwaysShared)
+    : SharedData            (AlwaysShared())
+    , pcre_                 (0)
+    , pcre_extra_           (0)
+    , pz_CompileError_      (0)
+    , n_CompileErrorOffset_ (-1)
+{
+    // nothing
+}
+
 inline PerlRegexData::~PerlRegexData ()
 {
     pcre_free (pcre_);
     pcre_free (pcre_extra_);
 }
 
+inline PerlRegexData* PerlRegexData::Undef ()
+{
+    static PerlRegexData undef_ ((AlwaysShared()));
+
+    return &undef_;
+}
+
+inline PerlRegex::PerlRegex (const PerlRegex& regex)
+    : SharedResource (regex)
+{
+    // nothing
+}
+
+#ifdef HAVE_MOVE_SEMANTICS
+inline PerlRegex::PerlRegex (PerlRegex&& regex) noexcept
+    : SharedResource (RESOURCE_NEW_ON_WRITE, PerlRegexData::Undef())
+{
+    Swap (regex);
+}
+#endif
+
+inline PerlRegex& PerlRegex::operator= (const PerlRegex& regex)
+{
+    SharedResource::operator= (regex);
+
+    return *this;
+}
+
+#ifdef HAVE_MOVE_SEMANTICS
+inline PerlRegex& PerlRegex::operator= (PerlRegex&& regex) noexcept
+{
+    PerlRegex regex_Old (std::move (regex));
+
+    Swap (regex_Old);
+
+    return *this;
+}
+#endif
+
 inline const PerlRegexData* PerlRegex::ViewData () const
 {
     return (const PerlRegexData*) SharedResource::ViewData();
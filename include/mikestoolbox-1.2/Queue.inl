@@ -0,0 +1,690 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       Queue.inl
+//
+//  Synopsis:   Methods of SPSCQueue<T> and MPMCQueue<T>
+//----------------------------------------------------------------------------
+
+namespace mikestoolbox {
+
+//+---------------------------------------------------------------------------
+//  Function:   QueueCapacity
+//
+//  Synopsis:   Rounds the requested capacity up to a power of two
+//----------------------------------------------------------------------------
+
+inline uintsys QueueCapacity (uintsys u_Capacity)
+{
+    uintsys u_Size = 2;
+
+    while (u_Size < u_Capacity)
+    {
+        u_Size <<= 1;
+    }
+
+    return u_Size;
+}
+
+inline QueueWait::QueueWait (uintsys u_TimeoutMilliseconds)
+    : backoff_     ()
+    , timer_       ()
+    , d_Remaining_ (u_TimeoutMilliseconds / 1000.0)
+    , b_Forever_   (u_TimeoutMilliseconds == WAIT_FOREVER)
+{
+    // nothing
+}
+
+inline bool QueueWait::Pause ()
+{
+    if (!b_Forever_)
+    {
+        d_Remaining_ -= timer_.Elapsed();
+
+        if (d_Remaining_ <= 0.0)
+        {
+            return false;
+        }
+    }
+
+    backoff_.Pause();
+
+    return true;
+}
+
+//+---------------------------------------------------------------------------
+//  QueuePusher, QueuePopper
+//----------------------------------------------------------------------------
+
+template<typename QUEUE, typename T>
+inline QueuePusher<QUEUE, T>::QueuePusher (QUEUE& queue, const T& t,
+                                           bool& b_Pushed,
+                                           Atomic<bool>& b_Sleeping)
+    : queue_      (queue)
+    , t_          (t)
+    , b_Pushed_   (b_Pushed)
+    , b_Sleeping_ (b_Sleeping)
+{
+    // nothing
+}
+
+template<typename QUEUE, typename T>
+inline bool QueuePusher<QUEUE, T>::operator() () const
+{
+    b_Sleeping_.Exchange (true);
+
+    b_Pushed_ = queue_.TryPush (t_);
+
+    return b_Pushed_ || queue_.IsClosed();
+}
+
+template<typename QUEUE, typename T>
+inline QueuePopper<QUEUE, T>::QueuePopper (QUEUE& queue, T& t,
+                                           bool& b_Popped,
+                                           Atomic<bool>& b_Sleeping)
+    : queue_      (queue)
+    , t_          (t)
+    , b_Popped_   (b_Popped)
+    , b_Sleeping_ (b_Sleeping)
+{
+    // nothing
+}
+
+template<typename QUEUE, typename T>
+inline bool QueuePopper<QUEUE, T>::operator() () const
+{
+    b_Sleeping_.Exchange (true);
+
+    b_Popped_ = queue_.TryPop (t_);
+
+    return b_Popped_ || queue_.IsDrained();
+}
+
+//+---------------------------------------------------------------------------
+//  SPSCQueue
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline SPSCQueue<T>::SPSCQueue (uintsys u_Capacity)
+    : pt_Items_       (new T[QueueCapacity (u_Capacity)])
+    , u_Mask_         (QueueCapacity (u_Capacity) - 1)
+    , u_Head_         (0)
+    , u_TailCache_    (0)
+    , u_Tail_         (0)
+    , u_HeadCache_    (0)
+    , b_PushSleeping_ (false)
+    , b_PopSleeping_  (false)
+    , mutex_Sleep_    ()
+    , cond_NotFull_   ()
+    , cond_NotEmpty_  ()
+{
+    // nothing
+}
+
+template<typename T>
+inline SPSCQueue<T>::~SPSCQueue ()
+{
+    delete [] pt_Items_;
+}
+
+template<typename T>
+inline uintsys SPSCQueue<T>::Capacity () const
+{
+    return u_Mask_ + 1;
+}
+
+template<typename T>
+inline uintsys SPSCQueue<T>::NumItems () const
+{
+    uintsys u_Head = u_Head_.Load();     // first, so it cannot pass u_Tail
+    uintsys u_Tail = u_Tail_.Load() & ~QUEUE_CLOSED;
+
+    return Minimum (u_Tail - u_Head, u_Mask_ + 1);
+}
+
+template<typename T>
+inline bool SPSCQueue<T>::IsEmpty () const
+{
+    return NumItems() == 0;
+}
+
+template<typename T>
+inline bool SPSCQueue<T>::IsClosed () const
+{
+    return (u_Tail_.Load() & QUEUE_CLOSED) != 0;
+}
+
+template<typename T>
+inline bool SPSCQueue<T>::IsDrained () const
+{
+    uintsys u_Tail = u_Tail_.Load();
+
+    return ((u_Tail & QUEUE_CLOSED) != 0) &&
+           (u_Head_.Load() == (u_Tail & ~QUEUE_CLOSED));
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Close
+//
+//  Synopsis:   Sets QUEUE_CLOSED in the producer's index, then wakes every
+//              sleeper so that it can see the queue is closed
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline void SPSCQueue<T>::Close ()
+{
+    uintsys u_Tail = u_Tail_.LoadRelaxed();
+
+    while (((u_Tail & QUEUE_CLOSED) == 0) &&
+           !u_Tail_.CompareExchange (u_Tail, u_Tail | QUEUE_CLOSED))
+    {
+        // u_Tail now holds the producer's latest index
+    }
+
+    cond_NotFull_.Broadcast();
+    cond_NotEmpty_.Broadcast();
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Wake_
+//
+//  Synopsis:   Wakes the threads sleeping in Push or Pop, if any.  The
+//              fence pairs with the sleeper raising its flag, so either we
+//              see the flag or the sleeper sees what we just did.
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline void SPSCQueue<T>::Wake_ (Atomic<bool>& b_Sleeping,
+                                 Condition& cond)
+{
+    AtomicFence();
+
+    if (b_Sleeping.LoadRelaxed() && b_Sleeping.Exchange (false))
+    {
+        cond.Broadcast();
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     TryPush
+//
+//  Synopsis:   Called only by the producer.  Only reads the consumer's index
+//              when our cached copy says the queue is full.  The item is
+//              published with a CompareExchange, which fails if Close() got
+//              there first.
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bool SPSCQueue<T>::TryPush (const T& t)
+{
+    uintsys u_Tail = u_Tail_.LoadRelaxed();
+
+    if ((u_Tail & QUEUE_CLOSED) != 0)
+    {
+        return false;
+    }
+
+    if (u_Tail - u_HeadCache_ > u_Mask_)
+    {
+        u_HeadCache_ = u_Head_.Load();
+
+        if (u_Tail - u_HeadCache_ > u_Mask_)
+        {
+            return false;
+        }
+    }
+
+    T& t_Slot = pt_Items_[u_Tail & u_Mask_];
+
+    t_Slot = t;
+
+    if (!u_Tail_.CompareExchange (u_Tail, u_Tail + 1))
+    {
+        t_Slot = T();
+
+        return false;
+    }
+
+    Wake_ (b_PopSleeping_, cond_NotEmpty_);
+
+    return true;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     TryPop
+//
+//  Synopsis:   Called only by the consumer.  The slot is reset so that the
+//              queue does not keep a reference to what it handed out.
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bool SPSCQueue<T>::TryPop (T& t)
+{
+    uintsys u_Head = u_Head_.LoadRelaxed();
+
+    if (u_Head == u_TailCache_)
+    {
+        u_TailCache_ = u_Tail_.Load() & ~QUEUE_CLOSED;
+
+        if (u_Head == u_TailCache_)
+        {
+            return false;
+        }
+    }
+
+    T& t_Slot = pt_Items_[u_Head & u_Mask_];
+
+    t      = t_Slot;
+    t_Slot = T();
+
+    u_Head_.Store (u_Head + 1);
+
+    Wake_ (b_PushSleeping_, cond_NotFull_);
+
+    return true;
+}
+
+template<typename T>
+inline bool SPSCQueue<T>::Push (const T& t)
+{
+    return Push (t, WAIT_FOREVER);
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Push
+//
+//  Synopsis:   Spins briefly while the queue is full, then sleeps until the
+//              consumer makes room, the queue is closed or the timeout
+//              expires
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bool SPSCQueue<T>::Push (const T& t, uintsys u_TimeoutMilliseconds)
+{
+    for (uintsys u = 0; u < QUEUE_SPIN_LIMIT; ++u)
+    {
+        if (TryPush (t))
+        {
+            return true;
+        }
+
+        if (IsClosed())
+        {
+            return false;
+        }
+
+        CpuRelax();
+    }
+
+    bool b_Pushed = false;
+
+    QueuePusher<SPSCQueue<T>, T> pusher (*this, t, b_Pushed,
+                                         b_PushSleeping_);
+
+    MutexLocker locker (mutex_Sleep_);
+
+    cond_NotFull_.Wait (mutex_Sleep_, pusher, u_TimeoutMilliseconds);
+
+    return b_Pushed;
+}
+
+template<typename T>
+inline bool SPSCQueue<T>::Pop (T& t)
+{
+    return Pop (t, WAIT_FOREVER);
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Pop
+//
+//  Synopsis:   Spins briefly while the queue is empty, then sleeps until an
+//              item arrives, the queue is drained or the timeout expires
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bool SPSCQueue<T>::Pop (T& t, uintsys u_TimeoutMilliseconds)
+{
+    for (uintsys u = 0; u < QUEUE_SPIN_LIMIT; ++u)
+    {
+        if (TryPop (t))
+        {
+            return true;
+        }
+
+        if (IsDrained())
+        {
+            return false;
+        }
+
+        CpuRelax();
+    }
+
+    bool b_Popped = false;
+
+    QueuePopper<SPSCQueue<T>, T> popper (*this, t, b_Popped,
+                                         b_PopSleeping_);
+
+    MutexLocker locker (mutex_Sleep_);
+
+    cond_NotEmpty_.Wait (mutex_Sleep_, popper, u_TimeoutMilliseconds);
+
+    return b_Popped;
+}
+
+//+---------------------------------------------------------------------------
+//  MPMCQueue
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline MPMCQueue<T>::MPMCQueue (uintsys u_Capacity)
+    : p_Cells_        (new Cell[QueueCapacity (u_Capacity)])
+    , u_Mask_         (QueueCapacity (u_Capacity) - 1)
+    , u_Enqueue_      (0)
+    , u_Dequeue_      (0)
+    , b_PushSleeping_ (false)
+    , b_PopSleeping_  (false)
+    , mutex_Sleep_    ()
+    , cond_NotFull_   ()
+    , cond_NotEmpty_  ()
+{
+    for (uintsys u = 0; u <= u_Mask_; ++u)
+    {
+        p_Cells_[u].u_Sequence_.StoreRelaxed (u);
+    }
+}
+
+template<typename T>
+inline MPMCQueue<T>::~MPMCQueue ()
+{
+    delete [] p_Cells_;
+}
+
+template<typename T>
+inline uintsys MPMCQueue<T>::Capacity () const
+{
+    return u_Mask_ + 1;
+}
+
+template<typename T>
+inline uintsys MPMCQueue<T>::NumItems () const
+{
+    uintsys u_Dequeue = u_Dequeue_.Load();
+    uintsys u_Enqueue = u_Enqueue_.Load() & ~QUEUE_CLOSED;
+
+    return (u_Enqueue > u_Dequeue)
+         ? Minimum (u_Enqueue - u_Dequeue, u_Mask_ + 1) : 0;
+}
+
+template<typename T>
+inline bool MPMCQueue<T>::IsEmpty () const
+{
+    return NumItems() == 0;
+}
+
+template<typename T>
+inline bool MPMCQueue<T>::IsClosed () const
+{
+    return (u_Enqueue_.Load() & QUEUE_CLOSED) != 0;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     IsDrained
+//
+//  Synopsis:   Returns true once the queue is closed and every cell claimed
+//              by a producer before that has been popped.  A cell which is
+//              claimed but not yet published keeps the queue undrained.
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bool MPMCQueue<T>::IsDrained () const
+{
+    uintsys u_Enqueue = u_Enqueue_.Load();
+
+    return ((u_Enqueue & QUEUE_CLOSED) != 0) &&
+           (u_Dequeue_.Load() >= (u_Enqueue & ~QUEUE_CLOSED));
+}
+
+template<typename T>
+inline void MPMCQueue<T>::Close ()
+{
+    uintsys u_Enqueue = u_Enqueue_.LoadRelaxed();
+
+    while (((u_Enqueue & QUEUE_CLOSED) == 0) &&
+           !u_Enqueue_.CompareExchange (u_Enqueue, u_Enqueue | QUEUE_CLOSED))
+    {
+        // u_Enqueue now holds the latest index
+    }
+
+    cond_NotFull_.Broadcast();
+    cond_NotEmpty_.Broadcast();
+}
+
+template<typename T>
+inline void MPMCQueue<T>::Wake_ (Atomic<bool>& b_Sleeping,
+                                 Condition& cond)
+{
+    AtomicFence();  // see SPSCQueue::Wake_
+
+    if (b_Sleeping.LoadRelaxed() && b_Sleeping.Exchange (false))
+    {
+        cond.Broadcast();
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     TryPush
+//
+//  Synopsis:   Claims the cell at the enqueue index if its sequence number
+//              says it is free, then publishes the item by bumping the
+//              sequence number.  Once QUEUE_CLOSED is set in the index no
+//              cell can be claimed.
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bool MPMCQueue<T>::TryPush (const T& t)
+{
+    uintsys u_Position = u_Enqueue_.LoadRelaxed();
+    Cell*   p_Cell;
+
+    for (;;)
+    {
+        if ((u_Position & QUEUE_CLOSED) != 0)
+        {
+            return false;
+        }
+
+        p_Cell = &p_Cells_[u_Position & u_Mask_];
+
+        intsys n_Diff = intsys (p_Cell->u_Sequence_.Load() - u_Position);
+
+        if (n_Diff == 0)
+        {
+            if (u_Enqueue_.CompareExchange (u_Position, u_Position + 1))
+            {
+                break;
+            }
+        }
+        else if (n_Diff < 0)
+        {
+            return false;   // full
+        }
+        else
+        {
+            u_Position = u_Enqueue_.LoadRelaxed();
+        }
+    }
+
+    p_Cell->t_ = t;
+    p_Cell->u_Sequence_.Store (u_Position + 1);
+
+    Wake_ (b_PopSleeping_, cond_NotEmpty_);
+
+    return true;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     TryPop
+//
+//  Synopsis:   Claims the cell at the dequeue index once a producer has
+//              published into it, then hands the cell back to producers
+//              for the next lap around the ring
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bool MPMCQueue<T>::TryPop (T& t)
+{
+    uintsys u_Position = u_Dequeue_.LoadRelaxed();
+    Cell*   p_Cell;
+
+    for (;;)
+    {
+        p_Cell = &p_Cells_[u_Position & u_Mask_];
+
+        intsys n_Diff = intsys (p_Cell->u_Sequence_.Load() - (u_Position + 1));
+
+        if (n_Diff == 0)
+        {
+            if (u_Dequeue_.CompareExchange (u_Position, u_Position + 1))
+            {
+                break;
+            }
+        }
+        else if (n_Diff < 0)
+        {
+            return false;   // empty
+        }
+        else
+        {
+            u_Position = u_Dequeue_.LoadRelaxed();
+        }
+    }
+
+    t          = p_Cell->t_;
+    p_Cell->t_ = T();
+
+    p_Cell->u_Sequence_.Store (u_Position + u_Mask_ + 1);
+
+    Wake_ (b_PushSleeping_, cond_NotFull_);
+
+    return true;
+}
+
+template<typename T>
+inline bool MPMCQueue<T>::Push (const T& t)
+{
+    return Push (t, WAIT_FOREVER);
+}
+
+template<typename T>
+inline bool MPMCQueue<T>::Push (const T& t, uintsys u_TimeoutMilliseconds)
+{
+    for (uintsys u = 0; u < QUEUE_SPIN_LIMIT; ++u)
+    {
+        if (TryPush (t))
+        {
+            return true;
+        }
+
+        if (IsClosed())
+        {
+            return false;
+        }
+
+        CpuRelax();
+    }
+
+    bool b_Pushed = false;
+
+    QueuePusher<MPMCQueue<T>, T> pusher (*this, t, b_Pushed,
+                                         b_PushSleeping_);
+
+    MutexLocker locker (mutex_Sleep_);
+
+    cond_NotFull_.Wait (mutex_Sleep_, pusher, u_TimeoutMilliseconds);
+
+    return b_Pushed;
+}
+
+template<typename T>
+inline bool MPMCQueue<T>::Pop (T& t)
+{
+    return Pop (t, WAIT_FOREVER);
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Pop
+//
+//  Synopsis:   As SPSCQueue::Pop.  After Close() this keeps waiting while
+//              a producer which claimed a cell before the close has yet to
+//              publish its item.
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bool MPMCQueue<T>::Pop (T& t, uintsys u_TimeoutMilliseconds)
+{
+    for (uintsys u = 0; u < QUEUE_SPIN_LIMIT; ++u)
+    {
+        if (TryPop (t))
+        {
+            return true;
+        }
+
+        if (IsDrained())
+        {
+            return false;
+        }
+
+        CpuRelax();
+    }
+
+    bool b_Popped = false;
+
+    QueuePopper<MPMCQueue<T>, T> popper (*this, t, b_Popped,
+                                         b_PopSleeping_);
+
+    MutexLocker locker (mutex_Sleep_);
+
+    cond_NotEmpty_.Wait (mutex_Sleep_, popper, u_TimeoutMilliseconds);
+
+    return b_Popped;
+}
+
+} // namespace mikestoolbox
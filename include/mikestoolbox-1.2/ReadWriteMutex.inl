@@ -0,0 +1,151 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       ReadWriteMutex.inl
+//
+//  Synopsis:   Implementation of inline ReadWriteMutex methods
+//----------------------------------------------------------------------------
+
+namespace mikestoolbox {
+
+inline ReadWriteMutex::ReadWriteMutex ()
+    : u_State_          (0)
+    , u_WritersWaiting_ (0)
+    , cond_Readers_     ()
+    , cond_Writers_     ()
+    , mutex_            ()
+{
+    // nothing
+}
+
+inline bool ReadWriteMutex::TryLockShared () const
+{
+    uint32 u_State = u_State_.LoadRelaxed();
+
+    while (((u_State & WRITER) == 0) && (u_WritersWaiting_.Load() == 0))
+    {
+        if (u_State_.CompareExchange (u_State, u_State + 1))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline void ReadWriteMutex::LockShared () const
+{
+    if (!TryLockShared())
+    {
+        LockSharedSlow_();
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     UnlockShared
+//
+//  Synopsis:   The last reader out wakes the waiting writers
+//
+//  Notes:      Every writer is woken rather than one, since the one
+//              Signal() picks may find the lock taken again and go back to
+//              sleep while another writer could have had it
+//----------------------------------------------------------------------------
+
+inline void ReadWriteMutex::UnlockShared () const
+{
+    if ((u_State_.Decrement() == 0) && (u_WritersWaiting_.Load() != 0))
+    {
+        cond_Writers_.Broadcast();
+    }
+}
+
+inline bool ReadWriteMutex::TryLock () const
+{
+    uint32 u_Expected = 0;
+
+    return u_State_.CompareExchange (u_Expected, WRITER);
+}
+
+inline void ReadWriteMutex::Lock () const
+{
+    if (!TryLock())
+    {
+        LockSlow_();
+    }
+}
+
+inline void ReadWriteMutex::Unlock () const
+{
+    u_State_.Store (0);
+
+    AtomicFence();
+
+    if (u_WritersWaiting_.Load() != 0)
+    {
+        cond_Writers_.Broadcast();  // as in UnlockShared
+    }
+
+    cond_Readers_.Broadcast();
+}
+
+inline ReadLocker::ReadLocker (const ReadWriteMutex& rwmutex)
+    : rwmutex_ (rwmutex)
+{
+    rwmutex_.LockShared();
+}
+
+inline ReadLocker::~ReadLocker ()
+{
+    rwmutex_.UnlockShared();
+}
+
+inline WriteLocker::WriteLocker (const ReadWriteMutex& rwmutex)
+    : rwmutex_ (rwmutex)
+{
+    rwmutex_.Lock();
+}
+
+inline WriteLocker::~WriteLocker ()
+{
+    rwmutex_.Unlock();
+}
+
+} // namespace mikestoolbox
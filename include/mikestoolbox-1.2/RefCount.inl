@@ -56,11 +56,15 @@ inline RefCount::RefCount (uintsys u_Initial)
 
 inline uintsys RefCount::Increment ()
 {
+    Count_();
+
     return ++n_Count_;
 }
 
 inline uintsys RefCount::Decrement ()
 {
+    Count_();
+
     return --n_Count_;
 }
 
@@ -75,11 +79,15 @@ inline RefCount::RefCount (uintsys u_Initial)
 
 inline uintsys RefCount::Increment ()
 {
+    Count_();
+
     return InterlockedIncrement (&n_Count_);
 }
 
 inline uintsys RefCount::Decrement ()
 {
+    Count_();
+
     return InterlockedDecrement (&n_Count_);
 }
 
@@ -96,6 +104,8 @@ inline uintsys RefCount::Increment ()
 {
     MutexLocker locker (mutex_);
 
+    Count_();
+
     return ++n_Count_;
 }
 
@@ -103,12 +113,56 @@ inline uintsys RefCount::Decrement ()
 {
     MutexLocker locker (mutex_);
 
+    Count_();
+
     return --n_Count_;
 }
 
 #endif
 #endif
 
+//+---------------------------------------------------------------------------
+//  Method:     Count_
+//
+//  Synopsis:   Tallies one increment or decrement for the benchmarks
+//
+//  Notes:      Compiled away unless COUNT_REFERENCES is defined.  The tally
+//              is per thread so that counting does not add contention
+//----------------------------------------------------------------------------
+
+#ifdef COUNT_REFERENCES
+
+inline uintsys& RefCount::Counter_ ()
+{
+    static THREAD_LOCAL uintsys u_Count = 0;
+
+    return u_Count;
+}
+
+inline void RefCount::Count_ ()
+{
+    ++Counter_();
+}
+
+inline uintsys RefCount::Operations ()
+{
+    return Counter_();
+}
+
+inline void RefCount::ResetOperations ()
+{
+    Counter_() = 0;
+}
+
+#else
+
+inline void RefCount::Count_ ()
+{
+    // nothing
+}
+
+#endif
+
 inline RefCount::operator uintsys () const
 {
     return n_Count_;
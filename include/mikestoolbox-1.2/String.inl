@@ -78,31 +78,15 @@ inline intsys StringCompare (const uchar* ps1, const uchar* ps2,
 
     if (b_CaseSensitive)
     {
-        for (uintsys u=0; u<u_NumChars; ++u)
-        {
-            n_Return = ByteCompareCase (*ps1++, *ps2++);
+        // memcmp compares as unsigned char, just like ByteCompareCase
 
-            if (n_Return == 0)
-            {
-                continue;
-            }
+        int n_Compare = std::memcmp (ps1, ps2, u_NumChars);
 
-            break;
-        }
+        n_Return = (n_Compare < 0) ? -1 : (n_Compare > 0);
     }
     else
     {
-        for (uintsys u=0; u<u_NumChars; ++u)
-        {
-            n_Return = ByteCompareNoCase (*ps1++, *ps2++);
-
-            if (n_Return == 0)
-            {
-                continue;
-            }
-
-            break;
-        }
+        n_Return = AsciiCase::Compare (ps1, ps2, u_NumChars);
     }
 
     return n_Return;
@@ -131,6 +115,16 @@ inline SubString::SubString (String& str_Reference, uintsys u_Offset,
     }
 }
 
+inline String SubString::AsLowerCase () const
+{
+    return String (*this).AsLowerCase();
+}
+
+inline String SubString::AsUpperCase () const
+{
+    return String (*this).AsUpperCase();
+}
+
 inline const char* SubString::Start () const
 {
     const char* ps_Return = str_Reference_.C();
@@ -206,6 +200,15 @@ inline String::String (const String& str)
     // nothing
 }
 
+#ifdef HAVE_MOVE_SEMANTICS
+inline String::String (String&& str) noexcept
+    : mem_          (std::move (str.mem_))
+    , b_IgnoreCase_ (str.b_IgnoreCase_)
+{
+    // nothing
+}
+#endif
+
 inline String::String (const String& str1, const String& str2)
     : mem_          ()
     , b_IgnoreCase_ (str1.b_IgnoreCase_ || str2.b_IgnoreCase_)
@@ -261,6 +264,19 @@ inline String::String (const StringIter& iter)
     }
 }
 
+inline String::String (const StringView& view)
+    : mem_          ()
+    , b_IgnoreCase_ (false)
+{
+    uintsys u_Length = view.Length();
+
+    if (u_Length > 0)
+    {
+        std::memcpy (mem_.Allocate (u_Length), view.PointerToFirstByte(),
+                     u_Length);
+    }
+}
+
 inline String::String (const uchar* ps_Source, uintsys u_NumBytes)
     : mem_          ()
     , b_IgnoreCase_ (false)
@@ -475,6 +491,16 @@ inline bool String::IsEmpty () const
     return (mem_.Length() == 0);
 }
 
+inline bool String::IsSecure () const
+{
+    return mem_.IsSecure();
+}
+
+inline void String::SetSecure (bool b_Secure)
+{
+    mem_.SetSecure (b_Secure);
+}
+
 inline uchar* String::Allocate (uintsys u_Size)
 {
     return mem_.Allocate (u_Size);
@@ -522,6 +548,23 @@ inline void String::Append (const StringIter& iter)
     Append (str);
 }
 
+inline void String::Append (const StringView& view)
+{
+    const uchar* p_View  = view.PointerToFirstByte();
+    const uchar* p_Start = PointerToFirstByte();
+
+    if ((p_View >= p_Start) && (p_View < p_Start + Length()))
+    {
+        String str (view);  // growing this String may move the bytes
+
+        Append (str);
+    }
+    else
+    {
+        Append (p_View, view.Length());
+    }
+}
+
 inline void String::Append (const StringList& strl)
 {
     uintsys u_ListSize = strl.Size();
@@ -657,32 +700,44 @@ inline void String::Append (char c1, char c2, char c3, char c4)
 
 inline void String::Append (uint16 u)
 {
-    Append (String (u));
+    char ac[24];
+
+    Append (ac, Number::FormatUint (u, ac));
 }
 
 inline void String::Append (uint32 u)
 {
-    Append (String (u));
+    char ac[24];
+
+    Append (ac, Number::FormatUint (u, ac));
 }
 
 inline void String::Append (uint64 u)
 {
-    Append (String (u));
+    char ac[24];
+
+    Append (ac, Number::FormatUint (u, ac));
 }
 
 inline void String::Append (int16 n)
 {
-    Append (String (n));
+    char ac[24];
+
+    Append (ac, Number::FormatInt (n, ac));
 }
 
 inline void String::Append (int32 n)
 {
-    Append (String (n));
+    char ac[24];
+
+    Append (ac, Number::FormatInt (n, ac));
 }
 
 inline void String::Append (int64 n)
 {
-    Append (String (n));
+    char ac[24];
+
+    Append (ac, Number::FormatInt (n, ac));
 }
 
 inline void String::AppendUint32 (uintsys u)
@@ -840,12 +895,11 @@ inline void String::AppendHexBytes (uchar uc1, uchar uc2)
 
 inline double String::AsDouble () const
 {
-    if (IsEmpty())
-    {
-        return 0.0;
-    }
+    double d = 0.0;
+
+    Number::ParseDouble (PointerToFirstChar(), Length(), d);
 
-    return std::strtod (PointerToFirstChar(), 0);
+    return d;
 }
 
 inline float String::AsFloat () const
@@ -855,30 +909,20 @@ inline float String::AsFloat () const
 
 inline intsys String::AsInt () const
 {
-    if (IsEmpty())
-    {
-        return 0;
-    }
+    int64 n = 0;
 
-#ifdef HAVE_STD_STRTOLL
-    return std::strtoll (PointerToFirstChar(), 0, 10);
-#else
-    return std::strtol (PointerToFirstChar(), 0, 10);
-#endif
+    Number::ParseInt (PointerToFirstChar(), Length(), n);
+
+    return (intsys) n;
 }
 
 inline uintsys String::AsUint () const
 {
-    if (IsEmpty())
-    {
-        return 0UL;
-    }
+    uint64 u = 0;
 
-#ifdef HAVE_STD_STRTOULL
-    return std::strtoull (PointerToFirstChar(), 0, 10);
-#else
-    return std::strtoul (PointerToFirstChar(), 0, 10);
-#endif
+    Number::ParseUint (PointerToFirstChar(), Length(), u);
+
+    return (uintsys) u;
 }
 
 inline const String String::Base64Encode () const
@@ -977,6 +1021,11 @@ inline bool String::Contains (char c, bool b_Case) const
     return Contains (c, 0, b_Case);
 }
 
+inline bool String::Contains (const MultiPattern& patterns) const
+{
+    return patterns.Contains (*this);
+}
+
 inline uintsys String::Count (char c) const
 {
     return Count ((uchar)c);
@@ -1079,17 +1128,7 @@ inline bool String::IsCaseSensitive () const
 
 inline bool String::IsValidUTF8 () const
 {
-    ParseError error;
-    uintsys    u = 0;
-
-    StringIter iter (*this);
-
-    while (iter.ParseUTF8Char (u, error))
-    {
-        // nothing
-    }
-
-    return !iter;
+    return Unicode::IsValidUTF8 (PointerToFirstByte(), Length());
 }
 
 inline bool String::IsValidUTF16 () const
@@ -1329,6 +1368,56 @@ inline const StringList String::Split (char c_SplitChar, uintsys u_MaxStrings,
     return Split (str_Pattern, u_MaxStrings, b_Case);
 }
 
+inline const StringView
+    String::SegmentView (const Index& offset, uintsys u_NumBytes) const
+{
+    StringView view (*this);
+
+    return view.Segment (offset, u_NumBytes);
+}
+
+inline const StringViewList String::SplitView (const String& str_Pattern,
+                                               uintsys u_MaxStrings,
+                                               bool b_Case) const
+{
+    if (b_IgnoreCase_ || !str_Pattern.IsCaseSensitive())
+    {
+        b_Case = false;
+    }
+
+    StringView view (*this);
+
+    return view.Split (str_Pattern, u_MaxStrings, b_Case);
+}
+
+inline const StringViewList String::SplitView (const char* pz_Pattern,
+                                               uintsys u_MaxStrings,
+                                               bool b_Case) const
+{
+    if (b_IgnoreCase_)
+    {
+        b_Case = false;
+    }
+
+    StringView view (*this);
+
+    return view.Split (pz_Pattern, u_MaxStrings, b_Case);
+}
+
+inline const StringViewList String::SplitView (char c_SplitChar,
+                                               uintsys u_MaxStrings,
+                                               bool b_Case) const
+{
+    if (b_IgnoreCase_)
+    {
+        b_Case = false;
+    }
+
+    StringView view (*this);
+
+    return view.Split (c_SplitChar, u_MaxStrings, b_Case);
+}
+
 inline bool String::StartsWith (const char* pz, bool b_Case) const
 {
     String str (pz);
@@ -1565,6 +1654,15 @@ inline String& String::operator= (const String& str)
     return *this;
 }
 
+#ifdef HAVE_MOVE_SEMANTICS
+inline String& String::operator= (String&& str) noexcept
+{
+    mem_ = std::move (str.mem_);
+
+    return *this;
+}
+#endif
+
 inline String& String::operator= (const StringIter& iter)
 {
     String str (iter);
@@ -1737,16 +1835,16 @@ inline String& String::operator+= (float f)
 
 inline String& String::operator+= (int64 n)
 {
-    String str (n);
+    Append (n);
 
-    return operator+= (str);
+    return *this;
 }
 
 inline String& String::operator+= (int32 n)
 {
-    String str (n);
+    Append (n);
 
-    return operator+= (str);
+    return *this;
 }
 
 inline String& String::operator+= (int16 s)
@@ -1756,16 +1854,16 @@ inline String& String::operator+= (int16 s)
 
 inline String& String::operator+= (uint64 u)
 {
-    String str (u);
+    Append (u);
 
-    return operator+= (str);
+    return *this;
 }
 
 inline String& String::operator+= (uint32 u)
 {
-    String str (u);
+    Append (u);
 
-    return operator+= (str);
+    return *this;
 }
 
 inline String& String::operator+= (uint16 u)
@@ -2022,13 +2120,11 @@ inline bool String::operator>= (char c) const
 }
 
 inline StringIter::StringIter (const String& str, const Index& offset)
-    : str_               (str)
-    , p_Start_           (str_.PointerToFirstByte())
-    , p_End_             (p_Start_ + str_.Length())
-    , p_Char_            (p_End_)
-    , pmf_ExtractUint16_ (&StringIter::ExtractUint16BE)
-    , pmf_ExtractUint24_ (&StringIter::ExtractUint24BE)
-    , pmf_ExtractUint32_ (&StringIter::ExtractUint32BE)
+    : str_            (str)
+    , p_Start_        (str_.PointerToFirstByte())
+    , p_End_          (p_Start_ + str_.Length())
+    , p_Char_         (p_End_)
+    , b_LittleEndian_ (false)
 {
     uintsys u_Offset = 0;
 
@@ -2039,38 +2135,32 @@ inline StringIter::StringIter (const String& str, const Index& offset)
 }
 
 inline StringIter::StringIter (const String& str)
-    : str_     (str)
-    , p_Start_ (str_.PointerToFirstByte())
-    , p_End_   (p_Start_ + str_.Length())
-    , p_Char_  (p_Start_)
-    , pmf_ExtractUint16_ (&StringIter::ExtractUint16BE)
-    , pmf_ExtractUint24_ (&StringIter::ExtractUint24BE)
-    , pmf_ExtractUint32_ (&StringIter::ExtractUint32BE)
+    : str_            (str)
+    , p_Start_        (str_.PointerToFirstByte())
+    , p_End_          (p_Start_ + str_.Length())
+    , p_Char_         (p_Start_)
+    , b_LittleEndian_ (false)
 {
     // nothing
 }
 
 inline StringIter::StringIter (const StringIter& iter, const uchar* ps,
                                uintsys u_Length)
-    : str_     (iter.str_)
-    , p_Start_ (ps)
-    , p_End_   (ps+u_Length)
-    , p_Char_  (ps)
-    , pmf_ExtractUint16_ (iter.pmf_ExtractUint16_)
-    , pmf_ExtractUint24_ (iter.pmf_ExtractUint24_)
-    , pmf_ExtractUint32_ (iter.pmf_ExtractUint32_)
+    : str_            (iter.str_)
+    , p_Start_        (ps)
+    , p_End_          (ps+u_Length)
+    , p_Char_         (ps)
+    , b_LittleEndian_ (iter.b_LittleEndian_)
 {
     // nothing
 }
 
 inline StringIter::StringIter ()
-    : str_     ()
-    , p_Start_ (0)
-    , p_End_   (0)
-    , p_Char_  (0)
-    , pmf_ExtractUint16_ (&StringIter::ExtractUint16BE)
-    , pmf_ExtractUint24_ (&StringIter::ExtractUint24BE)
-    , pmf_ExtractUint32_ (&StringIter::ExtractUint32BE)
+    : str_            ()
+    , p_Start_        (0)
+    , p_End_          (0)
+    , p_Char_         (0)
+    , b_LittleEndian_ (false)
 {
     // nothing
 }
@@ -2079,27 +2169,21 @@ inline void StringIter::Swap (StringIter& iter)
 {
     using std::swap;
 
-    swap (str_,               iter.str_);
-    swap (p_Start_,           iter.p_Start_);
-    swap (p_End_,             iter.p_End_);
-    swap (p_Char_,            iter.p_Char_);
-    swap (pmf_ExtractUint16_, iter.pmf_ExtractUint16_);
-    swap (pmf_ExtractUint24_, iter.pmf_ExtractUint24_);
-    swap (pmf_ExtractUint32_, iter.pmf_ExtractUint32_);
+    swap (str_,            iter.str_);
+    swap (p_Start_,        iter.p_Start_);
+    swap (p_End_,          iter.p_End_);
+    swap (p_Char_,         iter.p_Char_);
+    swap (b_LittleEndian_, iter.b_LittleEndian_);
 }
 
 inline void StringIter::SetBigEndian ()
 {
-    pmf_ExtractUint16_ = &StringIter::ExtractUint16BE;
-    pmf_ExtractUint24_ = &StringIter::ExtractUint24BE;
-    pmf_ExtractUint32_ = &StringIter::ExtractUint32BE;
+    b_LittleEndian_ = false;
 }
 
 inline void StringIter::SetLittleEndian ()
 {
-    pmf_ExtractUint16_ = &StringIter::ExtractUint16LE;
-    pmf_ExtractUint24_ = &StringIter::ExtractUint24LE;
-    pmf_ExtractUint32_ = &StringIter::ExtractUint32LE;
+    b_LittleEndian_ = true;
 }
 
 inline bool StringIter::IsValid () const
@@ -2199,8 +2283,9 @@ inline bool StringIter::ExtractUint16BE (uintsys& u, ParseError& error)
         return false;
     }
 
-    u  = (*p_Char_++) << 8;
-    u |=  *p_Char_++;
+    u = ByteOrder::LoadUint16BE (p_Char_);
+
+    p_Char_ += 2;
 
     return true;
 }
@@ -2214,9 +2299,9 @@ inline bool StringIter::ExtractUint24BE (uintsys& u, ParseError& error)
         return false;
     }
 
-    u  = (*p_Char_++) << 16;
-    u |= (*p_Char_++) <<  8;
-    u |=  *p_Char_++;
+    u = (ByteOrder::LoadUint16BE (p_Char_) << 8) | p_Char_[2];
+
+    p_Char_ += 3;
 
     return true;
 }
@@ -2230,67 +2315,229 @@ inline bool StringIter::ExtractUint32BE (uintsys& u, ParseError& error)
         return false;
     }
 
-    uint32 u32 = 0;
+    u = ByteOrder::LoadUint32BE (p_Char_);
+
+    p_Char_ += 4;
+
+    return true;
+}
+
+inline bool StringIter::ExtractUint64BE (uint64& u, ParseError& error)
+{
+    if (Capacity() < 8)
+    {
+        error.SetUnexpectedEndOfData();
+
+        return false;
+    }
 
-    u32  = (*p_Char_++) << 24;
-    u32 |= (*p_Char_++) << 16;
-    u32 |= (*p_Char_++) <<  8;
-    u32 |=  *p_Char_++;
+    u = ByteOrder::LoadUint64BE (p_Char_);
 
-    u = u32;
+    p_Char_ += 8;
 
     return true;
 }
 
 inline bool StringIter::ExtractUint16LE (uintsys& u, ParseError& error)
 {
-    if (!ExtractUint16BE (u, error))
+    if (Capacity() < 2)
     {
+        error.SetUnexpectedEndOfData();
+
         return false;
     }
 
-    u = SwapEndian16Bit (u);
+    u = ByteOrder::LoadUint16LE (p_Char_);
+
+    p_Char_ += 2;
 
     return true;
 }
 
 inline bool StringIter::ExtractUint24LE (uintsys& u, ParseError& error)
 {
-    if (!ExtractUint24BE (u, error))
+    if (Capacity() < 3)
     {
+        error.SetUnexpectedEndOfData();
+
         return false;
     }
 
-    u = SwapEndian24Bit (u);
+    u = ByteOrder::LoadUint16LE (p_Char_) | (p_Char_[2] << 16);
+
+    p_Char_ += 3;
 
     return true;
 }
 
 inline bool StringIter::ExtractUint32LE (uintsys& u, ParseError& error)
 {
-    if (!ExtractUint32BE (u, error))
+    if (Capacity() < 4)
     {
+        error.SetUnexpectedEndOfData();
+
         return false;
     }
 
-    u = SwapEndian32Bit (u);
+    u = ByteOrder::LoadUint32LE (p_Char_);
+
+    p_Char_ += 4;
+
+    return true;
+}
+
+inline bool StringIter::ExtractUint64LE (uint64& u, ParseError& error)
+{
+    if (Capacity() < 8)
+    {
+        error.SetUnexpectedEndOfData();
+
+        return false;
+    }
+
+    u = ByteOrder::LoadUint64LE (p_Char_);
+
+    p_Char_ += 8;
 
     return true;
 }
 
 inline bool StringIter::ExtractUint16 (uintsys& u, ParseError& error)
 {
-    return (this->*pmf_ExtractUint16_) (u, error);
+    return b_LittleEndian_ ? ExtractUint16LE (u, error)
+                           : ExtractUint16BE (u, error);
 }
 
 inline bool StringIter::ExtractUint24 (uintsys& u, ParseError& error)
 {
-    return (this->*pmf_ExtractUint24_) (u, error);
+    return b_LittleEndian_ ? ExtractUint24LE (u, error)
+                           : ExtractUint24BE (u, error);
 }
 
 inline bool StringIter::ExtractUint32 (uintsys& u, ParseError& error)
 {
-    return (this->*pmf_ExtractUint32_) (u, error);
+    return b_LittleEndian_ ? ExtractUint32LE (u, error)
+                           : ExtractUint32BE (u, error);
+}
+
+inline bool StringIter::ExtractUint64 (uint64& u, ParseError& error)
+{
+    return b_LittleEndian_ ? ExtractUint64LE (u, error)
+                           : ExtractUint64BE (u, error);
+}
+
+inline bool StringIter::ExtractFloatBE (float& f, ParseError& error)
+{
+    if (Capacity() < 4)
+    {
+        error.SetUnexpectedEndOfData();
+
+        return false;
+    }
+
+    uint32 u = ByteOrder::LoadUint32BE (p_Char_);
+
+    std::memcpy (&f, &u, 4);
+
+    p_Char_ += 4;
+
+    return true;
+}
+
+inline bool StringIter::ExtractFloatLE (float& f, ParseError& error)
+{
+    if (Capacity() < 4)
+    {
+        error.SetUnexpectedEndOfData();
+
+        return false;
+    }
+
+    uint32 u = ByteOrder::LoadUint32LE (p_Char_);
+
+    std::memcpy (&f, &u, 4);
+
+    p_Char_ += 4;
+
+    return true;
+}
+
+inline bool StringIter::ExtractFloat (float& f, ParseError& error)
+{
+    return b_LittleEndian_ ? ExtractFloatLE (f, error)
+                           : ExtractFloatBE (f, error);
+}
+
+inline bool StringIter::ExtractDoubleBE (double& d, ParseError& error)
+{
+    if (Capacity() < 8)
+    {
+        error.SetUnexpectedEndOfData();
+
+        return false;
+    }
+
+    uint64 u = ByteOrder::LoadUint64BE (p_Char_);
+
+    std::memcpy (&d, &u, 8);
+
+    p_Char_ += 8;
+
+    return true;
+}
+
+inline bool StringIter::ExtractDoubleLE (double& d, ParseError& error)
+{
+    if (Capacity() < 8)
+    {
+        error.SetUnexpectedEndOfData();
+
+        return false;
+    }
+
+    uint64 u = ByteOrder::LoadUint64LE (p_Char_);
+
+    std::memcpy (&d, &u, 8);
+
+    p_Char_ += 8;
+
+    return true;
+}
+
+inline bool StringIter::ExtractDouble (double& d, ParseError& error)
+{
+    return b_LittleEndian_ ? ExtractDoubleLE (d, error)
+                           : ExtractDoubleBE (d, error);
+}
+
+inline bool StringIter::ExtractUint16Array (uint16* pu, uintsys u_Count,
+                                            ParseError& error)
+{
+    return ExtractArray_ (pu, u_Count, 2, error);
+}
+
+inline bool StringIter::ExtractUint32Array (uint32* pu, uintsys u_Count,
+                                            ParseError& error)
+{
+    return ExtractArray_ (pu, u_Count, 4, error);
+}
+
+inline bool StringIter::ExtractUint64Array (uint64* pu, uintsys u_Count,
+                                            ParseError& error)
+{
+    return ExtractArray_ (pu, u_Count, 8, error);
+}
+
+inline bool StringIter::ExtractFloatArray (float* pf, uintsys u_Count,
+                                           ParseError& error)
+{
+    return ExtractArray_ (pf, u_Count, 4, error);
+}
+
+inline bool StringIter::ExtractDoubleArray (double* pd, uintsys u_Count,
+                                            ParseError& error)
+{
+    return ExtractArray_ (pd, u_Count, 8, error);
 }
 
 inline StringIter& StringIter::operator++ ()
@@ -2565,32 +2812,78 @@ inline const String operator+ (uint16 u, const String& str)
 }
 
 inline StringBitIter::StringBitIter (const String& str)
-    : iter_            (str)
-    , u_BitOffset_     (0)
-    , pmf_ExtractBits_ (&StringBitIter::ExtractBitsBigEndian_)
+    : str_            (str)
+    , p_Char_         (str_.PointerToFirstByte())
+    , p_End_          (p_Char_ + str_.Length())
+    , u_Bits_         (0)
+    , u_NumBits_      (0)
+    , b_LittleEndian_ (false)
 {
     // nothing
 }
 
 inline void StringBitIter::SetBigEndian ()
 {
-    pmf_ExtractBits_ = &StringBitIter::ExtractBitsBigEndian_;
+    SetByteOrder_ (false);
 }
 
 inline void StringBitIter::SetLittleEndian ()
 {
-    pmf_ExtractBits_ = &StringBitIter::ExtractBitsLittleEndian_;
+    SetByteOrder_ (true);
 }
 
 inline bool StringBitIter::ExtractBits (uintsys u_NumBits, uintsys& u,
                                         ParseError& error)
 {
-    return (this->*pmf_ExtractBits_) (u_NumBits, u, error);
+    if (u_NumBits > u_NumBits_)
+    {
+        if ((u_NumBits > MAX_EXTRACT_BITS) ||
+            (u_NumBits > NumberOfBits<uintsys>()))
+        {
+            u = 0;
+
+            error.SetNumericOverflow();
+
+            return false;
+        }
+
+        Refill_();
+
+        if (u_NumBits > u_NumBits_)
+        {
+            u = 0;
+
+            error.SetUnexpectedEndOfData();
+
+            return false;
+        }
+    }
+
+    if (u_NumBits == 0)
+    {
+        u = 0;
+    }
+    else if (b_LittleEndian_)
+    {
+        u = (uintsys) (u_Bits_ & (~(uint64) 0 >> (64 - u_NumBits)));
+
+        u_Bits_ >>= u_NumBits;
+    }
+    else
+    {
+        u = (uintsys) (u_Bits_ >> (64 - u_NumBits));
+
+        u_Bits_ <<= u_NumBits;
+    }
+
+    u_NumBits_ -= u_NumBits;
+
+    return true;
 }
 
 inline StringBitIter::operator bool () const
 {
-    return iter_.IsValid();
+    return ((u_NumBits_ > 0) || (p_Char_ < p_End_));
 }
 
 } // namespace mikestoolbox
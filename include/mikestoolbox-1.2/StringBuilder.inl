@@ -0,0 +1,187 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       StringBuilder.inl
+//
+//  Synopsis:   Implementation of inline StringBuilder methods
+//----------------------------------------------------------------------------
+
+namespace mikestoolbox {
+
+inline StringBuilder::StringBuilder ()
+    : strl_Pieces_ ()
+    , u_Length_    (0)
+    , b_OwnTail_   (false)
+{
+    // nothing
+}
+
+inline StringBuilder::StringBuilder (const String& str)
+    : strl_Pieces_ ()
+    , u_Length_    (0)
+    , b_OwnTail_   (false)
+{
+    Append (str);
+}
+
+#ifdef HAVE_MOVE_SEMANTICS
+inline StringBuilder& StringBuilder::Append (String&& str)
+{
+    uintsys u_NumChars = str.Length();
+
+    if (String* p_Tail = SmallTail_ (u_NumChars))
+    {
+        p_Tail->Append (str);
+    }
+    else if (u_NumChars != 0)
+    {
+        strl_Pieces_.Append (std::move (str));
+
+        b_OwnTail_ = (u_NumChars < STRING_BUILDER_SMALL_PIECE);
+    }
+
+    u_Length_ += u_NumChars;
+
+    return *this;
+}
+#endif
+
+inline StringBuilder& StringBuilder::Append (char c)
+{
+    if (String* p_Tail = SmallTail_ (1))
+    {
+        p_Tail->Append (c);
+    }
+    else
+    {
+        strl_Pieces_.Append (c);
+
+        b_OwnTail_ = true;
+    }
+
+    ++u_Length_;
+
+    return *this;
+}
+
+inline StringBuilder& StringBuilder::Clear ()
+{
+    strl_Pieces_.Clear();
+
+    u_Length_  = 0;
+    b_OwnTail_ = false;
+
+    return *this;
+}
+
+inline bool StringBuilder::IsEmpty () const
+{
+    return u_Length_ == 0;
+}
+
+inline uintsys StringBuilder::Length () const
+{
+    return u_Length_;
+}
+
+inline uintsys StringBuilder::NumPieces () const
+{
+    return strl_Pieces_.NumItems();
+}
+
+inline const StringList& StringBuilder::Pieces () const
+{
+    return strl_Pieces_;
+}
+
+inline StringBuilder& StringBuilder::Prepend (const char* pz)
+{
+    return Prepend (String (pz));
+}
+
+inline void StringBuilder::Swap (StringBuilder& sb)
+{
+    strl_Pieces_.Swap (sb.strl_Pieces_);
+
+    std::swap (u_Length_,  sb.u_Length_);
+    std::swap (b_OwnTail_, sb.b_OwnTail_);
+}
+
+inline void swap (StringBuilder& sb1, StringBuilder& sb2)
+{
+    sb1.Swap (sb2);
+}
+
+inline StringBuilder& StringBuilder::operator+= (const StringBuilder& sb)
+{
+    return Append (sb);
+}
+
+inline StringBuilder& StringBuilder::operator+= (const String& str)
+{
+    return Append (str);
+}
+
+inline StringBuilder& StringBuilder::operator+= (const char* pz)
+{
+    return Append (pz);
+}
+
+inline StringBuilder& StringBuilder::operator+= (char c)
+{
+    return Append (c);
+}
+
+inline std::ostream& operator<< (std::ostream& os, const StringBuilder& sb)
+{
+    StringListIter iter (sb.Pieces());
+
+    while (iter)
+    {
+        os << *iter;
+
+        ++iter;
+    }
+
+    return os;
+}
+
+} // namespace mikestoolbox
@@ -67,6 +67,13 @@ inline void StringList::Append (const String& str)
     Base::Append (str);
 }
 
+#ifdef HAVE_MOVE_SEMANTICS
+inline void StringList::Append (String&& str)
+{
+    Base::Append (std::move (str));
+}
+#endif
+
 inline void StringList::AppendNonEmpty (const String& str)
 {
     if (!str.IsEmpty())
@@ -191,6 +198,20 @@ inline StringList::StringList ()
     // nothing
 }
 
+inline StringList::StringList (const StringList& strl)
+    : Base (strl)
+{
+    // nothing
+}
+
+#ifdef HAVE_MOVE_SEMANTICS
+inline StringList::StringList (StringList&& strl) noexcept
+    : Base (static_cast<Base&&> (strl))
+{
+    // nothing
+}
+#endif
+
 template<typename CONTAINER>
 inline StringList& StringList::operator= (const CONTAINER& c)
 {
@@ -210,6 +231,17 @@ inline StringList& StringList::operator= (const StringList& strl)
     return *this;
 }
 
+#ifdef HAVE_MOVE_SEMANTICS
+inline StringList& StringList::operator= (StringList&& strl) noexcept
+{
+    StringList strl_Old (std::move (strl));
+
+    Swap (strl_Old);
+
+    return *this;
+}
+#endif
+
 inline StringList& StringList::operator= (const String& str)
 {
     StringList strl (str);
@@ -259,6 +291,11 @@ inline const String StringList::Base64Decode () const
     return Join().Base64Decode();
 }
 
+inline const String StringList::Base64Decode (ParseError& error) const
+{
+    return Join().Base64Decode (error);
+}
+
 inline const String StringList::Base64Encode (uintsys u_LineLength) const
 {
     return Join().Base64Encode (u_LineLength);
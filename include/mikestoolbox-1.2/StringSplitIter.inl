@@ -0,0 +1,224 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+//+---------------------------------------------------------------------------
+//  File:       StringSplitIter.inl
+//
+//  Synopsis:   Inline methods for the split, line and shell iterators
+//----------------------------------------------------------------------------
+
+namespace mikestoolbox {
+
+inline StringSplitIter::StringSplitIter (const StringView& view,
+                                         char c_SplitChar,
+                                         uintsys u_MaxStrings, bool b_Case)
+    : view_          (view)
+    , view_Piece_    ()
+    , view_Pattern_  ()
+    , p_Regex_       (0)
+    , u_Offset_      (0)
+    , u_Remaining_   (0)
+    , uc_SplitChar_  ((uchar) c_SplitChar)
+    , b_SplitChar_   (true)
+    , b_Case_        (b_Case)
+    , b_Last_        (false)
+    , b_Valid_       (false)
+{
+    Start_ (u_MaxStrings);
+}
+
+inline StringSplitIter::StringSplitIter (const StringView& view,
+                                         const StringView& view_Pattern,
+                                         uintsys u_MaxStrings, bool b_Case)
+    : view_          (view)
+    , view_Piece_    ()
+    , view_Pattern_  (view_Pattern)
+    , p_Regex_       (0)
+    , u_Offset_      (0)
+    , u_Remaining_   (0)
+    , uc_SplitChar_  (0)
+    , b_SplitChar_   (false)
+    , b_Case_        (b_Case)
+    , b_Last_        (false)
+    , b_Valid_       (false)
+{
+    Start_ (u_MaxStrings);
+}
+
+inline StringSplitIter::StringSplitIter (const StringView& view,
+                                         const String& str_Pattern,
+                                         uintsys u_MaxStrings, bool b_Case)
+    : view_          (view)
+    , view_Piece_    ()
+    , view_Pattern_  (str_Pattern)
+    , p_Regex_       (0)
+    , u_Offset_      (0)
+    , u_Remaining_   (0)
+    , uc_SplitChar_  (0)
+    , b_SplitChar_   (false)
+    , b_Case_        (b_Case)
+    , b_Last_        (false)
+    , b_Valid_       (false)
+{
+    Start_ (u_MaxStrings);
+}
+
+inline StringSplitIter::StringSplitIter (const StringView& view,
+                                         const char* pz_Pattern,
+                                         uintsys u_MaxStrings, bool b_Case)
+    : view_          (view)
+    , view_Piece_    ()
+    , view_Pattern_  (pz_Pattern)
+    , p_Regex_       (0)
+    , u_Offset_      (0)
+    , u_Remaining_   (0)
+    , uc_SplitChar_  (0)
+    , b_SplitChar_   (false)
+    , b_Case_        (b_Case)
+    , b_Last_        (false)
+    , b_Valid_       (false)
+{
+    Start_ (u_MaxStrings);
+}
+
+inline StringSplitIter::StringSplitIter (const StringView& view,
+                                         const PerlRegex& rex_Pattern,
+                                         uintsys u_MaxStrings)
+    : view_          (view)
+    , view_Piece_    ()
+    , view_Pattern_  ()
+    , p_Regex_       (&rex_Pattern)
+    , u_Offset_      (0)
+    , u_Remaining_   (0)
+    , uc_SplitChar_  (0)
+    , b_SplitChar_   (false)
+    , b_Case_        (true)
+    , b_Last_        (false)
+    , b_Valid_       (false)
+{
+    Start_ (u_MaxStrings);
+}
+
+inline bool StringSplitIter::IsValid () const
+{
+    return b_Valid_;
+}
+
+inline uintsys StringSplitIter::Offset () const
+{
+    return view_Piece_.PointerToFirstByte() - view_.PointerToFirstByte();
+}
+
+inline StringSplitIter& StringSplitIter::operator++ ()
+{
+    Advance_();
+
+    return *this;
+}
+
+inline const StringView& StringSplitIter::operator* () const
+{
+    return view_Piece_;
+}
+
+inline const StringView* StringSplitIter::operator-> () const
+{
+    return &view_Piece_;
+}
+
+inline StringSplitIter::operator bool () const
+{
+    return b_Valid_;
+}
+
+inline StringLineIter::StringLineIter (const StringView& view)
+    : view_Rest_ (view)
+    , view_Line_ ()
+    , b_Valid_   (false)
+{
+    operator++();
+}
+
+inline bool StringLineIter::IsValid () const
+{
+    return b_Valid_;
+}
+
+inline StringLineIter& StringLineIter::operator++ ()
+{
+    b_Valid_ = !view_Rest_.IsEmpty();
+
+    if (b_Valid_)
+    {
+        intsys n_Newline = view_Rest_.FindFirst ('\n');
+
+        uintsys u_Length = (n_Newline < 0) ? view_Rest_.Length()
+                                           : (uintsys) n_Newline + 1;
+
+        view_Line_ = view_Rest_.Head (u_Length);
+
+        view_Rest_.EraseFront (u_Length);
+    }
+
+    return *this;
+}
+
+inline const StringView& StringLineIter::operator* () const
+{
+    return view_Line_;
+}
+
+inline const StringView* StringLineIter::operator-> () const
+{
+    return &view_Line_;
+}
+
+inline StringLineIter::operator bool () const
+{
+    return b_Valid_;
+}
+
+inline ShellParseIter::ShellParseIter (const StringView& view)
+    : p_Char_ (view.PointerToFirstByte())
+    , p_End_  (p_Char_ + view.Length())
+{
+    // nothing
+}
+
+} // namespace mikestoolbox
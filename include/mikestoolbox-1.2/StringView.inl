@@ -0,0 +1,323 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+//+---------------------------------------------------------------------------
+//  File:       StringView.inl
+//
+//  Synopsis:   Inline methods for the StringView class
+//----------------------------------------------------------------------------
+
+namespace mikestoolbox {
+
+inline StringView::StringView (const String& str, bool b_Share)
+    : p_Start_  (str.PointerToFirstByte())
+    , u_Length_ (str.Length())
+    , mem_      ()
+{
+    if (b_Share)
+    {
+        mem_ = str.mem_;
+    }
+}
+
+inline StringView::StringView (const char* ps, uintsys u_NumBytes)
+    : p_Start_  ((const uchar*)ps)
+    , u_Length_ (u_NumBytes)
+    , mem_      ()
+{
+    // nothing
+}
+
+inline StringView::StringView (const uchar* ps, uintsys u_NumBytes)
+    : p_Start_  (ps)
+    , u_Length_ (u_NumBytes)
+    , mem_      ()
+{
+    // nothing
+}
+
+inline StringView::StringView (const char* pz)
+    : p_Start_  ((const uchar*)pz)
+    , u_Length_ (std::strlen (pz))
+    , mem_      ()
+{
+    // nothing
+}
+
+inline StringView::StringView ()
+    : p_Start_  ((const uchar*)"")
+    , u_Length_ (0)
+    , mem_      ()
+{
+    // nothing
+}
+
+inline StringView::StringView (const StringView& view, uintsys u_Offset,
+                               uintsys u_NumBytes)
+    : p_Start_  (view.p_Start_ + u_Offset)
+    , u_Length_ (u_NumBytes)
+    , mem_      (view.mem_)
+{
+    // nothing
+}
+
+inline double StringView::AsDouble () const
+{
+    double d = 0.0;
+
+    Number::ParseDouble (PointerToFirstChar(), u_Length_, d);
+
+    return d;
+}
+
+inline intsys StringView::AsInt () const
+{
+    int64 n = 0;
+
+    Number::ParseInt (PointerToFirstChar(), u_Length_, n);
+
+    return (intsys) n;
+}
+
+inline uintsys StringView::AsUint () const
+{
+    uint64 u = 0;
+
+    Number::ParseUint (PointerToFirstChar(), u_Length_, u);
+
+    return (uintsys) u;
+}
+
+inline bool StringView::Contains (const StringView& view, bool b_Case) const
+{
+    return (FindFirst (view, 0, b_Case) >= 0);
+}
+
+inline bool StringView::Contains (const String& str, bool b_Case) const
+{
+    return Contains (StringView (str), b_Case);
+}
+
+inline bool StringView::Contains (const char* pz, bool b_Case) const
+{
+    return Contains (StringView (pz), b_Case);
+}
+
+inline bool StringView::Contains (char c, bool b_Case) const
+{
+    return (FindFirst (c, 0, b_Case) >= 0);
+}
+
+inline bool StringView::EndsWith (const StringView& view, bool b_Case) const
+{
+    uintsys u_SuffixLength = view.u_Length_;
+
+    if (u_Length_ < u_SuffixLength)
+    {
+        return false;
+    }
+
+    const uchar* p_Suffix = p_Start_ + u_Length_ - u_SuffixLength;
+
+    return (StringCompare (p_Suffix, view.p_Start_, u_SuffixLength,
+                           b_Case) == 0);
+}
+
+inline void StringView::EraseEnd (uintsys u_NumChars)
+{
+    u_Length_ -= Minimum (u_NumChars, u_Length_);
+}
+
+inline void StringView::EraseFront (uintsys u_NumChars)
+{
+    u_NumChars = Minimum (u_NumChars, u_Length_);
+
+    p_Start_  += u_NumChars;
+    u_Length_ -= u_NumChars;
+}
+
+inline intsys StringView::FindFirst (const String& str, const Index& offset,
+                                     bool b_Case) const
+{
+    return FindFirst (StringView (str), offset, b_Case);
+}
+
+inline intsys StringView::FindFirst (const char* pz, const Index& offset,
+                                     bool b_Case) const
+{
+    return FindFirst (StringView (pz), offset, b_Case);
+}
+
+inline intsys StringView::FindLast (const String& str, const Index& offset,
+                                    bool b_Case) const
+{
+    return FindLast (StringView (str), offset, b_Case);
+}
+
+inline intsys StringView::FindLast (const char* pz, const Index& offset,
+                                    bool b_Case) const
+{
+    return FindLast (StringView (pz), offset, b_Case);
+}
+
+inline char StringView::FirstChar () const
+{
+    return operator[] (0);
+}
+
+inline char StringView::LastChar () const
+{
+    return operator[] (u_Length_ - 1);
+}
+
+inline const StringView StringView::Head (uintsys u_NumChars) const
+{
+    return StringView (*this, 0, Minimum (u_NumChars, u_Length_));
+}
+
+inline bool StringView::IsEmpty () const
+{
+    return (u_Length_ == 0);
+}
+
+inline uintsys StringView::Length () const
+{
+    return u_Length_;
+}
+
+inline const char* StringView::PointerToFirstChar () const
+{
+    return (const char*) p_Start_;
+}
+
+inline const uchar* StringView::PointerToFirstByte () const
+{
+    return p_Start_;
+}
+
+inline const StringViewList
+    StringView::Split (const String& str_Pattern, uintsys u_MaxStrings,
+                       bool b_Case) const
+{
+    return Split (StringView (str_Pattern), u_MaxStrings, b_Case);
+}
+
+inline const StringViewList
+    StringView::Split (const char* pz_Pattern, uintsys u_MaxStrings,
+                       bool b_Case) const
+{
+    return Split (StringView (pz_Pattern), u_MaxStrings, b_Case);
+}
+
+inline const StringViewList
+    StringView::Split (char c_SplitChar, uintsys u_MaxStrings,
+                       bool b_Case) const
+{
+    return Split (StringView (&c_SplitChar, 1), u_MaxStrings, b_Case);
+}
+
+inline bool StringView::StartsWith (const StringView& view, bool b_Case) const
+{
+    uintsys u_PrefixLength = view.u_Length_;
+
+    if (u_Length_ < u_PrefixLength)
+    {
+        return false;
+    }
+
+    return (StringCompare (p_Start_, view.p_Start_, u_PrefixLength,
+                           b_Case) == 0);
+}
+
+inline const StringView StringView::Tail (uintsys u_NumChars) const
+{
+    u_NumChars = Minimum (u_NumChars, u_Length_);
+
+    return StringView (*this, u_Length_ - u_NumChars, u_NumChars);
+}
+
+inline char StringView::operator[] (uintsys u_Index) const
+{
+    if (u_Index >= u_Length_)
+    {
+        throw Exception ("StringView::operator[]: index out of range");
+    }
+
+    return (char) p_Start_[u_Index];
+}
+
+inline bool StringView::operator== (const StringView& view) const
+{
+    return (u_Length_ == view.u_Length_) &&
+           (std::memcmp (p_Start_, view.p_Start_, u_Length_) == 0);
+}
+
+inline bool StringView::operator!= (const StringView& view) const
+{
+    return !operator== (view);
+}
+
+inline bool StringView::operator< (const StringView& view) const
+{
+    return (Compare (view) < 0);
+}
+
+inline bool StringView::operator<= (const StringView& view) const
+{
+    return (Compare (view) <= 0);
+}
+
+inline bool StringView::operator> (const StringView& view) const
+{
+    return (Compare (view) > 0);
+}
+
+inline bool StringView::operator>= (const StringView& view) const
+{
+    return (Compare (view) >= 0);
+}
+
+inline std::ostream& operator<< (std::ostream& os, const StringView& view)
+{
+    os.write (view.PointerToFirstChar(), view.Length());
+
+    return os;
+}
+
+} // namespace mikestoolbox
@@ -51,6 +51,19 @@ inline bool Thread::IsRunning () const
     return b_Running_;
 }
 
+//+---------------------------------------------------------------------------
+//  Method:     HasExited
+//
+//  Synopsis:   Returns true once the thread has finished, whether or not
+//              Main_ was called.  The thread no longer touches the object
+//              after this, so it may be deleted.
+//----------------------------------------------------------------------------
+
+inline bool Thread::HasExited () const
+{
+    return b_Exited_.Load();
+}
+
 inline intsys Thread::ExitCode () const
 {
     return n_ExitCode_;
@@ -85,6 +98,21 @@ inline void Thread::Stop ()
     Stop_();
 }
 
+inline String Thread::Name () const
+{
+    return str_Name_;
+}
+
+inline void Thread::SetDefaultStackSize (uintsys u_StackSize)
+{
+    u_DefaultStackSize_ = u_StackSize;
+}
+
+inline bool Thread::SetAffinity (uintsys u_Processor)
+{
+    return SetAffinity (List<uintsys> (u_Processor));
+}
+
 inline double Thread::ElapsedTime () const
 {
     if (IsRunning())
@@ -101,7 +129,7 @@ inline double Thread::ElapsedTime () const
 
 #ifdef SINGLE_THREADED
 
-inline Thread::Thread ()
+inline Thread::Thread (uintsys)
 #ifdef PLATFORM_WINDOWS
     : dw_ThreadId_   (0)
     , b_Running_     (false)
@@ -110,12 +138,17 @@ inline Thread::Thread ()
 #endif
     , b_ShouldStop_  (false)
     , n_Priority_    (THREAD_PRIORITY_NORMAL)
+    , n_NumaNode_    (-1)
     , n_ExitCode_    (internal::gn_SingleThreadedZero)
     , b_Exception_   (false)
     , str_Exception_ ()
+    , str_Name_      ()
     , cond_Startup_  ()
     , date_Start_    (time(0))
     , date_Stop_     (date_Start_)
+    , n_SystemId_    (0)
+    , b_Exited_      (false)
+    , p_Result_      (new Promise<intsys>)
 {
     // nothing
 }
@@ -124,21 +157,33 @@ inline Thread::Thread ()
 
 #ifdef PLATFORM_UNIX
 
-inline Thread::Thread ()
+inline Thread::Thread (uintsys u_StackSize)
     : h_Thread_      ()
     , b_Running_     (false)
     , b_ShouldStop_  (false)
     , n_Priority_    (THREAD_PRIORITY_NORMAL)
+    , n_NumaNode_    (-1)
     , n_ExitCode_    (internal::gn_MultiThreadedZero)
     , b_Exception_   (false)
     , str_Exception_ ()
+    , str_Name_      ()
     , cond_Startup_  ()
     , date_Start_    (time(0))
     , date_Stop_     (date_Start_)
+    , n_SystemId_    (0)
+    , b_Exited_      (false)
+    , p_Result_      (new Promise<intsys>)
+    , mutex_Handle_  ()
+    , b_Finished_    (false)
 {
-    if (pthread_create (&h_Thread_, 0, Thread::ThreadMain_, this) != 0)
+    try
     {
-        throw Exception ("Thread: Failed to create thread");
+        Create_ (u_StackSize);
+    }
+    catch (...)
+    {
+        delete p_Result_;
+        throw;
     }
 }
 
@@ -146,25 +191,32 @@ inline Thread::Thread ()
 
 #ifdef PLATFORM_WINDOWS
 
-inline Thread::Thread ()
+inline Thread::Thread (uintsys u_StackSize)
     : h_Thread_      (0)
     , dw_ThreadId_   (0)
     , b_Running_     (false)
     , b_ShouldStop_  (false)
     , n_Priority_    (THREAD_PRIORITY_NORMAL)
+    , n_NumaNode_    (-1)
     , n_ExitCode_    (internal::gn_MultiThreadedZero)
     , b_Exception_   (false)
     , str_Exception_ ()
+    , str_Name_      ()
     , cond_Startup_  ()
     , date_Start_    (time(0))
     , date_Stop_     (date_Start_)
+    , n_SystemId_    (0)
+    , b_Exited_      (false)
+    , p_Result_      (new Promise<intsys>)
 {
-    h_Thread_ = CreateThread (0, 0, Thread::ThreadMain_, (void*)this, 0,
-                              &dw_ThreadId_);
-
-    if (h_Thread_ == 0)
+    try
+    {
+        Create_ (u_StackSize);
+    }
+    catch (...)
     {
-        throw Exception ("Thread: Failed to create thread");
+        delete p_Result_;
+        throw;
     }
 }
 
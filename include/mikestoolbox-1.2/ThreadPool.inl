@@ -0,0 +1,294 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       ThreadPool.inl
+//
+//  Synopsis:   Implementation of inline Task, TaskHandle and TaskDeque
+//              methods
+//----------------------------------------------------------------------------
+
+namespace mikestoolbox {
+
+inline Task::Task ()
+    : u_References_  (0)
+    , b_Done_        (false)
+    , b_Exception_   (false)
+    , str_Exception_ ()
+    , p_Pool_        (0)
+{
+    // nothing
+}
+
+inline bool Task::IsDone () const
+{
+    return b_Done_.Load();
+}
+
+inline bool Task::ExceptionCaught () const
+{
+    return IsDone() && b_Exception_;
+}
+
+inline String Task::ExceptionMessage () const
+{
+    return IsDone() ? str_Exception_ : String();
+}
+
+inline void Task::AddReference_ ()
+{
+    u_References_.Increment();
+}
+
+inline void Task::Release_ ()
+{
+    if (u_References_.Decrement() == 0)
+    {
+        delete this;
+    }
+}
+
+inline FunctionTask::FunctionTask (TaskFunction func, void* p_Arg)
+    : func_  (func)
+    , p_Arg_ (p_Arg)
+{
+    // nothing
+}
+
+inline Executor::Executor ()
+{
+    // nothing
+}
+
+inline InlineExecutor::InlineExecutor ()
+{
+    // nothing
+}
+
+inline void InlineExecutor::Execute (Task* p_Task)
+{
+    RunTask_ (p_Task);
+}
+
+inline TaskHandle::TaskHandle ()
+    : p_Task_ (0)
+{
+    // nothing
+}
+
+inline TaskHandle::TaskHandle (Task* p_Task)
+    : p_Task_ (p_Task)
+{
+    p_Task_->AddReference_();
+}
+
+inline TaskHandle::TaskHandle (const TaskHandle& handle)
+    : p_Task_ (handle.p_Task_)
+{
+    if (p_Task_ != 0)
+    {
+        p_Task_->AddReference_();
+    }
+}
+
+inline TaskHandle::~TaskHandle ()
+{
+    if (p_Task_ != 0)
+    {
+        p_Task_->Release_();
+    }
+}
+
+inline TaskHandle& TaskHandle::operator= (const TaskHandle& handle)
+{
+    if (handle.p_Task_ != 0)
+    {
+        handle.p_Task_->AddReference_();
+    }
+
+    if (p_Task_ != 0)
+    {
+        p_Task_->Release_();
+    }
+
+    p_Task_ = handle.p_Task_;
+
+    return *this;
+}
+
+inline bool TaskHandle::IsValid () const
+{
+    return p_Task_ != 0;
+}
+
+inline bool TaskHandle::IsDone () const
+{
+    return (p_Task_ == 0) || p_Task_->IsDone();
+}
+
+inline void TaskHandle::Wait () const
+{
+    Wait (WAIT_FOREVER);
+}
+
+inline bool TaskHandle::ExceptionCaught () const
+{
+    return (p_Task_ != 0) && p_Task_->ExceptionCaught();
+}
+
+inline String TaskHandle::ExceptionMessage () const
+{
+    return (p_Task_ != 0) ? p_Task_->ExceptionMessage() : String();
+}
+
+inline TaskDeque::TaskDeque (uintsys u_Capacity)
+    : ap_Tasks_ (new Atomic<Task*>[QueueCapacity (u_Capacity)])
+    , n_Mask_   (QueueCapacity (u_Capacity) - 1)
+    , n_Top_    (0)
+    , n_Bottom_ (0)
+{
+    // nothing
+}
+
+inline TaskDeque::~TaskDeque ()
+{
+    delete [] ap_Tasks_;
+}
+
+inline bool TaskDeque::IsEmpty () const
+{
+    return n_Bottom_.Load() <= n_Top_.Load();
+}
+
+inline bool TaskDeque::Push (Task* p_Task)
+{
+    intsys n_Bottom = n_Bottom_.LoadRelaxed();
+
+    if (n_Bottom - n_Top_.Load() > n_Mask_)
+    {
+        return false;
+    }
+
+    ap_Tasks_[n_Bottom & n_Mask_].StoreRelaxed (p_Task);
+
+    n_Bottom_.Store (n_Bottom + 1);
+
+    return true;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Pop
+//
+//  Synopsis:   Takes the most recently pushed task.  Only the last task in
+//              the deque can be contended, and a thief and the owner then
+//              race for it on the top index.
+//----------------------------------------------------------------------------
+
+inline Task* TaskDeque::Pop ()
+{
+    intsys n_Bottom = n_Bottom_.LoadRelaxed() - 1;
+
+    n_Bottom_.StoreRelaxed (n_Bottom);
+
+    AtomicFence();
+
+    intsys n_Top = n_Top_.LoadRelaxed();
+
+    if (n_Top > n_Bottom)
+    {
+        n_Bottom_.StoreRelaxed (n_Bottom + 1);
+
+        return 0;
+    }
+
+    Task* p_Task = ap_Tasks_[n_Bottom & n_Mask_].LoadRelaxed();
+
+    if (n_Top == n_Bottom)
+    {
+        if (!n_Top_.CompareExchange (n_Top, n_Top + 1))
+        {
+            p_Task = 0;
+        }
+
+        n_Bottom_.StoreRelaxed (n_Bottom + 1);
+    }
+
+    return p_Task;
+}
+
+inline Task* TaskDeque::Steal ()
+{
+    intsys n_Top = n_Top_.Load();
+
+    AtomicFence();
+
+    intsys n_Bottom = n_Bottom_.Load();
+
+    if (n_Top >= n_Bottom)
+    {
+        return 0;
+    }
+
+    Task* p_Task = ap_Tasks_[n_Top & n_Mask_].LoadRelaxed();
+
+    if (!n_Top_.CompareExchange (n_Top, n_Top + 1))
+    {
+        return 0;   // lost the race to another thief or the owner
+    }
+
+    return p_Task;
+}
+
+inline uintsys ThreadPool::NumThreads () const
+{
+    return u_NumThreads_;
+}
+
+inline bool ThreadPool::IsStopped () const
+{
+    return b_Stopped_.Load();
+}
+
+inline TaskHandle ThreadPool::Submit (TaskFunction func, void* p_Arg)
+{
+    return Submit (new FunctionTask (func, p_Arg));
+}
+
+} // namespace mikestoolbox
@@ -42,6 +42,35 @@
 
 using namespace mikestoolbox;
 
+//  Streams the file through the decoder a chunk at a time, so that memory
+//  use doesn't grow with the size of the file
+
+static bool Decode (FileReader& input, const String& str_Output)
+{
+    File (str_Output).Delete();
+
+    FileWriter output (str_Output);
+
+    output.SetBufferSize (FILE_READER_CHUNK_SIZE);
+    output.SetFlushInterval (0);
+
+    Base64Decoder decoder;
+
+    String str_Chunk;
+
+    while (input.Read (str_Chunk))
+    {
+        if (!output.Append (decoder.Update (str_Chunk)))
+        {
+            return false;
+        }
+    }
+
+    return input.IsAtEnd() &&
+           output.Append (decoder.Finish()) &&
+           output.Close();
+}
+
 int main (int argc, char** argv )
 {
     StringList strl_Argv (argc, argv);
@@ -51,24 +80,24 @@ int main (int argc, char** argv )
     while (!strl_Argv.IsEmpty())
     {
         String str_Filename (strl_Argv.Shift());
-        String str_Contents;
 
-        File input (str_Filename);
+        FileReader input (str_Filename);
 
-        if (input.Read (str_Contents))
+        if (!input.IsOpen())
         {
-            if (str_Filename.Replace ("\\.b64$", "") < 0)
-            {
-                str_Filename += ".decoded";
-            }
-
-            File output (str_Filename);
+            std::cerr << "Couldn't open file: " << str_Filename << std::endl;
+            continue;
+        }
 
-            output.Write (str_Contents.Base64Decode());
+        if (str_Filename.Replace ("\\.b64$", "") < 0)
+        {
+            str_Filename += ".decoded";
         }
-        else
+
+        if (!Decode (input, str_Filename))
         {
-            std::cerr << "Couldn't open file: " << str_Filename << std::endl;
+            std::cerr << "Couldn't decode file: " << input.Name()
+                      << std::endl;
         }
     }
 
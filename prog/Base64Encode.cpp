@@ -42,6 +42,35 @@
 
 using namespace mikestoolbox;
 
+//  Streams the file through the encoder a chunk at a time, so that memory
+//  use doesn't grow with the size of the file
+
+static bool Encode (FileReader& input, const String& str_Output)
+{
+    File (str_Output).Delete();
+
+    FileWriter output (str_Output);
+
+    output.SetBufferSize (FILE_READER_CHUNK_SIZE);
+    output.SetFlushInterval (0);
+
+    Base64Encoder encoder (76);
+
+    String str_Chunk;
+
+    while (input.Read (str_Chunk))
+    {
+        if (!output.Append (encoder.Update (str_Chunk)))
+        {
+            return false;
+        }
+    }
+
+    return input.IsAtEnd() &&
+           output.Append (encoder.Finish()) &&
+           output.Close();
+}
+
 int main (int argc, char** argv )
 {
     StringList strl_Argv (argc, argv);
@@ -51,19 +80,17 @@ int main (int argc, char** argv )
     while (!strl_Argv.IsEmpty())
     {
         String str_Filename (strl_Argv.Shift());
-        String str_Contents;
 
-        File input (str_Filename);
+        FileReader input (str_Filename);
 
-        if (input.Read (str_Contents))
+        if (!input.IsOpen())
         {
-            File output (str_Filename + ".b64");
-
-            output.Write (str_Contents.Base64Encode (76));
+            std::cerr << "Couldn't open file: " << str_Filename << std::endl;
         }
-        else
+        else if (!Encode (input, str_Filename + ".b64"))
         {
-            std::cerr << "Couldn't open file: " << str_Filename << std::endl;
+            std::cerr << "Couldn't encode file: " << str_Filename
+                      << std::endl;
         }
     }
 
@@ -0,0 +1,101 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       AdaptiveMutex.cpp
+//
+//  Synopsis:   Implementation of AdaptiveMutex class
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+namespace mikestoolbox {
+
+//+---------------------------------------------------------------------------
+//  Method:     LockSlow_
+//
+//  Synopsis:   Spins while the holder is likely to release the lock soon,
+//              then sleeps.  The spin limit follows the number of spins
+//              that recent successful waits needed.
+//
+//  Notes:      A sleeper marks the lock LOCKED_WITH_SLEEPERS so that
+//              Unlock() knows to signal.  A stale signal only costs an
+//              extra trip around the loop.
+//----------------------------------------------------------------------------
+
+void AdaptiveMutex::LockSlow_ () const
+{
+#ifdef SINGLE_THREADED
+    throw Exception ("AdaptiveMutex::Lock: Mutex is already locked");
+#else
+    intsys n_Average = u_Spins_.LoadRelaxed();
+    uint32 u_Limit   = Minimum (uint32 (2 * n_Average + 16), u_MaxSpins_);
+
+    for (uint32 u = 0; u < u_Limit; ++u)
+    {
+        CpuRelax();
+
+        if (u_State_.LoadRelaxed() == UNLOCKED)
+        {
+            uint32 u_Expected = UNLOCKED;
+
+            if (u_State_.CompareExchange (u_Expected, LOCKED))
+            {
+                intsys n_Spins = n_Average + (intsys(u) - n_Average) / 8;
+
+                u_Spins_.StoreRelaxed (uint32 (n_Spins));
+
+                return;
+            }
+        }
+    }
+
+    intsys n_Spins = n_Average + (intsys(u_Limit) - n_Average) / 8;
+
+    u_Spins_.StoreRelaxed (uint32 (n_Spins));
+
+    while (u_State_.Exchange (LOCKED_WITH_SLEEPERS) != UNLOCKED)
+    {
+        cond_.Wait();
+    }
+#endif
+}
+
+} // namespace mikestoolbox
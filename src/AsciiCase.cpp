@@ -0,0 +1,402 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       AsciiCase.cpp
+//
+//  Synopsis:   Implementation of AsciiCase methods
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+#ifdef HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef HAVE_AVX2
+#include <immintrin.h>
+#endif
+
+namespace mikestoolbox {
+
+const uint64 gu_Ones = 0x0101010101010101ULL;
+const uint64 gu_High = 0x8080808080808080ULL;
+
+static inline uintsys LowestBit (uint32 u_Mask)
+{
+#ifdef __GNUC__
+    return __builtin_ctz (u_Mask);
+#else
+    uintsys u_Bit = 0;
+
+    while ((u_Mask & 1) == 0)
+    {
+        u_Mask >>= 1;
+        ++u_Bit;
+    }
+
+    return u_Bit;
+#endif
+}
+
+static inline uint64 LoadWord (const uchar* p)
+{
+    uint64 u = 0;
+
+    std::memcpy (&u, p, 8);
+
+    return u;
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   FlipWord
+//
+//  Synopsis:   Flips the case of every byte of the word between uc_First
+//              and uc_Last, eight at a time
+//
+//  Notes:      With the high bits cleared no byte can carry into the next,
+//              so adding 0x80 - uc_First sets a byte's high bit when it is
+//              at least uc_First; bytes that had their high bit set to
+//              begin with are never letters
+//----------------------------------------------------------------------------
+
+static inline uint64 FlipWord (uint64 u, uchar uc_First, uchar uc_Last)
+{
+    uint64 u_Low     = u & ~gu_High;
+    uint64 u_AtLeast = u_Low + gu_Ones * (0x80 - uc_First);
+    uint64 u_Above   = u_Low + gu_Ones * (0x80 - uc_Last - 1);
+
+    return u ^ (((u_AtLeast & ~u_Above & ~u) & gu_High) >> 2);
+}
+
+static inline uint64 LowerWord (uint64 u)
+{
+    return FlipWord (u, 'A', 'Z');
+}
+
+static inline uchar FlipByte (uchar uc, uchar uc_First, uchar uc_Last)
+{
+    return ((uc >= uc_First) && (uc <= uc_Last)) ? (uchar) (uc ^ 0x20) : uc;
+}
+
+#ifdef HAVE_SSE2
+
+static inline __m128i FlipSse2 (__m128i v, __m128i v_Below, __m128i v_Above)
+{
+    __m128i v_Letter = _mm_and_si128 (_mm_cmpgt_epi8 (v, v_Below),
+                                      _mm_cmplt_epi8 (v, v_Above));
+
+    return _mm_xor_si128 (v, _mm_and_si128 (v_Letter,
+                                            _mm_set1_epi8 (0x20)));
+}
+
+//+---------------------------------------------------------------------------
+//  Synopsis:   Flips the case of the letters between uc_First and uc_Last
+//              sixteen bytes at a time
+//
+//  Notes:      Bytes from 0x80 up are negative to the signed compares, so
+//              they are never taken for letters
+//----------------------------------------------------------------------------
+
+static inline void ConvertSse2 (const uchar*& p, const uchar* p_End,
+                                uchar*& q, uchar uc_First, uchar uc_Last)
+{
+    __m128i v_Below = _mm_set1_epi8 ((char) (uc_First - 1));
+    __m128i v_Above = _mm_set1_epi8 ((char) (uc_Last + 1));
+
+    for ( ; p_End - p >= 16; p += 16, q += 16)
+    {
+        __m128i v = _mm_loadu_si128 ((const __m128i*) p);
+
+        _mm_storeu_si128 ((__m128i*) q, FlipSse2 (v, v_Below, v_Above));
+    }
+}
+
+//  Returns the offset of the first difference, or the length compared
+
+static inline uintsys CompareSse2 (const uchar* p1, const uchar* p2,
+                                   uintsys u_NumBytes)
+{
+    __m128i v_Below = _mm_set1_epi8 ('A' - 1);
+    __m128i v_Above = _mm_set1_epi8 ('Z' + 1);
+
+    uintsys u = 0;
+
+    for ( ; u_NumBytes - u >= 16; u += 16)
+    {
+        __m128i v1 = _mm_loadu_si128 ((const __m128i*) (p1 + u));
+        __m128i v2 = _mm_loadu_si128 ((const __m128i*) (p2 + u));
+
+        v1 = FlipSse2 (v1, v_Below, v_Above);
+        v2 = FlipSse2 (v2, v_Below, v_Above);
+
+        int n_Same = _mm_movemask_epi8 (_mm_cmpeq_epi8 (v1, v2));
+
+        if (n_Same != 0xFFFF)
+        {
+            return u + LowestBit (~n_Same);
+        }
+    }
+
+    return u;
+}
+
+#endif
+
+#ifdef HAVE_AVX2
+
+__attribute__((target("avx2"), always_inline))
+static inline __m256i FlipAvx2 (__m256i v, __m256i v_Below, __m256i v_Above)
+{
+    __m256i v_Letter = _mm256_and_si256 (_mm256_cmpgt_epi8 (v, v_Below),
+                                         _mm256_cmpgt_epi8 (v_Above, v));
+
+    return _mm256_xor_si256 (v, _mm256_and_si256 (v_Letter,
+                                                  _mm256_set1_epi8 (0x20)));
+}
+
+//+---------------------------------------------------------------------------
+//  Synopsis:   The same thirty-two bytes at a time
+//----------------------------------------------------------------------------
+
+__attribute__((target("avx2"), noinline))
+static void ConvertAvx2 (const uchar*& p, const uchar* p_End, uchar*& q,
+                         uchar uc_First, uchar uc_Last)
+{
+    __m256i v_Below = _mm256_set1_epi8 ((char) (uc_First - 1));
+    __m256i v_Above = _mm256_set1_epi8 ((char) (uc_Last + 1));
+
+    for ( ; p_End - p >= 32; p += 32, q += 32)
+    {
+        __m256i v = _mm256_loadu_si256 ((const __m256i*) p);
+
+        _mm256_storeu_si256 ((__m256i*) q, FlipAvx2 (v, v_Below, v_Above));
+    }
+}
+
+__attribute__((target("avx2"), noinline))
+static uintsys CompareAvx2 (const uchar* p1, const uchar* p2,
+                            uintsys u_NumBytes)
+{
+    __m256i v_Below = _mm256_set1_epi8 ('A' - 1);
+    __m256i v_Above = _mm256_set1_epi8 ('Z' + 1);
+
+    uintsys u = 0;
+
+    for ( ; u_NumBytes - u >= 32; u += 32)
+    {
+        __m256i v1 = _mm256_loadu_si256 ((const __m256i*) (p1 + u));
+        __m256i v2 = _mm256_loadu_si256 ((const __m256i*) (p2 + u));
+
+        v1 = FlipAvx2 (v1, v_Below, v_Above);
+        v2 = FlipAvx2 (v2, v_Below, v_Above);
+
+        uint32 u_Same = _mm256_movemask_epi8 (_mm256_cmpeq_epi8 (v1, v2));
+
+        if (u_Same != 0xFFFFFFFF)
+        {
+            return u + LowestBit (~u_Same);
+        }
+    }
+
+    return u;
+}
+
+#endif
+
+//+---------------------------------------------------------------------------
+//  Function:   Convert
+//
+//  Synopsis:   Flips the case of every letter between uc_First and uc_Last
+//----------------------------------------------------------------------------
+
+static void Convert (const uchar* p, uintsys u_NumBytes, uchar* q,
+                     uchar uc_First, uchar uc_Last)
+{
+    const uchar* p_End = p + u_NumBytes;
+
+    switch (ByteSearch::Engine())
+    {
+#ifdef HAVE_AVX2
+    case BYTE_SEARCH_AVX2:
+        if (u_NumBytes >= 32)
+        {
+            ConvertAvx2 (p, p_End, q, uc_First, uc_Last);
+        }
+        // fall through for the last 16 to 31 bytes
+#endif
+#ifdef HAVE_SSE2
+    case BYTE_SEARCH_SSE2:
+        ConvertSse2 (p, p_End, q, uc_First, uc_Last);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    for ( ; p_End - p >= 8; p += 8, q += 8)
+    {
+        uint64 u = FlipWord (LoadWord (p), uc_First, uc_Last);
+
+        std::memcpy (q, &u, 8);
+    }
+
+    while (p < p_End)
+    {
+        *q++ = FlipByte (*p++, uc_First, uc_Last);
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     ToLower, ToUpper
+//
+//  Synopsis:   Copy the bytes with ASCII letters in one case
+//----------------------------------------------------------------------------
+
+void AsciiCase::ToLower (const uchar* p_In, uintsys u_NumBytes, uchar* p_Out)
+{
+    Convert (p_In, u_NumBytes, p_Out, 'A', 'Z');
+}
+
+void AsciiCase::ToUpper (const uchar* p_In, uintsys u_NumBytes, uchar* p_Out)
+{
+    Convert (p_In, u_NumBytes, p_Out, 'a', 'z');
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Compare
+//
+//  Synopsis:   Compares the bytes as ByteCompareNoCase does, one after the
+//              other, and returns -1, 0 or 1
+//
+//  Notes:      The vectors and words only find the first difference, which
+//              is then compared on its own.  The AVX2 loop is only worth
+//              its call for 32 bytes or more, and leaves the rest to SSE2.
+//----------------------------------------------------------------------------
+
+intsys AsciiCase::Compare (const uchar* p1, const uchar* p2,
+                           uintsys u_NumBytes)
+{
+    uintsys u = 0;
+
+    switch (ByteSearch::Engine())
+    {
+#ifdef HAVE_AVX2
+    case BYTE_SEARCH_AVX2:
+        if (u_NumBytes >= 32)
+        {
+            u = CompareAvx2 (p1, p2, u_NumBytes);
+        }
+        // fall through
+#endif
+#ifdef HAVE_SSE2
+    case BYTE_SEARCH_SSE2:
+        u += CompareSse2 (p1 + u, p2 + u, u_NumBytes - u);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    if (u == u_NumBytes)
+    {
+        return 0;
+    }
+
+    for ( ; u_NumBytes - u >= 8; u += 8)
+    {
+        if (LowerWord (LoadWord (p1 + u)) != LowerWord (LoadWord (p2 + u)))
+        {
+            break;
+        }
+    }
+
+    for ( ; u < u_NumBytes; ++u)
+    {
+        intsys n_Compare = ByteCompareNoCase (p1[u], p2[u]);
+
+        if (n_Compare != 0)
+        {
+            return n_Compare;
+        }
+    }
+
+    return 0;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Hash
+//
+//  Synopsis:   Hashes the bytes with ASCII letters in lower case, a word at
+//              a time
+//
+//  Notes:      Each word is multiplied in and the high half of the product
+//              folded back into the low half, so that every byte reaches
+//              the low bits that a Hash uses to pick a bucket
+//----------------------------------------------------------------------------
+
+uint32 AsciiCase::Hash (const uchar* p, uintsys u_NumBytes)
+{
+    const uint64 u_Mult = 0x9E3779B97F4A7C15ULL;
+
+    uint64 u_Hash = gu_64BitFowlerNollVoHashInit_ ^ u_NumBytes;
+
+    for ( ; u_NumBytes >= 8; p += 8, u_NumBytes -= 8)
+    {
+        u_Hash  = (u_Hash ^ LowerWord (LoadWord (p))) * u_Mult;
+        u_Hash ^= u_Hash >> 32;
+    }
+
+    if (u_NumBytes != 0)
+    {
+        uint64 u = 0;
+
+        std::memcpy (&u, p, u_NumBytes);
+
+        u_Hash  = (u_Hash ^ LowerWord (u)) * u_Mult;
+        u_Hash ^= u_Hash >> 32;
+    }
+
+    u_Hash *= u_Mult;
+
+    return (uint32) (u_Hash ^ (u_Hash >> 32));
+}
+
+} // namespace mikestoolbox
@@ -0,0 +1,891 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       Base64.cpp
+//
+//  Synopsis:   Implementation of Base64 methods
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+#ifdef HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef HAVE_AVX2
+#include <immintrin.h>
+#endif
+
+namespace mikestoolbox {
+
+#define __ 255
+
+static const uchar auc_Base64Decode[256] = {
+    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
+    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
+    __, __, __, __, __, __, __, __, __, __, __, 62, __, __, __, 63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, __, __, __, __, __, __,
+    __,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, __, __, __, __, __,
+    __, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, __, __, __, __, __,
+    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
+    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
+    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
+    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
+    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
+    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
+    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
+    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __
+};
+
+#undef __
+
+static inline uchar Base64Char (uint32 u)
+{
+    return (uchar) gpz_Base64[u & 0x3F];
+}
+
+static inline void WriteGroup (uint32 u_Group, uchar*& q)
+{
+    q[0] = (uchar) (u_Group >> 16);
+    q[1] = (uchar) (u_Group >>  8);
+    q[2] = (uchar)  u_Group;
+
+    q += 3;
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   EncodeGroups
+//
+//  Synopsis:   Encodes as many whole groups of three bytes as there are,
+//              four characters for each
+//----------------------------------------------------------------------------
+
+static inline void EncodeGroups (const uchar*& p, const uchar* p_End,
+                                 uchar*& q)
+{
+    for ( ; p_End - p >= 3; p += 3, q += 4)
+    {
+        uint32 u_Group = (uint32(p[0]) << 16) | (uint32(p[1]) << 8) | p[2];
+
+        q[0] = Base64Char (u_Group >> 18);
+        q[1] = Base64Char (u_Group >> 12);
+        q[2] = Base64Char (u_Group >>  6);
+        q[3] = Base64Char (u_Group      );
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   DecodeGroups
+//
+//  Synopsis:   Decodes groups of four characters until one of them isn't
+//              in the alphabet or fewer than four are left
+//----------------------------------------------------------------------------
+
+static inline void DecodeGroups (const uchar*& p, const uchar* p_End,
+                                 uchar*& q)
+{
+    for ( ; p_End - p >= 4; p += 4)
+    {
+        uint32 a = auc_Base64Decode[p[0]];
+        uint32 b = auc_Base64Decode[p[1]];
+        uint32 c = auc_Base64Decode[p[2]];
+        uint32 d = auc_Base64Decode[p[3]];
+
+        if ((a | b | c | d) >= 64)
+        {
+            break;
+        }
+
+        WriteGroup ((a << 18) | (b << 12) | (c << 6) | d, q);
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   EncodeSse2, DecodeSse2
+//
+//  Synopsis:   Encode 12 bytes or decode 16 characters per step
+//
+//  Notes:      SSE2 has no byte shuffle, so the groups are gathered into
+//              32-bit lanes one at a time for encoding and packed with
+//              shifts for decoding, and the 6-bit values are mapped to
+//              and from characters with range compares, not a table.
+//----------------------------------------------------------------------------
+
+#ifdef HAVE_SSE2
+
+static inline int32 Load24 (const uchar* p)
+{
+    return (int32) ((uint32(p[0]) << 16) | (uint32(p[1]) << 8) | p[2]);
+}
+
+static inline __m128i Above (__m128i v, char c)
+{
+    return _mm_cmpgt_epi8 (v, _mm_set1_epi8 (c));
+}
+
+static inline __m128i Between (__m128i v, char c_Low, char c_High)
+{
+    return _mm_and_si128 (_mm_cmpgt_epi8 (v, _mm_set1_epi8 (c_Low - 1)),
+                          _mm_cmpgt_epi8 (_mm_set1_epi8 (c_High + 1), v));
+}
+
+static inline __m128i Masked (__m128i v_Mask, char c)
+{
+    return _mm_and_si128 (v_Mask, _mm_set1_epi8 (c));
+}
+
+static inline void EncodeSse2 (const uchar*& p, const uchar* p_End,
+                               uchar*& q)
+{
+    for ( ; p_End - p >= 12; p += 12, q += 16)
+    {
+        __m128i v = _mm_setr_epi32 (Load24 (p),     Load24 (p + 3),
+                                    Load24 (p + 6), Load24 (p + 9));
+
+        // spread the four 6-bit fields of each group over its four bytes
+
+        __m128i x = _mm_or_si128 (
+            _mm_or_si128 (
+                _mm_srli_epi32 (v, 18),
+                _mm_and_si128 (_mm_srli_epi32 (v, 4),
+                               _mm_set1_epi32 (0x00003F00))),
+            _mm_or_si128 (
+                _mm_and_si128 (_mm_slli_epi32 (v, 10),
+                               _mm_set1_epi32 (0x003F0000)),
+                _mm_and_si128 (_mm_slli_epi32 (v, 24),
+                               _mm_set1_epi32 (0x3F000000))));
+
+        // 'A' + x, then correct for the lower case letters, the digits,
+        // '+' and '/'
+
+        __m128i r = _mm_add_epi8 (x, _mm_set1_epi8 ('A'));
+
+        r = _mm_add_epi8 (r, Masked (Above (x, 25),   6));
+        r = _mm_add_epi8 (r, Masked (Above (x, 51), -75));
+        r = _mm_add_epi8 (r, Masked (Above (x, 61), -15));
+        r = _mm_add_epi8 (r, Masked (Above (x, 62),   3));
+
+        _mm_storeu_si128 ((__m128i*) q, r);
+    }
+}
+
+static inline void DecodeSse2 (const uchar*& p, const uchar* p_End,
+                               uchar*& q)
+{
+    for ( ; p_End - p >= 16; p += 16)
+    {
+        __m128i v = _mm_loadu_si128 ((const __m128i*) p);
+
+        __m128i is_Upper = Between (v, 'A', 'Z');
+        __m128i is_Lower = Between (v, 'a', 'z');
+        __m128i is_Digit = Between (v, '0', '9');
+        __m128i is_Plus  = _mm_cmpeq_epi8 (v, _mm_set1_epi8 ('+'));
+        __m128i is_Slash = _mm_cmpeq_epi8 (v, _mm_set1_epi8 ('/'));
+
+        __m128i is_Valid = _mm_or_si128 (
+                               _mm_or_si128 (_mm_or_si128 (is_Upper,
+                                                           is_Lower),
+                                             is_Digit),
+                               _mm_or_si128 (is_Plus, is_Slash));
+
+        if (_mm_movemask_epi8 (is_Valid) != 0xFFFF)
+        {
+            break;
+        }
+
+        __m128i v_Shift = _mm_or_si128 (
+                              _mm_or_si128 (Masked (is_Upper, -65),
+                                            Masked (is_Lower, -71)),
+                              _mm_or_si128 (Masked (is_Digit, 4),
+                                            _mm_or_si128 (
+                                                Masked (is_Plus,  19),
+                                                Masked (is_Slash, 16))));
+
+        v = _mm_add_epi8 (v, v_Shift);
+
+        // two 12-bit halves per group, then the whole 24 bits
+
+        __m128i t = _mm_add_epi16 (
+                        _mm_slli_epi16 (_mm_and_si128 (
+                                            v, _mm_set1_epi16 (0x00FF)), 6),
+                        _mm_srli_epi16 (v, 8));
+
+        t = _mm_madd_epi16 (t, _mm_set1_epi32 (0x00011000));
+
+        // big-endian within each group, then the three bytes of each
+        // packed together
+
+        t = _mm_or_si128 (_mm_slli_epi16 (t, 8), _mm_srli_epi16 (t, 8));
+        t = _mm_shufflehi_epi16 (_mm_shufflelo_epi16 (t, 0xB1), 0xB1);
+
+        t = _mm_or_si128 (
+                _mm_and_si128 (_mm_srli_epi64 (t, 8),
+                               _mm_set_epi32 (0, 0x00FFFFFF, 0, 0x00FFFFFF)),
+                _mm_and_si128 (_mm_srli_epi64 (t, 16),
+                               _mm_set_epi32 (0xFFFF, 0xFF000000,
+                                              0xFFFF, 0xFF000000)));
+
+        t = _mm_or_si128 (_mm_move_epi64 (t),
+                          _mm_slli_si128 (_mm_srli_si128 (t, 8), 6));
+
+        int32 n_Last = _mm_cvtsi128_si32 (_mm_srli_si128 (t, 8));
+
+        _mm_storel_epi64 ((__m128i*) q, t);
+
+        std::memcpy (q + 8, &n_Last, 4);
+
+        q += 12;
+    }
+}
+
+#endif
+
+//+---------------------------------------------------------------------------
+//  Function:   EncodeAvx2, DecodeAvx2
+//
+//  Synopsis:   Encode 24 bytes or decode 32 characters per step
+//
+//  Notes:      These use byte shuffles to move the groups and as small
+//              lookup tables, and multiplies to shift the 6-bit fields of
+//              a group by different amounts at once.  A character outside
+//              the alphabet has a bit set in both its low and high nibble
+//              entries of the validation tables, which no valid one has.
+//----------------------------------------------------------------------------
+
+#ifdef HAVE_AVX2
+
+__attribute__((target("avx2"), noinline))
+static void EncodeAvx2 (const uchar*& p_In, const uchar* p_End,
+                        uchar*& p_Out)
+{
+    const uchar* p = p_In;
+    uchar*       q = p_Out;
+
+    const __m256i v_Spread = _mm256_setr_epi8 (
+        1, 0, 2, 1,  4, 3, 5, 4,  7, 6, 8, 7,  10,  9, 11, 10,
+        1, 0, 2, 1,  4, 3, 5, 4,  7, 6, 8, 7,  10,  9, 11, 10);
+
+    const __m256i v_Offset = _mm256_setr_epi8 (
+        71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 65, 0, 0,
+        71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 65, 0, 0);
+
+    // the second half reads 4 bytes past the 24 it encodes
+
+    for ( ; p_End - p >= 28; p += 24, q += 32)
+    {
+        __m256i v = _mm256_inserti128_si256 (
+                        _mm256_castsi128_si256 (
+                            _mm_loadu_si128 ((const __m128i*) p)),
+                        _mm_loadu_si128 ((const __m128i*) (p + 12)), 1);
+
+        v = _mm256_shuffle_epi8 (v, v_Spread);
+
+        __m256i x = _mm256_or_si256 (
+            _mm256_mulhi_epu16 (
+                _mm256_and_si256 (v, _mm256_set1_epi32 (0x0FC0FC00)),
+                _mm256_set1_epi32 (0x04000040)),
+            _mm256_mullo_epi16 (
+                _mm256_and_si256 (v, _mm256_set1_epi32 (0x003F03F0)),
+                _mm256_set1_epi32 (0x01000010)));
+
+        // 0 for lower case, 1-10 for digits, 11 '+', 12 '/', 13 upper
+
+        __m256i r = _mm256_subs_epu8 (x, _mm256_set1_epi8 (51));
+
+        r = _mm256_or_si256 (r, _mm256_and_si256 (
+                                    _mm256_cmpgt_epi8 (
+                                        _mm256_set1_epi8 (26), x),
+                                    _mm256_set1_epi8 (13)));
+
+        r = _mm256_add_epi8 (x, _mm256_shuffle_epi8 (v_Offset, r));
+
+        _mm256_storeu_si256 ((__m256i*) q, r);
+    }
+
+    p_In  = p;
+    p_Out = q;
+}
+
+__attribute__((target("avx2"), noinline))
+static void DecodeAvx2 (const uchar*& p_In, const uchar* p_End,
+                        uchar*& p_Out)
+{
+    const uchar* p = p_In;
+    uchar*       q = p_Out;
+
+    const __m256i v_LowBits = _mm256_setr_epi8 (
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+
+    const __m256i v_HighBits = _mm256_setr_epi8 (
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+
+    // indexed by the high nibble, less one for '/'
+
+    const __m256i v_Offset = _mm256_setr_epi8 (
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+
+    const __m256i v_Gather = _mm256_setr_epi8 (
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    const __m256i v_2F = _mm256_set1_epi8 (0x2F);
+
+    for ( ; p_End - p >= 32; p += 32, q += 24)
+    {
+        __m256i v = _mm256_loadu_si256 ((const __m256i*) p);
+
+        // shuffles look only at bits 0-3 and 7, so masking with 0x2F
+        // is as good as 0x0F
+
+        __m256i v_Low  = _mm256_and_si256 (v, v_2F);
+        __m256i v_High = _mm256_and_si256 (_mm256_srli_epi32 (v, 4), v_2F);
+
+        if (!_mm256_testz_si256 (_mm256_shuffle_epi8 (v_LowBits,  v_Low),
+                                 _mm256_shuffle_epi8 (v_HighBits, v_High)))
+        {
+            break;
+        }
+
+        __m256i v_Index = _mm256_add_epi8 (_mm256_cmpeq_epi8 (v, v_2F),
+                                           v_High);
+
+        v = _mm256_add_epi8 (v, _mm256_shuffle_epi8 (v_Offset, v_Index));
+
+        // two 12-bit halves per group, then the whole 24 bits
+
+        v = _mm256_maddubs_epi16 (v, _mm256_set1_epi32 (0x01400140));
+        v = _mm256_madd_epi16    (v, _mm256_set1_epi32 (0x00011000));
+        v = _mm256_shuffle_epi8  (v, v_Gather);
+        v = _mm256_permutevar8x32_epi32 (v, _mm256_setr_epi32 (0, 1, 2, 4,
+                                                               5, 6, 7, 7));
+
+        _mm_storeu_si128 ((__m128i*) q, _mm256_castsi256_si128 (v));
+        _mm_storel_epi64 ((__m128i*) (q + 16),
+                          _mm256_extracti128_si256 (v, 1));
+    }
+
+    p_In  = p;
+    p_Out = q;
+}
+
+#endif
+
+//+---------------------------------------------------------------------------
+//  Function:   DecodeRun
+//
+//  Synopsis:   Decodes from the start of a group up to the first character
+//              outside the alphabet, leaving fewer than four at the end
+//----------------------------------------------------------------------------
+
+static inline void DecodeRun (ByteSearchEngine engine, const uchar*& p,
+                              const uchar* p_End, uchar*& q)
+{
+    switch (engine)
+    {
+#ifdef HAVE_AVX2
+    case BYTE_SEARCH_AVX2:
+        DecodeAvx2 (p, p_End, q);
+        break;
+#endif
+#ifdef HAVE_SSE2
+    case BYTE_SEARCH_SSE2:
+        DecodeSse2 (p, p_End, q);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    DecodeGroups (p, p_End, q);
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     EncodedLength
+//
+//  Synopsis:   Returns the number of characters Encode writes for this
+//              many bytes, padding included
+//----------------------------------------------------------------------------
+
+uintsys Base64::EncodedLength (uintsys u_NumBytes)
+{
+    return (u_NumBytes / 3) * 4 + ((u_NumBytes % 3) ? 4 : 0);
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     DecodedLength
+//
+//  Synopsis:   Returns the most bytes Decode can write for this many
+//              characters
+//----------------------------------------------------------------------------
+
+uintsys Base64::DecodedLength (uintsys u_NumChars)
+{
+    return (u_NumChars / 4) * 3 + (u_NumChars % 4);
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Encode
+//
+//  Synopsis:   Encodes the bytes, padding the last group with '=', and
+//              returns the number of characters written
+//----------------------------------------------------------------------------
+
+uintsys Base64::Encode (const uchar* p_In, uintsys u_NumBytes, uchar* p_Out)
+{
+    const uchar* p     = p_In;
+    const uchar* p_End = p_In + u_NumBytes;
+    uchar*       q     = p_Out;
+
+    switch (ByteSearch::Engine())
+    {
+#ifdef HAVE_AVX2
+    case BYTE_SEARCH_AVX2:
+        EncodeAvx2 (p, p_End, q);
+        break;
+#endif
+#ifdef HAVE_SSE2
+    case BYTE_SEARCH_SSE2:
+        EncodeSse2 (p, p_End, q);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    EncodeGroups (p, p_End, q);
+
+    if (p_End - p == 2)
+    {
+        uint32 u_Group = (uint32(p[0]) << 8) | p[1];
+
+        q[0] = Base64Char (u_Group >> 10);
+        q[1] = Base64Char (u_Group >>  4);
+        q[2] = Base64Char (u_Group <<  2);
+        q[3] = '=';
+
+        q += 4;
+    }
+    else if (p_End - p == 1)
+    {
+        q[0] = Base64Char (p[0] >> 2);
+        q[1] = Base64Char (p[0] << 4);
+        q[2] = '=';
+        q[3] = '=';
+
+        q += 4;
+    }
+
+    return q - p_Out;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Decode
+//
+//  Synopsis:   Decodes the characters and returns the number of bytes
+//              written
+//
+//  Notes:      The first skips anything outside the alphabet and decodes
+//              a final group of two or three characters without padding.
+//              The second stops at the first error it finds and reports
+//              it in the ParseError.
+//----------------------------------------------------------------------------
+
+uintsys Base64::Decode (const uchar* p_In, uintsys u_NumChars, uchar* p_Out)
+{
+    Base64Decoder decoder;
+
+    uintsys u_Length = decoder.Update_ (p_In, u_NumChars, p_Out);
+
+    return u_Length + decoder.Finish_ (p_Out + u_Length);
+}
+
+uintsys Base64::Decode (const uchar* p_In, uintsys u_NumChars, uchar* p_Out,
+                        ParseError& error)
+{
+    Base64Decoder decoder (error);
+
+    uintsys u_Length = decoder.Update_ (p_In, u_NumChars, p_Out);
+
+    return u_Length + decoder.Finish_ (p_Out + u_Length);
+}
+
+//+---------------------------------------------------------------------------
+//  Class:      Base64Encoder
+//----------------------------------------------------------------------------
+
+Base64Encoder::Base64Encoder ()
+    : str_EOL_      ()
+    , u_LineLength_ (MAX_UINTSYS << 2)
+    , u_Column_     (0)
+    , u_Pending_    (0)
+    , b_Started_    (false)
+{
+    // nothing
+}
+
+Base64Encoder::Base64Encoder (uintsys u_LineLength, const char* pz_EOL)
+    : str_EOL_      (pz_EOL)
+    , u_LineLength_ (u_LineLength & (MAX_UINTSYS << 2))
+    , u_Column_     (0)
+    , u_Pending_    (0)
+    , b_Started_    (false)
+{
+    if (u_LineLength_ == 0)
+    {
+        u_LineLength_ = 76;
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Put_
+//
+//  Synopsis:   Encodes whole groups of bytes, ending each line with the EOL
+//----------------------------------------------------------------------------
+
+void Base64Encoder::Put_ (const uchar* p, uintsys u_NumBytes, uchar*& q)
+{
+    while (u_NumBytes != 0)
+    {
+        uintsys u_Bytes = Minimum (u_NumBytes,
+                                   (u_LineLength_ - u_Column_) / 4 * 3);
+
+        uintsys u_Chars = Base64::Encode (p, u_Bytes, q);
+
+        q          += u_Chars;
+        u_Column_  += u_Chars;
+        p          += u_Bytes;
+        u_NumBytes -= u_Bytes;
+
+        if (u_Column_ == u_LineLength_)
+        {
+            std::memcpy (q, str_EOL_.C(), str_EOL_.Length());
+
+            q += str_EOL_.Length();
+
+            u_Column_ = 0;
+        }
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Update
+//
+//  Synopsis:   Returns the characters for every whole group of bytes fed so
+//              far, holding back the last one or two bytes
+//----------------------------------------------------------------------------
+
+const String Base64Encoder::Update (const String& str_Bytes)
+{
+    const uchar* p = str_Bytes.PointerToFirstByte();
+
+    uintsys u_Length = str_Bytes.Length();
+    uintsys u_Chars  = (u_Pending_ + u_Length) / 3 * 4;
+    uintsys u_Lines  = (u_Column_ + u_Chars) / u_LineLength_;
+
+    b_Started_ = b_Started_ || (u_Length != 0);
+
+    String str_Result;
+
+    if (u_Chars == 0)
+    {
+        std::memcpy (auc_Pending_ + u_Pending_, p, u_Length);
+
+        u_Pending_ += u_Length;
+
+        return str_Result;
+    }
+
+    uchar* q_Start = str_Result.Allocate (u_Chars +
+                                          u_Lines * str_EOL_.Length());
+    uchar* q       = q_Start;
+
+    if (u_Pending_ != 0)
+    {
+        uintsys u_Fill = 3 - u_Pending_;
+
+        std::memcpy (auc_Pending_ + u_Pending_, p, u_Fill);
+
+        Put_ (auc_Pending_, 3, q);
+
+        p          += u_Fill;
+        u_Length   -= u_Fill;
+        u_Pending_  = 0;
+    }
+
+    uintsys u_Whole = u_Length / 3 * 3;
+
+    Put_ (p, u_Whole, q);
+
+    u_Pending_ = u_Length - u_Whole;
+
+    std::memcpy (auc_Pending_, p + u_Whole, u_Pending_);
+
+    str_Result.Truncate (q - q_Start);
+
+    return str_Result;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Finish
+//
+//  Synopsis:   Returns the padded last group and the EOL ending the last
+//              line.  A stream with no bytes at all gives just the EOL.
+//----------------------------------------------------------------------------
+
+const String Base64Encoder::Finish ()
+{
+    uchar auc[4];
+
+    uintsys u_Chars = Base64::Encode (auc_Pending_, u_Pending_, auc);
+
+    String str_Result (auc, u_Chars);
+
+    if ((u_Column_ + u_Chars != 0) || !b_Started_)
+    {
+        str_Result.Append (str_EOL_);
+    }
+
+    u_Column_  = 0;
+    u_Pending_ = 0;
+    b_Started_ = false;
+
+    return str_Result;
+}
+
+//+---------------------------------------------------------------------------
+//  Class:      Base64Decoder
+//----------------------------------------------------------------------------
+
+Base64Decoder::Base64Decoder ()
+    : p_Error_   (0)
+    , u_Group_   (0)
+    , u_Chars_   (0)
+    , u_Padding_ (0)
+{
+    // nothing
+}
+
+Base64Decoder::Base64Decoder (ParseError& error)
+    : p_Error_   (&error)
+    , u_Group_   (0)
+    , u_Chars_   (0)
+    , u_Padding_ (0)
+{
+    // nothing
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Update_
+//
+//  Synopsis:   Decodes into a buffer with room for at least
+//              Base64::DecodedLength (u_NumChars + 3) bytes and returns
+//              the number written
+//
+//  Notes:      The fast paths only run from the start of a group.  Any
+//              other character is handled here one at a time, until the
+//              group it interrupted has been completed.  Once the strict
+//              decoder sees '=' it allows only the rest of the padding and
+//              line breaks.
+//----------------------------------------------------------------------------
+
+uintsys Base64Decoder::Update_ (const uchar* p_In, uintsys u_NumChars,
+                                uchar* p_Out)
+{
+    const uchar* p     = p_In;
+    const uchar* p_End = p_In + u_NumChars;
+    uchar*       q     = p_Out;
+
+    if ((p_Error_ != 0) && !*p_Error_)
+    {
+        return 0;
+    }
+
+    ByteSearchEngine engine = ByteSearch::Engine();
+
+    while (p < p_End)
+    {
+        if (u_Padding_ != 0)
+        {
+            uchar uc = *p++;
+
+            if ((uc == '=') && (u_Chars_ + u_Padding_ < 4))
+            {
+                ++u_Padding_;
+            }
+            else if ((uc != '\r') && (uc != '\n'))
+            {
+                p_Error_->SetIllegalByteSequence();
+                break;
+            }
+
+            continue;
+        }
+
+        if (u_Chars_ == 0)
+        {
+            DecodeRun (engine, p, p_End, q);
+
+            if (p == p_End)
+            {
+                break;
+            }
+        }
+
+        uchar  uc      = *p++;
+        uint32 u_Value = auc_Base64Decode[uc];
+
+        if (u_Value < 64)
+        {
+            u_Group_ = (u_Group_ << 6) | u_Value;
+
+            if (++u_Chars_ == 4)
+            {
+                WriteGroup (u_Group_, q);
+
+                u_Group_ = 0;
+                u_Chars_ = 0;
+            }
+        }
+        else if ((p_Error_ == 0) || (uc == '\r') || (uc == '\n'))
+        {
+            // skipped
+        }
+        else if ((uc == '=') && (u_Chars_ >= 2))
+        {
+            u_Padding_ = 1;
+        }
+        else
+        {
+            p_Error_->SetIllegalByteSequence();
+            break;
+        }
+    }
+
+    return q - p_Out;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Finish_
+//
+//  Synopsis:   Writes the bytes of a last, partial group, at most two, and
+//              returns the number written
+//
+//  Notes:      The strict decoder requires the padding, and that the bits
+//              past the last whole byte be zero
+//----------------------------------------------------------------------------
+
+uintsys Base64Decoder::Finish_ (uchar* p_Out)
+{
+    uchar* q = p_Out;
+
+    bool b_Strict = (p_Error_ != 0);
+
+    if (u_Chars_ < 2)
+    {
+        if (b_Strict && *p_Error_ && (u_Chars_ != 0))
+        {
+            p_Error_->SetUnexpectedEndOfData();
+        }
+    }
+    else if (b_Strict && !*p_Error_)
+    {
+        // nothing
+    }
+    else if (b_Strict && (u_Chars_ + u_Padding_ < 4))
+    {
+        p_Error_->SetUnexpectedEndOfData();
+    }
+    else if (b_Strict && (u_Group_ & ((u_Chars_ == 2) ? 0x0F : 0x03)))
+    {
+        p_Error_->SetIllegalByteSequence();
+    }
+    else if (u_Chars_ == 2)
+    {
+        *q++ = (uchar) (u_Group_ >> 4);
+    }
+    else
+    {
+        *q++ = (uchar) (u_Group_ >> 10);
+        *q++ = (uchar) (u_Group_ >>  2);
+    }
+
+    u_Group_   = 0;
+    u_Chars_   = 0;
+    u_Padding_ = 0;
+
+    return q - p_Out;
+}
+
+const String Base64Decoder::Update (const String& str_Chars)
+{
+    String str_Result;
+
+    uintsys u_Length = str_Chars.Length();
+
+    if (u_Length != 0)
+    {
+        uchar* p_Result =
+            str_Result.Allocate (Base64::DecodedLength (u_Length + 3));
+
+        str_Result.Truncate (Update_ (str_Chars.PointerToFirstByte(),
+                                      u_Length, p_Result));
+    }
+
+    return str_Result;
+}
+
+const String Base64Decoder::Finish ()
+{
+    uchar auc[2];
+
+    return String (auc, Finish_ (auc));
+}
+
+} // namespace mikestoolbox
@@ -0,0 +1,253 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       ByteOrder.cpp
+//
+//  Synopsis:   Implementation of the ByteOrder array swaps
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+#ifdef HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef HAVE_AVX2
+#include <immintrin.h>
+#endif
+
+namespace mikestoolbox {
+
+#ifdef HAVE_SSE2
+
+//+---------------------------------------------------------------------------
+//  Synopsis:   Reverse the bytes of each 2, 4 or 8 byte value in a vector
+//
+//  Notes:      SSE2 has no byte shuffle, so the 16-bit words are put in
+//              order with shufflelo/shufflehi and then the two bytes of
+//              each word exchanged with shifts
+//----------------------------------------------------------------------------
+
+static inline __m128i Swap16Sse2 (__m128i v)
+{
+    return _mm_or_si128 (_mm_slli_epi16 (v, 8), _mm_srli_epi16 (v, 8));
+}
+
+static inline __m128i Swap32Sse2 (__m128i v)
+{
+    v = _mm_shufflelo_epi16 (v, _MM_SHUFFLE (2, 3, 0, 1));
+    v = _mm_shufflehi_epi16 (v, _MM_SHUFFLE (2, 3, 0, 1));
+
+    return Swap16Sse2 (v);
+}
+
+static inline __m128i Swap64Sse2 (__m128i v)
+{
+    v = _mm_shufflelo_epi16 (v, _MM_SHUFFLE (0, 1, 2, 3));
+    v = _mm_shufflehi_epi16 (v, _MM_SHUFFLE (0, 1, 2, 3));
+
+    return Swap16Sse2 (v);
+}
+
+static inline void SwapSse2 (const uchar*& p, const uchar* p_End, uchar*& q,
+                             uintsys u_Width)
+{
+    for ( ; p_End - p >= 16; p += 16, q += 16)
+    {
+        __m128i v = _mm_loadu_si128 ((const __m128i*) p);
+
+        switch (u_Width)
+        {
+            case 2:  v = Swap16Sse2 (v); break;
+            case 4:  v = Swap32Sse2 (v); break;
+            default: v = Swap64Sse2 (v); break;
+        }
+
+        _mm_storeu_si128 ((__m128i*) q, v);
+    }
+}
+
+#endif
+
+#ifdef HAVE_AVX2
+
+//+---------------------------------------------------------------------------
+//  Synopsis:   The same thirty-two bytes at a time with a byte shuffle;
+//              no value crosses a 16-byte lane so the in-lane shuffle is
+//              enough
+//----------------------------------------------------------------------------
+
+__attribute__((target("avx2"), noinline))
+static void SwapAvx2 (const uchar*& p, const uchar* p_End, uchar*& q,
+                      uintsys u_Width)
+{
+    __m256i v_Order;
+
+    switch (u_Width)
+    {
+        case 2:
+            v_Order = _mm256_setr_epi8 ( 1,  0,  3,  2,  5,  4,  7,  6,
+                                         9,  8, 11, 10, 13, 12, 15, 14,
+                                         1,  0,  3,  2,  5,  4,  7,  6,
+                                         9,  8, 11, 10, 13, 12, 15, 14);
+            break;
+
+        case 4:
+            v_Order = _mm256_setr_epi8 ( 3,  2,  1,  0,  7,  6,  5,  4,
+                                        11, 10,  9,  8, 15, 14, 13, 12,
+                                         3,  2,  1,  0,  7,  6,  5,  4,
+                                        11, 10,  9,  8, 15, 14, 13, 12);
+            break;
+
+        default:
+            v_Order = _mm256_setr_epi8 ( 7,  6,  5,  4,  3,  2,  1,  0,
+                                        15, 14, 13, 12, 11, 10,  9,  8,
+                                         7,  6,  5,  4,  3,  2,  1,  0,
+                                        15, 14, 13, 12, 11, 10,  9,  8);
+            break;
+    }
+
+    for ( ; p_End - p >= 32; p += 32, q += 32)
+    {
+        __m256i v = _mm256_loadu_si256 ((const __m256i*) p);
+
+        _mm256_storeu_si256 ((__m256i*) q, _mm256_shuffle_epi8 (v, v_Order));
+    }
+}
+
+#endif
+
+//+---------------------------------------------------------------------------
+//  Function:   SwapArray
+//
+//  Synopsis:   Copies u_Count values of u_Width bytes reversing each one
+//----------------------------------------------------------------------------
+
+static void SwapArray (const uchar* p, uintsys u_Count, uchar* q,
+                       uintsys u_Width)
+{
+    uintsys      u_NumBytes = u_Count * u_Width;
+    const uchar* p_End      = p + u_NumBytes;
+
+    switch (ByteSearch::Engine())
+    {
+#ifdef HAVE_AVX2
+    case BYTE_SEARCH_AVX2:
+        if (u_NumBytes >= 32)
+        {
+            SwapAvx2 (p, p_End, q, u_Width);
+        }
+        // fall through for the last 16 to 31 bytes
+#endif
+#ifdef HAVE_SSE2
+    case BYTE_SEARCH_SSE2:
+        SwapSse2 (p, p_End, q, u_Width);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    for ( ; p < p_End; p += u_Width, q += u_Width)
+    {
+        switch (u_Width)
+        {
+            case 2:
+            {
+                uint16 u = 0;
+
+                std::memcpy (&u, p, 2);
+
+                u = ByteOrder::Swap16 (u);
+
+                std::memcpy (q, &u, 2);
+                break;
+            }
+
+            case 4:
+            {
+                uint32 u = 0;
+
+                std::memcpy (&u, p, 4);
+
+                u = ByteOrder::Swap32 (u);
+
+                std::memcpy (q, &u, 4);
+                break;
+            }
+
+            default:
+            {
+                uint64 u = 0;
+
+                std::memcpy (&u, p, 8);
+
+                u = ByteOrder::Swap64 (u);
+
+                std::memcpy (q, &u, 8);
+                break;
+            }
+        }
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     SwapArray16, SwapArray32, SwapArray64
+//
+//  Synopsis:   Copy an array of values reversing the bytes of each
+//----------------------------------------------------------------------------
+
+void ByteOrder::SwapArray16 (const uchar* p_In, uintsys u_Count, void* p_Out)
+{
+    SwapArray (p_In, u_Count, (uchar*) p_Out, 2);
+}
+
+void ByteOrder::SwapArray32 (const uchar* p_In, uintsys u_Count, void* p_Out)
+{
+    SwapArray (p_In, u_Count, (uchar*) p_Out, 4);
+}
+
+void ByteOrder::SwapArray64 (const uchar* p_In, uintsys u_Count, void* p_Out)
+{
+    SwapArray (p_In, u_Count, (uchar*) p_Out, 8);
+}
+
+} // namespace mikestoolbox
@@ -0,0 +1,743 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       ByteSearch.cpp
+//
+//  Synopsis:   Implementation of ByteSearch methods
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+#ifdef HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef HAVE_AVX2
+#include <immintrin.h>
+#endif
+
+namespace mikestoolbox {
+
+static inline uchar Fold (uchar uc, bool b_Case)
+{
+    return b_Case ? uc : ByteToLower (uc);
+}
+
+static inline uintsys LowestBit (uint64 u_Mask)
+{
+#ifdef __GNUC__
+    return __builtin_ctzll (u_Mask);
+#else
+    uintsys u_Bit = 0;
+
+    while ((u_Mask & 1) == 0)
+    {
+        u_Mask >>= 1;
+        ++u_Bit;
+    }
+
+    return u_Bit;
+#endif
+}
+
+static inline uintsys HighestBit (uint64 u_Mask)
+{
+#ifdef __GNUC__
+    return 63 - __builtin_clzll (u_Mask);
+#else
+    uintsys u_Bit = 63;
+
+    while ((u_Mask & (uint64(1) << 63)) == 0)
+    {
+        u_Mask <<= 1;
+        --u_Bit;
+    }
+
+    return u_Bit;
+#endif
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   MiddleMatches
+//
+//  Synopsis:   Compares the bytes between the first and the last, which the
+//              caller has already matched
+//----------------------------------------------------------------------------
+
+static inline bool MiddleMatches (const uchar* p, const uchar* p_Needle,
+                                  uintsys u_NeedleLength, bool b_Case)
+{
+    if (u_NeedleLength <= 2)
+    {
+        return true;
+    }
+
+    if (b_Case)
+    {
+        return std::memcmp (p + 1, p_Needle + 1, u_NeedleLength - 2) == 0;
+    }
+
+    return StringCompare (p + 1, p_Needle + 1, u_NeedleLength - 2,
+                          false) == 0;
+}
+
+//+---------------------------------------------------------------------------
+//  Class:      Sse2Block, Avx2Block
+//
+//  Synopsis:   Each returns a bit mask of the positions in a block where
+//              both the first and the last byte of the needle match
+//
+//  Notes:      The AVX2 code is compiled with a target attribute so that
+//              the rest of the library still runs on any x86 CPU.  It is
+//              kept out of line and does 64 positions per call to make up
+//              for the call.  Whatever is left over at the end of the
+//              haystack is handed to the next narrower block, and finally
+//              to a plain loop (ScalarBlock).
+//----------------------------------------------------------------------------
+
+class ScalarBlock
+{
+public:
+
+    enum { WIDTH = 1 };
+};
+
+#ifdef HAVE_SSE2
+
+static inline __m128i FoldSse2 (__m128i x)
+{
+    __m128i t        = _mm_sub_epi8 (x, _mm_set1_epi8 ('A'));
+    __m128i is_Upper = _mm_cmpeq_epi8 (_mm_min_epu8 (t, _mm_set1_epi8 (25)),
+                                       t);
+
+    return _mm_or_si128 (x, _mm_and_si128 (is_Upper, _mm_set1_epi8 (0x20)));
+}
+
+class Sse2Block
+{
+public:
+
+    enum { WIDTH = 16 };
+
+    typedef ScalarBlock Narrower;
+
+    Sse2Block (uchar uc_First, uchar uc_Last, bool b_Case)
+        : v_First_ (_mm_set1_epi8 ((char) uc_First))
+        , v_Last_  (_mm_set1_epi8 ((char) uc_Last))
+        , b_Case_  (b_Case)
+    {
+        // nothing
+    }
+
+    uint64 Mask (const uchar* p, uintsys u_NeedleLength) const
+    {
+        __m128i a = _mm_loadu_si128 ((const __m128i*) p);
+        __m128i b = _mm_loadu_si128 ((const __m128i*)
+                                     (p + u_NeedleLength - 1));
+        if (!b_Case_)
+        {
+            a = FoldSse2 (a);
+            b = FoldSse2 (b);
+        }
+
+        return (uint32) _mm_movemask_epi8 (
+                            _mm_and_si128 (_mm_cmpeq_epi8 (a, v_First_),
+                                           _mm_cmpeq_epi8 (b, v_Last_)));
+    }
+
+private:
+
+    __m128i v_First_;
+    __m128i v_Last_;
+    bool    b_Case_;
+};
+
+#endif
+
+#ifdef HAVE_AVX2
+
+__attribute__((target("avx2")))
+static inline __m256i FoldAvx2 (__m256i x)
+{
+    __m256i t = _mm256_sub_epi8 (x, _mm256_set1_epi8 ('A'));
+    __m256i is_Upper =
+        _mm256_cmpeq_epi8 (_mm256_min_epu8 (t, _mm256_set1_epi8 (25)), t);
+
+    return _mm256_or_si256 (x, _mm256_and_si256 (is_Upper,
+                                                 _mm256_set1_epi8 (0x20)));
+}
+
+__attribute__((target("avx2")))
+static inline uint32 MaskAvx2 (const uchar* p, uintsys u_NeedleLength,
+                               uchar uc_First, uchar uc_Last, bool b_Case)
+{
+    __m256i a = _mm256_loadu_si256 ((const __m256i*) p);
+    __m256i b = _mm256_loadu_si256 ((const __m256i*)
+                                    (p + u_NeedleLength - 1));
+    if (!b_Case)
+    {
+        a = FoldAvx2 (a);
+        b = FoldAvx2 (b);
+    }
+
+    __m256i v_First = _mm256_set1_epi8 ((char) uc_First);
+    __m256i v_Last  = _mm256_set1_epi8 ((char) uc_Last);
+
+    return (uint32) _mm256_movemask_epi8 (
+                        _mm256_and_si256 (_mm256_cmpeq_epi8 (a, v_First),
+                                          _mm256_cmpeq_epi8 (b, v_Last)));
+}
+
+__attribute__((target("avx2"), noinline))
+static uint64 Mask64Avx2 (const uchar* p, uintsys u_NeedleLength,
+                          uchar uc_First, uchar uc_Last, bool b_Case)
+{
+    uint64 u_Low  = MaskAvx2 (p,      u_NeedleLength, uc_First, uc_Last,
+                              b_Case);
+    uint64 u_High = MaskAvx2 (p + 32, u_NeedleLength, uc_First, uc_Last,
+                              b_Case);
+
+    return u_Low | (u_High << 32);
+}
+
+class Avx2Block
+{
+public:
+
+    enum { WIDTH = 64 };
+
+    typedef Sse2Block Narrower;
+
+    Avx2Block (uchar uc_First, uchar uc_Last, bool b_Case)
+        : uc_First_ (uc_First)
+        , uc_Last_  (uc_Last)
+        , b_Case_   (b_Case)
+    {
+        // nothing
+    }
+
+    uint64 Mask (const uchar* p, uintsys u_NeedleLength) const
+    {
+        return Mask64Avx2 (p, u_NeedleLength, uc_First_, uc_Last_, b_Case_);
+    }
+
+private:
+
+    uchar uc_First_;
+    uchar uc_Last_;
+    bool  b_Case_;
+};
+
+#endif
+
+//+---------------------------------------------------------------------------
+//  Function:   TooManyMisses
+//
+//  Synopsis:   Tallies a candidate that failed to match and reports whether
+//              comparing them has cost more than scanning did
+//
+//  Notes:      Filtering on the first and last byte is much faster than
+//              Horspool on ordinary text, even for long needles, but
+//              repetitive input can make most positions candidates.  Long
+//              needles then switch to Horspool, whose cost doesn't grow
+//              with the number of candidates.
+//----------------------------------------------------------------------------
+
+static inline bool TooManyMisses (uintsys& u_Wasted, uintsys u_Scanned,
+                                  uintsys u_NeedleLength)
+{
+    if (u_NeedleLength < BYTE_SEARCH_LONG_NEEDLE)
+    {
+        return false;
+    }
+
+    u_Wasted += u_NeedleLength;
+
+    return u_Wasted > 4 * u_Scanned + 4096;
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   Horspool
+//
+//  Synopsis:   Boyer-Moore-Horspool search for long needles
+//----------------------------------------------------------------------------
+
+static const uchar* Horspool (const uchar* p_Haystack, uintsys u_Length,
+                              const uchar* p_Needle, uintsys u_NeedleLength,
+                              bool b_Case)
+{
+    uintsys au_Shift[256];
+
+    for (uintsys u = 0; u < 256; ++u)
+    {
+        au_Shift[u] = u_NeedleLength;
+    }
+
+    for (uintsys u = 0; u < u_NeedleLength - 1; ++u)
+    {
+        au_Shift[Fold (p_Needle[u], b_Case)] = u_NeedleLength - 1 - u;
+    }
+
+    uchar uc_Last = Fold (p_Needle[u_NeedleLength - 1], b_Case);
+
+    for (uintsys u = 0; u + u_NeedleLength <= u_Length; )
+    {
+        const uchar* p = p_Haystack + u;
+
+        uchar uc = Fold (p[u_NeedleLength - 1], b_Case);
+
+        if ((uc == uc_Last) &&
+            (StringCompare (p, p_Needle, u_NeedleLength - 1, b_Case) == 0))
+        {
+            return p;
+        }
+
+        u += au_Shift[uc];
+    }
+
+    return 0;
+}
+
+static const uchar* HorspoolLast (const uchar* p_Haystack, uintsys u_Length,
+                                  const uchar* p_Needle,
+                                  uintsys u_NeedleLength, bool b_Case)
+{
+    uintsys au_Shift[256];
+
+    for (uintsys u = 0; u < 256; ++u)
+    {
+        au_Shift[u] = u_NeedleLength;
+    }
+
+    for (uintsys u = u_NeedleLength - 1; u > 0; --u)
+    {
+        au_Shift[Fold (p_Needle[u], b_Case)] = u;
+    }
+
+    uchar uc_First = Fold (p_Needle[0], b_Case);
+
+    uintsys u = u_Length - u_NeedleLength + 1;     // one past the last start
+
+    while (u > 0)
+    {
+        const uchar* p = p_Haystack + u - 1;
+
+        uchar uc = Fold (*p, b_Case);
+
+        if ((uc == uc_First) &&
+            (StringCompare (p + 1, p_Needle + 1, u_NeedleLength - 1,
+                            b_Case) == 0))
+        {
+            return p;
+        }
+
+        uintsys u_Shift = au_Shift[uc];
+
+        u = (u > u_Shift) ? (u - u_Shift) : 0;
+    }
+
+    return 0;
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   FindPair
+//
+//  Synopsis:   Scans the haystack a block at a time for the first place the
+//              needle occurs
+//----------------------------------------------------------------------------
+
+template<class BLOCK>
+static const uchar* FindPair (const uchar* p_Haystack, uintsys u_Length,
+                              const uchar* p_Needle, uintsys u_NeedleLength,
+                              bool b_Case)
+{
+    if (u_Length < u_NeedleLength)
+    {
+        return 0;
+    }
+
+    BLOCK block (Fold (p_Needle[0], b_Case),
+                 Fold (p_Needle[u_NeedleLength - 1], b_Case), b_Case);
+
+    uintsys u_NumStarts = u_Length - u_NeedleLength + 1;
+    uintsys u_Wasted    = 0;
+    uintsys u           = 0;
+
+    for (; u + BLOCK::WIDTH <= u_NumStarts; u += BLOCK::WIDTH)
+    {
+        uint64 u_Mask = block.Mask (p_Haystack + u, u_NeedleLength);
+
+        while (u_Mask != 0)
+        {
+            const uchar* p = p_Haystack + u + LowestBit (u_Mask);
+
+            if (MiddleMatches (p, p_Needle, u_NeedleLength, b_Case))
+            {
+                return p;
+            }
+
+            if (TooManyMisses (u_Wasted, u, u_NeedleLength))
+            {
+                return Horspool (p_Haystack + u, u_Length - u, p_Needle,
+                                 u_NeedleLength, b_Case);
+            }
+
+            u_Mask &= u_Mask - 1;
+        }
+    }
+
+    return FindPair<typename BLOCK::Narrower> (p_Haystack + u, u_Length - u,
+                                               p_Needle, u_NeedleLength,
+                                               b_Case);
+}
+
+template<>
+const uchar* FindPair<ScalarBlock> (const uchar* p_Haystack,
+                                    uintsys u_Length, const uchar* p_Needle,
+                                    uintsys u_NeedleLength, bool b_Case)
+{
+    if (u_Length < u_NeedleLength)
+    {
+        return 0;
+    }
+
+    const uchar* p     = p_Haystack;
+    const uchar* p_End = p_Haystack + u_Length - u_NeedleLength + 1;
+
+    if (b_Case)
+    {
+        uchar uc_Last = p_Needle[u_NeedleLength - 1];
+
+        while ((p < p_End) &&
+               ((p = (const uchar*) std::memchr (p, *p_Needle, p_End - p))))
+        {
+            if ((p[u_NeedleLength - 1] == uc_Last) &&
+                MiddleMatches (p, p_Needle, u_NeedleLength, true))
+            {
+                return p;
+            }
+
+            ++p;
+        }
+
+        return 0;
+    }
+
+    uchar uc_First = ByteToLower (p_Needle[0]);
+    uchar uc_Last  = ByteToLower (p_Needle[u_NeedleLength - 1]);
+
+    for (; p < p_End; ++p)
+    {
+        if ((ByteToLower (p[0]) == uc_First) &&
+            (ByteToLower (p[u_NeedleLength - 1]) == uc_Last) &&
+            MiddleMatches (p, p_Needle, u_NeedleLength, false))
+        {
+            return p;
+        }
+    }
+
+    return 0;
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   FindPairLast
+//
+//  Synopsis:   Like FindPair, but scans blocks from the end of the haystack
+//              and takes the highest candidate in each first
+//----------------------------------------------------------------------------
+
+template<class BLOCK>
+static const uchar* FindPairLast (const uchar* p_Haystack, uintsys u_Length,
+                                  const uchar* p_Needle,
+                                  uintsys u_NeedleLength, bool b_Case)
+{
+    if (u_Length < u_NeedleLength)
+    {
+        return 0;
+    }
+
+    BLOCK block (Fold (p_Needle[0], b_Case),
+                 Fold (p_Needle[u_NeedleLength - 1], b_Case), b_Case);
+
+    uintsys u_NumStarts = u_Length - u_NeedleLength + 1;
+    uintsys u_Wasted    = 0;
+    uintsys u           = u_NumStarts;  // one past the last start
+
+    while (u >= BLOCK::WIDTH)
+    {
+        u -= BLOCK::WIDTH;
+
+        uint64 u_Mask = block.Mask (p_Haystack + u, u_NeedleLength);
+
+        while (u_Mask != 0)
+        {
+            uintsys u_Bit = HighestBit (u_Mask);
+
+            const uchar* p = p_Haystack + u + u_Bit;
+
+            if (MiddleMatches (p, p_Needle, u_NeedleLength, b_Case))
+            {
+                return p;
+            }
+
+            if (TooManyMisses (u_Wasted, u_NumStarts - u, u_NeedleLength))
+            {
+                return HorspoolLast (p_Haystack, p - p_Haystack +
+                                     u_NeedleLength - 1, p_Needle,
+                                     u_NeedleLength, b_Case);
+            }
+
+            u_Mask &= ~(uint64(1) << u_Bit);
+        }
+    }
+
+    if (u == 0)
+    {
+        return 0;
+    }
+
+    return FindPairLast<typename BLOCK::Narrower> (p_Haystack,
+                                                   u + u_NeedleLength - 1,
+                                                   p_Needle, u_NeedleLength,
+                                                   b_Case);
+}
+
+template<>
+const uchar* FindPairLast<ScalarBlock> (const uchar* p_Haystack,
+                                        uintsys u_Length,
+                                        const uchar* p_Needle,
+                                        uintsys u_NeedleLength, bool b_Case)
+{
+    if (u_Length < u_NeedleLength)
+    {
+        return 0;
+    }
+
+    uchar uc_First = Fold (p_Needle[0], b_Case);
+    uchar uc_Last  = Fold (p_Needle[u_NeedleLength - 1], b_Case);
+
+    for (const uchar* p = p_Haystack + u_Length - u_NeedleLength + 1;
+         p-- != p_Haystack; )
+    {
+        if ((Fold (p[0], b_Case) == uc_First) &&
+            (Fold (p[u_NeedleLength - 1], b_Case) == uc_Last) &&
+            MiddleMatches (p, p_Needle, u_NeedleLength, b_Case))
+        {
+            return p;
+        }
+    }
+
+    return 0;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Find
+//
+//  Synopsis:   Returns a pointer to the first occurrence of the needle in
+//              the haystack, or 0 if there is none
+//----------------------------------------------------------------------------
+
+const uchar* ByteSearch::Find (const uchar* p_Haystack,
+                               uintsys u_HaystackLength,
+                               const uchar* p_Needle, uintsys u_NeedleLength,
+                               bool b_Case)
+{
+    if (u_NeedleLength == 0)
+    {
+        return p_Haystack;
+    }
+
+    if (u_NeedleLength > u_HaystackLength)
+    {
+        return 0;
+    }
+
+    if (b_Case && (u_NeedleLength == 1))
+    {
+        return (const uchar*) std::memchr (p_Haystack, *p_Needle,
+                                           u_HaystackLength);
+    }
+
+    switch (Engine())
+    {
+#ifdef HAVE_AVX2
+    case BYTE_SEARCH_AVX2:
+        return FindPair<Avx2Block> (p_Haystack, u_HaystackLength,
+                                    p_Needle, u_NeedleLength, b_Case);
+#endif
+#ifdef HAVE_SSE2
+    case BYTE_SEARCH_SSE2:
+        return FindPair<Sse2Block> (p_Haystack, u_HaystackLength,
+                                    p_Needle, u_NeedleLength, b_Case);
+#endif
+    default:
+        if (u_NeedleLength >= BYTE_SEARCH_LONG_NEEDLE)
+        {
+            return Horspool (p_Haystack, u_HaystackLength, p_Needle,
+                             u_NeedleLength, b_Case);
+        }
+
+        return FindPair<ScalarBlock> (p_Haystack, u_HaystackLength,
+                                      p_Needle, u_NeedleLength, b_Case);
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     FindLast
+//
+//  Synopsis:   Returns a pointer to the last occurrence of the needle in
+//              the haystack, or 0 if there is none
+//----------------------------------------------------------------------------
+
+const uchar* ByteSearch::FindLast (const uchar* p_Haystack,
+                                   uintsys u_HaystackLength,
+                                   const uchar* p_Needle,
+                                   uintsys u_NeedleLength, bool b_Case)
+{
+    if (u_NeedleLength == 0)
+    {
+        return p_Haystack + u_HaystackLength;
+    }
+
+    if (u_NeedleLength > u_HaystackLength)
+    {
+        return 0;
+    }
+
+    switch (Engine())
+    {
+#ifdef HAVE_AVX2
+    case BYTE_SEARCH_AVX2:
+        return FindPairLast<Avx2Block> (p_Haystack, u_HaystackLength,
+                                        p_Needle, u_NeedleLength, b_Case);
+#endif
+#ifdef HAVE_SSE2
+    case BYTE_SEARCH_SSE2:
+        return FindPairLast<Sse2Block> (p_Haystack, u_HaystackLength,
+                                        p_Needle, u_NeedleLength, b_Case);
+#endif
+    default:
+        if (u_NeedleLength >= BYTE_SEARCH_LONG_NEEDLE)
+        {
+            return HorspoolLast (p_Haystack, u_HaystackLength, p_Needle,
+                                 u_NeedleLength, b_Case);
+        }
+
+        return FindPairLast<ScalarBlock> (p_Haystack, u_HaystackLength,
+                                          p_Needle, u_NeedleLength, b_Case);
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     BestEngine
+//
+//  Synopsis:   Returns the widest engine this CPU and build can run
+//----------------------------------------------------------------------------
+
+ByteSearchEngine ByteSearch::BestEngine ()
+{
+#ifdef HAVE_AVX2
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports ("avx2"))
+    {
+        return BYTE_SEARCH_AVX2;
+    }
+#endif
+
+#ifdef HAVE_SSE2
+    return BYTE_SEARCH_SSE2;
+#else
+    return BYTE_SEARCH_SCALAR;
+#endif
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Engine
+//
+//  Synopsis:   Returns the engine in use, choosing the best one on the
+//              first call
+//
+//  Notes:      Threads racing through the first call all store the same
+//              value, so no lock is needed
+//----------------------------------------------------------------------------
+
+ByteSearchEngine ByteSearch::Engine ()
+{
+    if (e_Engine_ == BYTE_SEARCH_UNKNOWN)
+    {
+        e_Engine_ = BestEngine();
+    }
+
+    return e_Engine_;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     SetEngine
+//
+//  Synopsis:   Forces a narrower engine, for tests and benchmarks.  A
+//              request for an engine the CPU can't run gets the best one.
+//----------------------------------------------------------------------------
+
+void ByteSearch::SetEngine (ByteSearchEngine engine)
+{
+    ByteSearchEngine e_Best = BestEngine();
+
+    e_Engine_ = ((engine == BYTE_SEARCH_UNKNOWN) || (engine > e_Best))
+                    ? e_Best : engine;
+}
+
+const char* ByteSearch::EngineName (ByteSearchEngine engine)
+{
+    switch (engine)
+    {
+    case BYTE_SEARCH_SCALAR:
+        return "scalar";
+    case BYTE_SEARCH_SSE2:
+        return "sse2";
+    case BYTE_SEARCH_AVX2:
+        return "avx2";
+    default:
+        return "unknown";
+    }
+}
+
+} // namespace mikestoolbox
@@ -0,0 +1,115 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       Condition.cpp
+//
+//  Synopsis:   Implementation of Condition class
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+namespace mikestoolbox {
+
+#ifndef SINGLE_THREADED
+
+//+---------------------------------------------------------------------------
+//  Method:     Wait_
+//
+//  Synopsis:   Waits until the flag is set or a Broadcast() happens.  A
+//              negative number of seconds waits forever.
+//
+//  Notes:      We register as a waiter before the final check of the flag,
+//              then sleep only if the sequence number has not changed
+//              since we read it, so a Signal() can never slip through.
+//----------------------------------------------------------------------------
+
+bool Condition::Wait_ (double d_Seconds)
+{
+    if (b_Signaled_.Load() && b_Signaled_.Exchange (false))
+    {
+        return true;
+    }
+
+    uint32 u_Broadcast = u_Broadcast_.Load();
+    Timer  timer;
+
+    for (;;)
+    {
+        uint32 u_Sequence = u_Sequence_.Load();
+
+        u_Waiters_.Increment();
+
+        AtomicFence();
+
+        bool b_Woken = true;
+
+        if (!b_Signaled_.Load() && (u_Broadcast_.Load() == u_Broadcast))
+        {
+            b_Woken = Block_ (u_Sequence, d_Seconds);
+        }
+
+        u_Waiters_.Decrement();
+
+        if (b_Signaled_.Exchange (false))
+        {
+            return true;
+        }
+
+        if (u_Broadcast_.Load() != u_Broadcast)
+        {
+            return true;
+        }
+
+        if (d_Seconds >= 0.0)
+        {
+            d_Seconds -= timer.Elapsed();
+
+            if (!b_Woken || (d_Seconds <= 0.0))
+            {
+                return false;
+            }
+        }
+    }
+}
+
+#endif // SINGLE_THREADED
+
+} // namespace mikestoolbox
@@ -49,7 +49,7 @@
 namespace mikestoolbox {
 
 #ifdef HAVE_AWFUL_DATE_FUNCTIONS
-static Mutex gmutex_LocalTime;
+static Mutex gmutex_LocalTime ("gmutex_LocalTime");
 #endif
 
 intsys DecodeTimeZoneName (const String& str_TimeZone);
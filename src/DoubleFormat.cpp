@@ -0,0 +1,314 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       DoubleFormat.cpp
+//
+//  Synopsis:   Implementation of DoubleFormat::Print
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+#include <cstdio>
+
+namespace mikestoolbox {
+
+//+---------------------------------------------------------------------------
+//  Function:   WriteFixed
+//
+//  Synopsis:   Writes the digits with the first one in the 10^n_Exponent
+//              place and n_Fraction digits after the decimal point,
+//              padding with zeros
+//----------------------------------------------------------------------------
+
+static char* WriteFixed (char* p, const char* ps_Digits, intsys n_Digits,
+                         intsys n_Exponent, intsys n_Fraction)
+{
+    if (n_Exponent < 0)
+    {
+        *p++ = '0';
+    }
+
+    for (intsys n = 0; n <= n_Exponent; ++n)
+    {
+        *p++ = (n < n_Digits) ? ps_Digits[n] : '0';
+    }
+
+    if (n_Fraction > 0)
+    {
+        *p++ = '.';
+
+        for (intsys n = n_Exponent + 1; n <= n_Exponent + n_Fraction; ++n)
+        {
+            *p++ = ((n >= 0) && (n < n_Digits)) ? ps_Digits[n] : '0';
+        }
+    }
+
+    return p;
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   WriteScientific
+//
+//  Synopsis:   Writes the digits as printf's %e would, with n_Fraction
+//              digits after the decimal point and at least two in the
+//              exponent
+//----------------------------------------------------------------------------
+
+static char* WriteScientific (char* p, const char* ps_Digits,
+                              intsys n_Digits, intsys n_Exponent,
+                              intsys n_Fraction)
+{
+    *p++ = ps_Digits[0];
+
+    if (n_Fraction > 0)
+    {
+        *p++ = '.';
+
+        for (intsys n = 1; n <= n_Fraction; ++n)
+        {
+            *p++ = (n < n_Digits) ? ps_Digits[n] : '0';
+        }
+    }
+
+    *p++ = 'e';
+    *p++ = (n_Exponent < 0) ? '-' : '+';
+
+    if (n_Exponent < 0)
+    {
+        n_Exponent = -n_Exponent;
+    }
+
+    if (n_Exponent < 10)
+    {
+        *p++ = '0';
+    }
+
+    return p + Number::FormatUint ((uint64) n_Exponent, p);
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   RoundDigits
+//
+//  Synopsis:   Rounds the digits to the first n_Keep, carrying into the
+//              exponent if they were all nines, and drops trailing zeros
+//----------------------------------------------------------------------------
+
+static void RoundDigits (char* ps_Digits, intsys& n_Digits,
+                         intsys& n_Exponent, intsys n_Keep)
+{
+    bool b_Up = (ps_Digits[n_Keep] >= '5');
+
+    n_Digits = n_Keep;
+
+    while (b_Up && (n_Digits != 0) && (ps_Digits[n_Digits - 1] == '9'))
+    {
+        --n_Digits;
+    }
+
+    if (b_Up && (n_Digits == 0))
+    {
+        ps_Digits[0] = '1';
+        n_Digits     = 1;
+
+        ++n_Exponent;
+
+        return;
+    }
+
+    if (b_Up)
+    {
+        ++ps_Digits[n_Digits - 1];
+    }
+
+    while (ps_Digits[n_Digits - 1] == '0')
+    {
+        --n_Digits;
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Print
+//
+//  Synopsis:   Writes d to the buffer the way snprintf would, returning the
+//              length it needed
+//
+//  Notes:      Print starts from the shortest digits that read back as d.
+//              If printf would keep at least as many (and no more than
+//              15), its correctly rounded digits are those same digits
+//              followed by zeros: d is within half of its own last place of
+//              them, which is less than half of the 15th digit's place.
+//              That needs the full 53 bits, so not for subnormals, whose
+//              last place can be far above the 15th digit's (the shortest
+//              digits of 4.9406564584124654e-324 are just "5").
+//
+//              If printf would keep at least two fewer, rounding the
+//              shortest digits gives the same answer as rounding d.  Were
+//              there a rounding midpoint between them it would read back
+//              as d too, and it would be shorter than the shortest digits.
+//
+//              Only the values in between, or that printf would round to
+//              fewer than one digit, are left to snprintf.
+//----------------------------------------------------------------------------
+
+intsys DoubleFormat::Print (double d, char* ps_Buffer,
+                            uintsys u_Capacity) const
+{
+    const intsys MAX_DIGITS = 15;
+
+    uint64 u_Bits = 0;
+
+    std::memcpy (&u_Bits, &d, 8);
+
+    char    ac_Digits[20];
+    intsys  n_Digits    = 0;
+    intsys  n_Exponent  = 0;
+    bool    b_Negative  = (u_Bits >> 63) != 0;
+    bool    b_Subnormal = (d != 0) && (((u_Bits >> 52) & 0x7FF) == 0);
+
+    if (d == 0)
+    {
+        ac_Digits[0] = '0';
+        n_Digits     = 1;
+    }
+    else if ((d - d) == 0)
+    {
+        n_Digits = Number::ShortestDigits (b_Negative ? -d : d, ac_Digits,
+                                           n_Exponent);
+    }
+
+    bool   b_Shortest  = b_Shortest_;
+    intsys n_Precision = n_Precision_;
+    intsys n_Keep      = n_Digits;
+
+    if (b_Scientific_)
+    {
+        n_Keep = n_Precision + 1;
+    }
+    else if (b_Decimal_)
+    {
+        n_Keep = n_Exponent + 1 + n_Precision;
+    }
+    else
+    {
+        n_Keep = n_Precision = Maximum (n_Precision, (intsys) 1);
+    }
+
+    bool b_Fast = (n_Digits != 0) && (b_Shortest || (n_Precision_ >= 0));
+
+    if (b_Fast && !b_Shortest)
+    {
+        if (n_Digits <= n_Keep)
+        {
+            b_Fast = (n_Keep <= MAX_DIGITS) && !b_Subnormal;
+        }
+        else if ((n_Digits >= n_Keep + 2) && (n_Keep >= 1))
+        {
+            RoundDigits (ac_Digits, n_Digits, n_Exponent, n_Keep);
+        }
+        else
+        {
+            b_Fast = false;
+        }
+    }
+
+    if (!b_Fast)
+    {
+        const char* pz_Format = "%1.*g";
+
+        if (b_Scientific_)
+        {
+            pz_Format = "%1.*e";
+        }
+        else if (b_Decimal_)
+        {
+            pz_Format = "%1.*f";
+        }
+
+        return snprintf (ps_Buffer, u_Capacity, pz_Format,
+                         b_Shortest ? 17 : n_Precision_, d);
+    }
+
+    intsys n_Needed = Maximum (n_Digits - 1 - n_Exponent, (intsys) 0);
+
+    char  ac[352];
+    char* p = ac;
+
+    if (b_Negative)
+    {
+        *p++ = '-';
+    }
+
+    if (b_Scientific_)
+    {
+        p = WriteScientific (p, ac_Digits, n_Digits, n_Exponent,
+                             b_Shortest ? n_Digits - 1 : n_Precision);
+    }
+    else if (b_Decimal_)
+    {
+        p = WriteFixed (p, ac_Digits, n_Digits, n_Exponent,
+                        b_Shortest ? n_Needed : n_Precision);
+    }
+    else if ((n_Exponent < -4) ||
+             (n_Exponent >= (b_Shortest ? 17 : n_Precision)))
+    {
+        p = WriteScientific (p, ac_Digits, n_Digits, n_Exponent,
+                             n_Digits - 1);
+    }
+    else
+    {
+        p = WriteFixed (p, ac_Digits, n_Digits, n_Exponent, n_Needed);
+    }
+
+    uintsys u_Length = p - ac;
+
+    if (u_Capacity != 0)
+    {
+        uintsys u_Copy = Minimum (u_Length, u_Capacity - 1);
+
+        std::memcpy (ps_Buffer, ac, u_Copy);
+
+        ps_Buffer[u_Copy] = 0;
+    }
+
+    return u_Length;
+}
+
+} // namespace mikestoolbox
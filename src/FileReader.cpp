@@ -0,0 +1,100 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       FileReader.cpp
+//
+//  Synopsis:   Platform-independent methods of the FileReader class
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+namespace mikestoolbox {
+
+FileReader::~FileReader ()
+{
+    Close();
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Read
+//
+//  Synopsis:   Replaces the contents of the string with the next chunk of
+//              the file, up to u_MaxBytes long
+//----------------------------------------------------------------------------
+
+bool FileReader::Read (String& str_Chunk, uintsys u_MaxBytes)
+{
+    if (!b_IsOpen_ || b_AtEnd_ || (u_MaxBytes == 0))
+    {
+        str_Chunk.Clear();
+
+        return false;
+    }
+
+    intsys n_Read = Read_ (str_Chunk.Allocate (u_MaxBytes), u_MaxBytes);
+
+    if (n_Read <= 0)
+    {
+        str_Chunk.Clear();
+
+        b_AtEnd_ = (n_Read == 0);
+
+        return false;
+    }
+
+    str_Chunk.Truncate (n_Read);
+
+    u_BytesRead_ += n_Read;
+
+    return true;
+}
+
+void FileReader::Close ()
+{
+    if (b_IsOpen_)
+    {
+        Close_();
+
+        b_IsOpen_ = false;
+    }
+}
+
+} // namespace mikestoolbox
@@ -0,0 +1,250 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       FileWatcher.cpp
+//
+//  Synopsis:   Platform-independent methods of the FileWatcher classes
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+namespace mikestoolbox {
+
+const uintsys FILE_WATCHER_COALESCE_DELAY = 50;     // milliseconds
+
+FileWatcher::FileWatcher ()
+    : h_Notify_        (-1)
+    , mutex_           ()
+    , map_Paths_       ()
+    , map_Watches_     ()
+    , u_CoalesceDelay_ (FILE_WATCHER_COALESCE_DELAY)
+{
+    Open_();
+}
+
+FileWatcher::~FileWatcher ()
+{
+    if (IsOpen())
+    {
+        Close_();
+    }
+}
+
+bool FileWatcher::Watch (const String& str_Path, uintsys u_Events)
+{
+    MutexLocker locker (mutex_);
+
+    intsys n_Watch = -1;
+
+    if (!IsOpen() || !AddWatch_ (str_Path, u_Events, n_Watch))
+    {
+        return false;
+    }
+
+    map_Paths_.Set   (n_Watch, str_Path);
+    map_Watches_.Set (str_Path, n_Watch);
+
+    return true;
+}
+
+bool FileWatcher::Unwatch (const String& str_Path)
+{
+    MutexLocker locker (mutex_);
+
+    intsys n_Watch = -1;
+
+    if (!map_Watches_.Find (str_Path, n_Watch))
+    {
+        return false;
+    }
+
+    RemoveWatch_ (n_Watch);
+
+    map_Paths_.Delete   (n_Watch);
+    map_Watches_.Delete (str_Path);
+
+    return true;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Wait
+//
+//  Synopsis:   Waits up to the timeout (forever if negative) for a change,
+//              then collects events for the coalesce delay.  Each path is
+//              reported once, in the order it first changed, with the
+//              bits of all its events combined.
+//----------------------------------------------------------------------------
+
+bool FileWatcher::Wait (FileEventList& list_Events,
+                        intsys n_TimeoutMilliseconds)
+{
+    list_Events.Clear();
+
+    FileEventList list_Raw;
+
+    Timer  timer;
+    double d_Elapsed = 0.0;
+
+    while (list_Raw.IsEmpty())
+    {
+        intsys n_Remaining = -1;
+
+        if (n_TimeoutMilliseconds >= 0)
+        {
+            n_Remaining = n_TimeoutMilliseconds -
+                          (intsys) (d_Elapsed * 1000.0);
+
+            if (n_Remaining < 0)
+            {
+                return false;
+            }
+        }
+
+        if (!ReadEvents_ (n_Remaining, list_Raw))
+        {
+            return false;
+        }
+
+        d_Elapsed += timer.Elapsed();
+    }
+
+    d_Elapsed = 0.0;
+
+    for (;;)
+    {
+        d_Elapsed += timer.Elapsed();
+
+        intsys n_Remaining = (intsys) u_CoalesceDelay_ -
+                             (intsys) (d_Elapsed * 1000.0);
+
+        if ((n_Remaining <= 0) || !ReadEvents_ (n_Remaining, list_Raw))
+        {
+            break;
+        }
+    }
+
+    Map<String,uintsys> map_Events;
+    StringList          strl_Order;
+
+    while (!list_Raw.IsEmpty())
+    {
+        FileEvent event (list_Raw.Shift());
+
+        uintsys u_Events = 0;
+
+        if (!map_Events.Find (event.Path(), u_Events))
+        {
+            strl_Order.Append (event.Path());
+        }
+
+        map_Events.Set (event.Path(), u_Events | event.Events());
+    }
+
+    while (!strl_Order.IsEmpty())
+    {
+        String str_Path (strl_Order.Shift());
+
+        list_Events.Append (FileEvent (str_Path, map_Events[str_Path]));
+    }
+
+    return !list_Events.IsEmpty();
+}
+
+intsys FileWatcherThread::Main_ ()
+{
+    const intsys n_PollInterval = 100;   // milliseconds between stop checks
+
+    FileEventList list_Events;
+
+    while (!ShouldStop())
+    {
+        if (!watcher_.IsOpen())
+        {
+            return -1;
+        }
+
+        if (watcher_.Wait (list_Events, n_PollInterval))
+        {
+            while (!list_Events.IsEmpty())
+            {
+                func_ (list_Events.Shift(), p_Arg_);
+            }
+        }
+    }
+
+    return 0;
+}
+
+#ifndef HAVE_INOTIFY
+
+bool FileWatcher::Open_ ()
+{
+    return false;   // not supported on this platform
+}
+
+void FileWatcher::Close_ ()
+{
+    // nothing
+}
+
+bool FileWatcher::AddWatch_ (const String&, uintsys, intsys&)
+{
+    return false;
+}
+
+void FileWatcher::RemoveWatch_ (intsys)
+{
+    // nothing
+}
+
+bool FileWatcher::ReadEvents_ (intsys n_TimeoutMilliseconds, FileEventList&)
+{
+    if (n_TimeoutMilliseconds > 0)
+    {
+        millisleep (n_TimeoutMilliseconds);
+    }
+
+    return false;
+}
+
+#endif // !HAVE_INOTIFY
+
+} // namespace mikestoolbox
@@ -0,0 +1,208 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       FileWriter.cpp
+//
+//  Synopsis:   Platform-independent methods of the FileWriter class
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+namespace mikestoolbox {
+
+FileWriter::~FileWriter ()
+{
+    Close();
+}
+
+bool FileWriter::Append (const String& str_Contents)
+{
+    bool b_Flush = false;
+
+    {
+        MutexLocker locker (mutex_Buffer_);
+
+        if (!b_IsOpen_)
+        {
+            return false;
+        }
+
+        if (str_Buffer_.IsEmpty())
+        {
+            timer_BufferAge_.Reset();
+
+            d_BufferAge_ = 0.0;
+        }
+        else
+        {
+            d_BufferAge_ += timer_BufferAge_.Elapsed();
+        }
+
+        str_Buffer_.Append (str_Contents);
+
+        u_BytesAppended_ += str_Contents.Length();
+
+        b_Flush = (str_Buffer_.Length() >= u_BufferSize_) ||
+                  ((d_FlushInterval_ > 0.0) &&
+                   (d_BufferAge_ >= d_FlushInterval_));
+    }
+
+    return b_Flush ? Flush() : true;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Flush_
+//
+//  Synopsis:   Writes out the buffer.  The caller must hold mutex_Write_,
+//              which keeps the writes in the order the data was appended.
+//              Other threads may keep appending while the write is running.
+//----------------------------------------------------------------------------
+
+bool FileWriter::Flush_ ()
+{
+    {
+        MutexLocker locker (mutex_Buffer_);
+
+        if (!b_IsOpen_)
+        {
+            return false;
+        }
+
+        str_Pending_.Swap (str_Buffer_);
+    }
+
+    if (str_Pending_.IsEmpty())
+    {
+        return true;
+    }
+
+    uintsys u_Written = 0;
+
+    if (!Write_ (str_Pending_, u_Written))
+    {
+        u_BytesWritten_ += u_Written;
+
+        // put what is left back in front of anything appended since
+
+        String str_Unwritten (str_Pending_.Tail (str_Pending_.Length() -
+                                                 u_Written));
+
+        MutexLocker locker (mutex_Buffer_);
+
+        str_Unwritten.Append (str_Buffer_);
+
+        str_Buffer_.Swap (str_Unwritten);
+
+        str_Pending_.Clear();
+
+        return false;
+    }
+
+    u_BytesWritten_ += u_Written;
+
+    str_Pending_.Clear();   // keep the capacity for the next flush
+
+    return true;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Sync
+//
+//  Synopsis:   Flushes the buffer and waits until everything appended before
+//              the call is on disk.  A thread that finds an fsync already
+//              running waits for it and then returns without another fsync
+//              if that one covered its data.
+//----------------------------------------------------------------------------
+
+bool FileWriter::Sync ()
+{
+    uint64 u_Target = BytesAppended();
+
+    MutexLocker locker_Sync (mutex_Sync_);
+
+    if (u_BytesSynced_ >= u_Target)
+    {
+        return true;
+    }
+
+    uint64 u_Covered = 0;
+
+    {
+        MutexLocker locker_Write (mutex_Write_);
+
+        if (!Flush_())
+        {
+            return false;
+        }
+
+        u_Covered = u_BytesWritten_;
+    }
+
+    if (!Sync_())
+    {
+        return false;
+    }
+
+    u_BytesSynced_ = u_Covered;
+
+    return true;
+}
+
+bool FileWriter::Close ()
+{
+    MutexLocker locker_Sync  (mutex_Sync_);
+    MutexLocker locker_Write (mutex_Write_);
+
+    bool b_Success = Flush_();
+
+    MutexLocker locker_Buffer (mutex_Buffer_);
+
+    if (b_IsOpen_)
+    {
+        Close_();
+
+        b_IsOpen_ = false;
+    }
+
+    return b_Success;
+}
+
+} // namespace mikestoolbox
@@ -0,0 +1,171 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       Hex.cpp
+//
+//  Synopsis:   Implementation of HexEncoder and HexDecoder methods
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+namespace mikestoolbox {
+
+const uintsys HEX_NO_DIGIT = 16;
+
+static inline uintsys HexValue (uchar uc)
+{
+    if ((uchar) (uc - '0') < 10)
+    {
+        return uc - '0';
+    }
+
+    uc |= 0x20;     // lower case
+
+    if ((uchar) (uc - 'a') < 6)
+    {
+        return uc - 'a' + 10;
+    }
+
+    return HEX_NO_DIGIT;
+}
+
+static inline bool IsHexSpace (uchar uc)
+{
+    return (uc == ' ') || (uc == '\t') || (uc == '\r') || (uc == '\n');
+}
+
+//+---------------------------------------------------------------------------
+//  Class:      HexEncoder
+//----------------------------------------------------------------------------
+
+HexEncoder::HexEncoder (bool b_UpperCase)
+    : b_UpperCase_ (b_UpperCase)
+{
+    // nothing
+}
+
+const String HexEncoder::Update (const String& str_Bytes) const
+{
+    return b_UpperCase_ ? str_Bytes.HEX() : str_Bytes.Hex();
+}
+
+const String HexEncoder::Finish () const
+{
+    return String();
+}
+
+//+---------------------------------------------------------------------------
+//  Class:      HexDecoder
+//----------------------------------------------------------------------------
+
+HexDecoder::HexDecoder (ParseError& error)
+    : p_Error_ (&error)
+    , u_High_  (HEX_NO_DIGIT)
+{
+    // nothing
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Update
+//
+//  Synopsis:   Returns the bytes for every pair of digits fed so far,
+//              holding back an odd digit at the end
+//----------------------------------------------------------------------------
+
+const String HexDecoder::Update (const String& str_Chars)
+{
+    String str_Result;
+
+    uintsys u_Length = str_Chars.Length();
+
+    if ((u_Length == 0) || !*p_Error_)
+    {
+        return str_Result;
+    }
+
+    const uchar* p     = str_Chars.PointerToFirstByte();
+    const uchar* p_End = p + u_Length;
+
+    uchar* q_Start = str_Result.Allocate (u_Length / 2 + 1);
+    uchar* q       = q_Start;
+
+    for ( ; p < p_End; ++p)
+    {
+        uintsys u_Value = HexValue (*p);
+
+        if (u_Value == HEX_NO_DIGIT)
+        {
+            if (!IsHexSpace (*p))
+            {
+                p_Error_->SetIllegalByteSequence();
+                break;
+            }
+        }
+        else if (u_High_ == HEX_NO_DIGIT)
+        {
+            u_High_ = u_Value;
+        }
+        else
+        {
+            *q++ = (uchar) ((u_High_ << 4) | u_Value);
+
+            u_High_ = HEX_NO_DIGIT;
+        }
+    }
+
+    str_Result.Truncate (q - q_Start);
+
+    return str_Result;
+}
+
+const String HexDecoder::Finish ()
+{
+    if ((u_High_ != HEX_NO_DIGIT) && *p_Error_)
+    {
+        p_Error_->SetUnexpectedEndOfData();
+    }
+
+    u_High_ = HEX_NO_DIGIT;
+
+    return String();
+}
+
+} // namespace mikestoolbox
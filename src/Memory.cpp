@@ -48,33 +48,474 @@
 
 namespace mikestoolbox {
 
-inline uintsys OptimumStringSize (uintsys u_MinCapacity)
+//+---------------------------------------------------------------------------
+//  Function:   ReleaseThreadCache
+//
+//  Synopsis:   Called by the system when a thread which created a cache
+//              ends, so threads not started through Thread give their
+//              blocks back too
+//----------------------------------------------------------------------------
+
+#ifndef SINGLE_THREADED
+
+#ifdef PLATFORM_UNIX
+static void ReleaseThreadCache (void*)
+#endif
+#ifdef PLATFORM_WINDOWS
+static VOID WINAPI ReleaseThreadCache (PVOID)
+#endif
 {
-    if (u_MinCapacity > (1UL<<30))
+    MemoryCache::ThreadExit();
+}
+
+#endif // SINGLE_THREADED
+
+//+---------------------------------------------------------------------------
+//  Class:      MemoryCacheRegistry
+//
+//  Synopsis:   Every live MemoryCache, so that Stats() can add them up,
+//              plus the totals of the caches of threads which have ended
+//----------------------------------------------------------------------------
+
+class MemoryCacheRegistry
+{
+public:
+
+    MemoryCacheRegistry ()
+        : p_First_ (0)
+        , u_Limit_ (MEMORY_CACHE_LIMIT)
+        , u_Epoch_ (0)
     {
-        uintsys u_NewCapacity = ((u_MinCapacity & 0x0F)
-                              ? ((u_MinCapacity & (~0x0F)) + 0x10)
-                              : u_MinCapacity);
+#ifndef SINGLE_THREADED
+#ifdef PLATFORM_UNIX
+        pthread_key_create (&key_Exit_, ReleaseThreadCache);
+#endif
+#ifdef PLATFORM_WINDOWS
+        dw_Exit_ = FlsAlloc (ReleaseThreadCache);
+#endif
+#endif
+    }
 
-        if (u_NewCapacity < u_MinCapacity)
+    void SetExitHook (MemoryCache* p_Cache)
+    {
+#ifndef SINGLE_THREADED
+#ifdef PLATFORM_UNIX
+        pthread_setspecific (key_Exit_, p_Cache);
+#endif
+#ifdef PLATFORM_WINDOWS
+        if (dw_Exit_ != FLS_OUT_OF_INDEXES)
         {
-            throw Exception ("OptimumStringSize: Out of memory");
+            FlsSetValue (dw_Exit_, p_Cache);
         }
+#endif
+#else
+        (void) p_Cache;
+#endif
+    }
+
+    Mutex               mutex_;
+    MemoryCache*        p_First_;
+    MemoryCacheStats    stats_Retired_;
+    Atomic<uintsys>     u_Limit_;
+    Atomic<uintsys>     u_Epoch_;
+
+#ifndef SINGLE_THREADED
+#ifdef PLATFORM_UNIX
+    pthread_key_t       key_Exit_;      // runs ReleaseThreadCache
+#endif
+#ifdef PLATFORM_WINDOWS
+    DWORD               dw_Exit_;       // runs ReleaseThreadCache
+#endif
+#endif
+};
+
+static MemoryCacheRegistry& Registry ()
+{
+    // never deleted, since strings may be freed during static destruction
+
+    static MemoryCacheRegistry* p_Registry = new MemoryCacheRegistry;
+
+    return *p_Registry;
+}
+
+static THREAD_LOCAL MemoryCache* gp_ThreadCache = 0;
+static THREAD_LOCAL bool         gb_ThreadExited = false;
+
+//+---------------------------------------------------------------------------
+//  Class:      MemoryCache
+//----------------------------------------------------------------------------
+
+MemoryCache::MemoryCache ()
+    : u_TrimEpoch_ (Registry().u_Epoch_.Load())
+    , p_Next_      (0)
+    , p_Prev_      (0)
+{
+    for (uintsys u_Class = 0; u_Class < MEMORY_CACHE_CLASSES; ++u_Class)
+    {
+        ap_Free_[u_Class] = 0;
+    }
+
+    MemoryCacheRegistry& registry = Registry();
+
+    MutexLocker lock (registry.mutex_);
+
+    p_Next_ = registry.p_First_;
 
-        return u_NewCapacity;
+    if (p_Next_ != 0)
+    {
+        p_Next_->p_Prev_ = this;
     }
 
-    uintsys u_Optimum = 32;
+    registry.p_First_ = this;
+}
+
+MemoryCache::~MemoryCache ()
+{
+    Release_();
+
+    MemoryCacheRegistry& registry = Registry();
 
-    while (u_Optimum < u_MinCapacity)
+    MutexLocker lock (registry.mutex_);
+
+    if (p_Prev_ != 0)
+    {
+        p_Prev_->p_Next_ = p_Next_;
+    }
+    else
     {
-        u_Optimum = u_Optimum << 1;
+        registry.p_First_ = p_Next_;
     }
 
-    return u_Optimum;
+    if (p_Next_ != 0)
+    {
+        p_Next_->p_Prev_ = p_Prev_;
+    }
+
+    registry.stats_Retired_.Add (stats_);
 }
 
-uchar* HeapMemory::Allocate_ (uintsys u_Length, uintsys& u_Allocated)
+//+---------------------------------------------------------------------------
+//  Method:     Current_
+//
+//  Synopsis:   Returns the calling thread's cache, creating it if needed,
+//              or 0 if the cache is turned off or the thread has ended
+//----------------------------------------------------------------------------
+
+MemoryCache* MemoryCache::Current_ ()
+{
+    if ((gp_ThreadCache == 0) && !gb_ThreadExited &&
+        (Registry().u_Limit_.LoadRelaxed() != 0))
+    {
+        gp_ThreadCache = new MemoryCache;
+
+        Registry().SetExitHook (gp_ThreadCache);
+    }
+
+    return gp_ThreadCache;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     SizeClass_
+//
+//  Synopsis:   Returns the free list index for a block size, or
+//              MEMORY_CACHE_CLASSES if blocks of that size are not cached
+//----------------------------------------------------------------------------
+
+uintsys MemoryCache::SizeClass_ (uintsys u_BlockSize)
+{
+    if ((u_BlockSize < MEMORY_CACHE_MIN_BLOCK) ||
+        (u_BlockSize > MEMORY_CACHE_MAX_BLOCK) ||
+        ((u_BlockSize & (u_BlockSize - 1)) != 0))
+    {
+        return MEMORY_CACHE_CLASSES;
+    }
+
+    uintsys u_Class = 0;
+
+    while ((MEMORY_CACHE_MIN_BLOCK << u_Class) < u_BlockSize)
+    {
+        ++u_Class;
+    }
+
+    return u_Class;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Release_
+//
+//  Synopsis:   Gives every cached block back to the heap
+//----------------------------------------------------------------------------
+
+void MemoryCache::Release_ ()
+{
+    for (uintsys u_Class = 0; u_Class < MEMORY_CACHE_CLASSES; ++u_Class)
+    {
+        while (ap_Free_[u_Class] != 0)
+        {
+            Block* p_Block = ap_Free_[u_Class];
+
+            ap_Free_[u_Class] = p_Block->p_Next_;
+
+            std::free (p_Block);
+        }
+    }
+
+    stats_.u_BytesCached_ = 0;
+}
+
+uchar* MemoryCache::Allocate (uintsys u_BlockSize)
+{
+    MemoryCache* p_Cache = Current_();
+
+    if (p_Cache == 0)
+    {
+        return 0;
+    }
+
+    uintsys u_Class = SizeClass_ (u_BlockSize);
+
+    if ((u_Class == MEMORY_CACHE_CLASSES) || (p_Cache->ap_Free_[u_Class] == 0))
+    {
+        ++p_Cache->stats_.u_Misses_;
+
+        return 0;
+    }
+
+    Block* p_Block = p_Cache->ap_Free_[u_Class];
+
+    p_Cache->ap_Free_[u_Class] = p_Block->p_Next_;
+    p_Block->p_Next_           = 0;
+
+    ++p_Cache->stats_.u_Hits_;
+
+    p_Cache->stats_.u_BytesCached_ -= u_BlockSize;
+
+    return reinterpret_cast<uchar*> (p_Block);
+}
+
+bool MemoryCache::Free (uchar* p_Memory, uintsys u_BlockSize)
+{
+    MemoryCache* p_Cache = Current_();
+
+    if (p_Cache == 0)
+    {
+        return false;
+    }
+
+    MemoryCacheRegistry& registry = Registry();
+
+    uintsys u_Epoch = registry.u_Epoch_.LoadRelaxed();
+
+    if (p_Cache->u_TrimEpoch_ != u_Epoch)
+    {
+        p_Cache->Release_();
+        p_Cache->u_TrimEpoch_ = u_Epoch;
+    }
+
+    uintsys u_Class = SizeClass_ (u_BlockSize);
+
+    if ((u_Class == MEMORY_CACHE_CLASSES) ||
+        (p_Cache->stats_.u_BytesCached_ + u_BlockSize >
+         registry.u_Limit_.LoadRelaxed()))
+    {
+        ++p_Cache->stats_.u_Released_;
+
+        return false;
+    }
+
+    Block* p_Block = reinterpret_cast<Block*> (p_Memory);
+
+    p_Block->p_Next_           = p_Cache->ap_Free_[u_Class];
+    p_Cache->ap_Free_[u_Class] = p_Block;
+
+    ++p_Cache->stats_.u_Recycled_;
+
+    p_Cache->stats_.u_BytesCached_ += u_BlockSize;
+
+    return true;
+}
+
+void MemoryCache::Trim ()
+{
+    if (gp_ThreadCache != 0)
+    {
+        gp_ThreadCache->Release_();
+    }
+}
+
+void MemoryCache::TrimAll ()
+{
+    Registry().u_Epoch_.Increment();
+
+    Trim();
+}
+
+void MemoryCache::SetLimit (uintsys u_BytesPerThread)
+{
+    Registry().u_Limit_.Store (u_BytesPerThread);
+
+    if (u_BytesPerThread == 0)
+    {
+        TrimAll();
+    }
+}
+
+uintsys MemoryCache::Limit ()
+{
+    return Registry().u_Limit_.Load();
+}
+
+MemoryCacheStats MemoryCache::ThreadStats ()
+{
+    return (gp_ThreadCache != 0) ? gp_ThreadCache->stats_
+                                 : MemoryCacheStats();
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Stats
+//
+//  Synopsis:   Returns the counters of every thread added together
+//
+//  Notes:      Other threads update their counters without locking, so
+//              the totals are approximate while those threads are busy
+//----------------------------------------------------------------------------
+
+MemoryCacheStats MemoryCache::Stats ()
+{
+    MemoryCacheRegistry& registry = Registry();
+
+    MutexLocker lock (registry.mutex_);
+
+    MemoryCacheStats stats (registry.stats_Retired_);
+
+    for (MemoryCache* p_Cache = registry.p_First_; p_Cache != 0;
+         p_Cache = p_Cache->p_Next_)
+    {
+        stats.Add (p_Cache->stats_);
+    }
+
+    return stats;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     ThreadExit
+//
+//  Synopsis:   Gives the calling thread's cache back to the heap; blocks
+//              freed by the thread afterwards go straight to the heap
+//
+//  Notes:      Thread calls this itself; for any other thread the system
+//              calls it through ReleaseThreadCache
+//----------------------------------------------------------------------------
+
+void MemoryCache::ThreadExit ()
+{
+    gb_ThreadExited = true;
+
+    if (gp_ThreadCache != 0)
+    {
+        Registry().SetExitHook (0);
+
+        delete gp_ThreadCache;
+
+        gp_ThreadCache = 0;
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   RoundUp
+//
+//  Synopsis:   Rounds a size up to a multiple of a step, throwing if the
+//              result does not fit
+//----------------------------------------------------------------------------
+
+static uintsys RoundUp (uintsys u_Size, uintsys u_Step)
+{
+    uintsys u_Remainder = u_Size % u_Step;
+
+    if (u_Remainder == 0)
+    {
+        return u_Size;
+    }
+
+    uintsys u_Rounded = u_Size + (u_Step - u_Remainder);
+
+    if (u_Rounded < u_Size)
+    {
+        throw Exception ("HeapMemory: Out of memory");
+    }
+
+    return u_Rounded;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     BlockSize_
+//
+//  Synopsis:   Returns the size of block to allocate for at least
+//              u_MinSize bytes when the current block has u_OldSize
+//
+//  Notes:      Small blocks are powers of two, which the block cache
+//              recycles.  Large blocks grow by the growth factor and are
+//              rounded up to the growth step.
+//----------------------------------------------------------------------------
+
+uintsys HeapMemory::BlockSize_ (uintsys u_MinSize, uintsys u_OldSize)
+{
+    if (u_MinSize <= u_LargeBlockSize_)
+    {
+        uintsys u_Size = 32;
+
+        while (u_Size < u_MinSize)
+        {
+            u_Size = u_Size << 1;
+        }
+
+        return u_Size;
+    }
+
+    double d_Grown = double (u_OldSize) * d_GrowthFactor_;
+
+    uintsys u_Size = u_MinSize;
+
+    if ((d_Grown > double (u_MinSize)) && (d_Grown < double (~uintsys(0)/2)))
+    {
+        u_Size = (uintsys) d_Grown;
+    }
+
+    return RoundUp (u_Size, u_GrowthStep_);
+}
+
+void HeapMemory::SetGrowthFactor (double d_Factor)
+{
+    if (!(d_Factor > 1.0))
+    {
+        throw Exception ("HeapMemory::SetGrowthFactor: Factor must be "
+                         "greater than 1");
+    }
+
+    d_GrowthFactor_ = d_Factor;
+}
+
+void HeapMemory::SetGrowthStep (uintsys u_NumBytes)
+{
+    if (u_NumBytes == 0)
+    {
+        throw Exception ("HeapMemory::SetGrowthStep: Step must not be 0");
+    }
+
+    u_GrowthStep_ = u_NumBytes;
+}
+
+void HeapMemory::SetLargeBlockSize (uintsys u_NumBytes)
+{
+    const uintsys u_Max = 1UL << 30;    // powers of two stop here
+
+    u_LargeBlockSize_ = (u_NumBytes < MEMORY_CACHE_MAX_BLOCK)
+                      ? MEMORY_CACHE_MAX_BLOCK
+                      : ((u_NumBytes > u_Max) ? u_Max : u_NumBytes);
+}
+
+uchar* HeapMemory::Allocate_ (uintsys u_Length, uintsys& u_Allocated,
+                              uintsys u_OldCapacity)
 {
     uintsys u_LengthWithNulls = u_Length + 2;  // add room for two NULL bytes
 
@@ -83,10 +524,14 @@ uchar* HeapMemory::Allocate_ (uintsys u_Length, uintsys& u_Allocated)
         throw Exception ("HeapMemory::Allocate_: Integer overflow");
     }
 
-    u_Allocated = OptimumStringSize (u_LengthWithNulls);
+    u_Allocated = BlockSize_ (u_LengthWithNulls, u_OldCapacity + 2);
 
-    uchar* p_Memory = reinterpret_cast<uchar*> (new(std::nothrow)
-                          uintsys[u_Allocated/sizeof(uintsys)]);
+    uchar* p_Memory = MemoryCache::Allocate (u_Allocated);
+
+    if (p_Memory == 0)
+    {
+        p_Memory = static_cast<uchar*> (std::malloc (u_Allocated));
+    }
 
     if (p_Memory == 0)
     {
@@ -105,6 +550,60 @@ uchar* HeapMemory::Allocate_ (uintsys u_Length, uintsys& u_Allocated)
     return p_Memory;
 }
 
+//+---------------------------------------------------------------------------
+//  Method:     Grow_
+//
+//  Synopsis:   Grows a large block with realloc, which lets the C library
+//              remap the pages instead of copying them
+//
+//  Returns:    false if the block should be copied to a new one instead
+//----------------------------------------------------------------------------
+
+bool HeapMemory::Grow_ (uintsys u_NewExtent)
+{
+    if (b_Secure_ || (u_Capacity_ + 2 <= u_LargeBlockSize_))
+    {
+        return false;   // realloc would leave a copy behind, or not help
+    }
+
+    uintsys u_ExtentWithNulls = u_NewExtent + 2;
+
+    if (u_ExtentWithNulls < u_NewExtent)
+    {
+        throw Exception ("HeapMemory::Grow_: Integer overflow");
+    }
+
+    uintsys u_Allocated = BlockSize_ (u_ExtentWithNulls, u_Capacity_ + 2);
+
+    void* p_Memory = std::realloc (p_Memory_, u_Allocated);
+
+    if (p_Memory == 0)
+    {
+        throw Exception ("HeapMemory::Grow_: Out of memory");
+    }
+
+    p_Memory_   = static_cast<uchar*> (p_Memory);
+    u_Capacity_ = u_Allocated - 2;
+
+    p_Memory_[u_Capacity_]     = 0;
+    p_Memory_[u_Capacity_ + 1] = 0;
+
+    return true;
+}
+
+void HeapMemory::Free_ (uchar* p_Memory, uintsys u_Capacity, bool b_Wipe)
+{
+    if (b_Wipe)
+    {
+        WipeMemory (p_Memory, u_Capacity);    // destroy string contents
+    }
+
+    if (!MemoryCache::Free (p_Memory, u_Capacity + 2))
+    {
+        std::free (p_Memory);
+    }
+}
+
 uchar* HeapMemory::Expand (uintsys u_NumCharsBefore, uintsys u_NumCharsAfter)
 {
     uintsys u_ExtraChars = u_NumCharsBefore + u_NumCharsAfter;
@@ -117,18 +616,28 @@ uchar* HeapMemory::Expand (uintsys u_NumCharsBefore, uintsys u_NumCharsAfter)
 
     if ((u_TotalChars > u_Capacity_) || (u_Capacity_ == 0))
     {
+        if ((u_NumCharsBefore == 0) && (p_Memory_ != 0) &&
+            (u_Offset_ + u_TotalChars >= u_TotalChars) &&
+            Grow_ (u_Offset_ + u_TotalChars))
+        {
+            u_Length_ = u_TotalChars;
+
+            NullTerminate_();
+
+            return p_Memory_ + u_Offset_;
+        }
+
         uintsys u_NewCapacity = 0;
 
-        uchar* p_NewMemory = Allocate_ (u_TotalChars, u_NewCapacity);
+        uchar* p_NewMemory = Allocate_ (u_TotalChars, u_NewCapacity,
+                                        u_Capacity_);
 
         if (p_Memory_ != 0)
         {
             std::memcpy (p_NewMemory + u_NumCharsBefore,
                          PointerToFirstByte(), u_Length_);
 
-            ZeroMemory (p_Memory_, u_Capacity_);    // destroy old memory
-
-            delete [] p_Memory_;
+            Free_ (p_Memory_, u_Capacity_, b_Secure_);
         }
 
         p_Memory_   = p_NewMemory;
@@ -172,13 +681,11 @@ uchar* HeapMemory::Allocate (uintsys u_NumBytes)
     {
         uintsys u_NewCapacity = 0;
 
-        uchar* p_NewMemory = Allocate_ (u_NumBytes, u_NewCapacity);
+        uchar* p_NewMemory = Allocate_ (u_NumBytes, u_NewCapacity, 0);
 
         if (p_Memory_ != 0)
         {
-            ZeroMemory (p_Memory_, u_Capacity_);    // destroy old memory
-
-            delete [] p_Memory_;
+            Free_ (p_Memory_, u_Capacity_, b_Secure_);
         }
 
         p_Memory_   = p_NewMemory;
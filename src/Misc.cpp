@@ -42,17 +42,43 @@
 
 namespace mikestoolbox {
 
+#ifndef PLATFORM_WINDOWS
+//  Calling memset through a volatile pointer keeps the compiler from
+//  deciding that the stores are dead and removing them
+
+static void* (* const volatile gpf_Memset) (void*, int, size_t) = std::memset;
+#endif
+
+//+---------------------------------------------------------------------------
+//  Function:   WipeMemory
+//
+//  Synopsis:   Overwrites memory with zeros, even when the memory is about
+//              to be freed and the compiler could prove nobody reads it
+//----------------------------------------------------------------------------
+
+void WipeMemory (void* p, size_t n)
+{
+#if defined(PLATFORM_WINDOWS)
+    SecureZeroMemory (p, n);
+#elif defined(HAVE_MEMSET_S)
+    std::memset_s (p, n, 0, n);
+#else
+    gpf_Memset (p, 0, n);
+#endif
+}
+
 String Latin1ToUTF8 (const String& str)
 {
     String str_Result;
 
-    str_Result.Reserve (str.Length());
-
-    StringIter iter (str);
+    uintsys u_Length = str.Length();
 
-    while (iter)
+    if (u_Length != 0)
     {
-        str_Result.AppendUTF8 (*iter++);
+        uchar* p_Result = str_Result.Allocate (2*u_Length);
+
+        str_Result.Truncate (Unicode::Latin1ToUTF8 (str.PointerToFirstByte(),
+                                                    u_Length, p_Result));
     }
 
     return str_Result;
@@ -60,48 +86,102 @@ String Latin1ToUTF8 (const String& str)
 
 String UTF16ToUTF8 (const String& str)
 {
-    StringIter iter (str);
+    String str_Result;
 
-    String str_Result (Preallocate (str.Length()));
+    uintsys u_Length = str.Length();
 
-    ParseError error;
+    if (u_Length != 0)
+    {
+        ParseError error;
 
-    uintsys u = 0;
+        uchar* p_Result = str_Result.Allocate (u_Length/2*3);
 
-    while (iter.ParseUTF16Char (u, error))
-    {
-        str_Result.AppendUTF8 (u);
-    }
+        str_Result.Truncate (Unicode::UTF16ToUTF8 (str.PointerToFirstByte(),
+                                                   u_Length, p_Result,
+                                                   error));
 
-    if (error.IsOK() && !iter)
-    {
-        return str_Result;
+        if (!error)
+        {
+            throw Exception ("UTF16ToUTF8: Bad UTF-16 encoding");
+        }
     }
 
-    throw Exception ("UTF16ToUTF8: Bad UTF-16 encoding");
+    return str_Result;
 }
 
 String UTF32ToUTF8 (const String& str)
 {
-    StringIter iter (str);
+    String str_Result;
+
+    uintsys u_Length = str.Length();
+
+    if (u_Length != 0)
+    {
+        ParseError error;
+
+        uchar* p_Result = str_Result.Allocate (u_Length);
+
+        str_Result.Truncate (Unicode::UTF32ToUTF8 (str.PointerToFirstByte(),
+                                                   u_Length, p_Result,
+                                                   error));
 
-    String str_Result (Preallocate (str.Length()));
+        if (!error)
+        {
+            throw Exception ("UTF32ToUTF8: Bad UTF-32 encoding");
+        }
+    }
 
-    ParseError error;
+    return str_Result;
+}
+
+String UTF8ToUTF16 (const String& str)
+{
+    String str_Result;
 
-    uintsys u = 0;
+    uintsys u_Length = str.Length();
 
-    while (iter.ParseUTF32Char (u, error))
+    if (u_Length != 0)
     {
-        str_Result.AppendUTF8 (u);
+        ParseError error;
+
+        uchar* p_Result = str_Result.Allocate (2*u_Length);
+
+        str_Result.Truncate (Unicode::UTF8ToUTF16 (str.PointerToFirstByte(),
+                                                   u_Length, p_Result,
+                                                   error));
+
+        if (!error)
+        {
+            throw Exception ("UTF8ToUTF16: Bad UTF-8 encoding");
+        }
     }
 
-    if (error.IsOK() && !iter)
+    return str_Result;
+}
+
+String UTF8ToUTF32 (const String& str)
+{
+    String str_Result;
+
+    uintsys u_Length = str.Length();
+
+    if (u_Length != 0)
     {
-        return str_Result;
+        ParseError error;
+
+        uchar* p_Result = str_Result.Allocate (4*u_Length);
+
+        str_Result.Truncate (Unicode::UTF8ToUTF32 (str.PointerToFirstByte(),
+                                                   u_Length, p_Result,
+                                                   error));
+
+        if (!error)
+        {
+            throw Exception ("UTF8ToUTF32: Bad UTF-8 encoding");
+        }
     }
 
-    throw Exception ("UTF32ToUTF8: Bad UTF-32 encoding");
+    return str_Result;
 }
 
 } // namespace mikestoolbox
@@ -0,0 +1,791 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       MultiPattern.cpp
+//
+//  Synopsis:   Implementation of MultiPattern methods
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+#ifdef HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef HAVE_AVX2
+#include <immintrin.h>
+#endif
+
+namespace mikestoolbox {
+
+// each cell of the transition table holds the offset of the next state's
+// row, plus this bit if that state reports a pattern
+
+static const uint32 MULTI_PATTERN_MATCH = 0x80000000;
+static const uint32 MULTI_PATTERN_ROW   = 0x7fffffff;
+
+static const uintsys MULTI_PATTERN_SKIP_TRIES = 8;
+
+static inline bool IsLetter (uchar uc)
+{
+    return ((uc | 0x20) >= 'a') && ((uc | 0x20) <= 'z');
+}
+
+static inline uintsys LowestBit (uint32 u_Mask)
+{
+#ifdef __GNUC__
+    return __builtin_ctz (u_Mask);
+#else
+    uintsys u_Bit = 0;
+
+    while ((u_Mask & 1) == 0)
+    {
+        u_Mask >>= 1;
+        ++u_Bit;
+    }
+
+    return u_Bit;
+#endif
+}
+
+template<typename T>
+static T* NewArray (uintsys u_Count, T t_Fill)
+{
+    T* p = new(std::nothrow) T [u_Count ? u_Count : 1];
+
+    if (p == 0)
+    {
+        throw Exception ("MultiPattern::MultiPattern: Out of memory");
+    }
+
+    for (uintsys u = 0; u < u_Count; ++u)
+    {
+        p[u] = t_Fill;
+    }
+
+    return p;
+}
+
+//+---------------------------------------------------------------------------
+//  Class:      NoSkip, KeySkip, NibbleSkip
+//
+//  Synopsis:   Each moves past text that cannot begin a match, for use
+//              while the automaton is back at its root
+//
+//  Notes:      KeySkip compares 16 bytes at a time against up to three
+//              keys, which covers a few start bytes with either case of a
+//              letter counting as one.  NibbleSkip looks up both halves of
+//              32 bytes at a time in 16-entry tables (AVX2 only), which
+//              covers any set of ASCII start bytes; a byte above 0x7f may
+//              be stopped at without being one, which only costs a lookup.
+//----------------------------------------------------------------------------
+
+class NoSkip
+{
+public:
+
+    const uchar* Next (const uchar* p, const uchar*) const
+    {
+        return p;
+    }
+};
+
+static inline const uchar* SkipScalar (const uchar* p, const uchar* p_End,
+                                       const bool* ab_Start)
+{
+    while ((p < p_End) && !ab_Start[*p])
+    {
+        ++p;
+    }
+
+    return p;
+}
+
+#ifdef HAVE_SSE2
+
+class KeySkip
+{
+public:
+
+    KeySkip (const uchar* auc_Or, const uchar* auc_Value, uintsys u_NumKeys,
+             const bool* ab_Start)
+        : ab_Start_ (ab_Start)
+    {
+        // unused keys repeat the first one so that all three can be tested
+
+        for (uintsys u = 0; u < 3; ++u)
+        {
+            uintsys k = (u < u_NumKeys) ? u : 0;
+
+            av_Or_[u]    = _mm_set1_epi8 ((char) auc_Or[k]);
+            av_Value_[u] = _mm_set1_epi8 ((char) auc_Value[k]);
+        }
+    }
+
+    const uchar* Next (const uchar* p, const uchar* p_End) const
+    {
+        while (p + 16 <= p_End)
+        {
+            __m128i v = _mm_loadu_si128 ((const __m128i*) p);
+
+            __m128i m = _mm_or_si128 (
+                _mm_cmpeq_epi8 (_mm_or_si128 (v, av_Or_[0]), av_Value_[0]),
+                _mm_or_si128 (
+                _mm_cmpeq_epi8 (_mm_or_si128 (v, av_Or_[1]), av_Value_[1]),
+                _mm_cmpeq_epi8 (_mm_or_si128 (v, av_Or_[2]), av_Value_[2])));
+
+            uint32 u_Mask = (uint32) _mm_movemask_epi8 (m);
+
+            if (u_Mask != 0)
+            {
+                return p + LowestBit (u_Mask);
+            }
+
+            p += 16;
+        }
+
+        return SkipScalar (p, p_End, ab_Start_);
+    }
+
+private:
+
+    __m128i     av_Or_[3];
+    __m128i     av_Value_[3];
+    const bool* ab_Start_;
+};
+
+#endif
+
+#ifdef HAVE_AVX2
+
+__attribute__((target("avx2"), noinline))
+static const uchar* SkipNibblesAvx2 (const uchar* p, const uchar* p_End,
+                                     const uchar* auc_Low,
+                                     const uchar* auc_High)
+{
+    __m256i v_Low  = _mm256_broadcastsi128_si256 (
+                         _mm_loadu_si128 ((const __m128i*) auc_Low));
+    __m256i v_High = _mm256_broadcastsi128_si256 (
+                         _mm_loadu_si128 ((const __m128i*) auc_High));
+    __m256i v_Nibble = _mm256_set1_epi8 (0x0f);
+    __m256i v_Zero   = _mm256_setzero_si256();
+
+    while (p + 32 <= p_End)
+    {
+        __m256i v  = _mm256_loadu_si256 ((const __m256i*) p);
+        __m256i lo = _mm256_and_si256 (v, v_Nibble);
+        __m256i hi = _mm256_and_si256 (_mm256_srli_epi16 (v, 4), v_Nibble);
+
+        __m256i t = _mm256_and_si256 (_mm256_shuffle_epi8 (v_Low,  lo),
+                                      _mm256_shuffle_epi8 (v_High, hi));
+
+        uint32 u_Mask = ~(uint32) _mm256_movemask_epi8 (
+                                      _mm256_cmpeq_epi8 (t, v_Zero));
+        if (u_Mask != 0)
+        {
+            return p + LowestBit (u_Mask);
+        }
+
+        p += 32;
+    }
+
+    return p;
+}
+
+class NibbleSkip
+{
+public:
+
+    NibbleSkip (const uchar* auc_Low, const uchar* auc_High,
+                const bool* ab_Start)
+        : auc_Low_  (auc_Low)
+        , auc_High_ (auc_High)
+        , ab_Start_ (ab_Start)
+    {
+        // nothing
+    }
+
+    const uchar* Next (const uchar* p, const uchar* p_End) const
+    {
+        // a start byte close by is common, so look before calling out
+
+        const uchar* p_Near = (p_End - p > 8) ? (p + 8) : p_End;
+
+        p = SkipScalar (p, p_Near, ab_Start_);
+
+        if (p < p_Near)
+        {
+            return p;
+        }
+
+        p = SkipNibblesAvx2 (p, p_End, auc_Low_, auc_High_);
+
+        return SkipScalar (p, p_End, ab_Start_);
+    }
+
+private:
+
+    const uchar* auc_Low_;
+    const uchar* auc_High_;
+    const bool*  ab_Start_;
+};
+
+#endif
+
+//+---------------------------------------------------------------------------
+//  Method:     MultiPatternData
+//
+//  Synopsis:   Constructors and destructor
+//----------------------------------------------------------------------------
+
+MultiPatternData::MultiPatternData ()
+    : pu_Next_       (0)
+    , pn_Output_     (0)
+    , pu_Dictionary_ (0)
+    , pn_Duplicate_  (0)
+    , pu_Length_     (0)
+{
+    Reset_();
+}
+
+MultiPatternData::MultiPatternData (AlwaysShared)
+    : SharedData     (AlwaysShared())
+    , pu_Next_       (0)
+    , pn_Output_     (0)
+    , pu_Dictionary_ (0)
+    , pn_Duplicate_  (0)
+    , pu_Length_     (0)
+{
+    Reset_();
+}
+
+MultiPatternData::~MultiPatternData ()
+{
+    delete [] pu_Next_;
+    delete [] pn_Output_;
+    delete [] pu_Dictionary_;
+    delete [] pn_Duplicate_;
+    delete [] pu_Length_;
+}
+
+void MultiPatternData::Reset_ ()
+{
+    b_CaseSensitive_ = true;
+    u_NumClasses_    = 1;
+    u_NumStates_     = 0;
+    u_NumStart_      = 0;
+    u_NumKeys_       = 0;
+
+    std::memset (auc_Class_,    0, sizeof (auc_Class_));
+    std::memset (ab_Start_,     0, sizeof (ab_Start_));
+    std::memset (auc_KeyOr_,    0, sizeof (auc_KeyOr_));
+    std::memset (auc_KeyValue_, 0, sizeof (auc_KeyValue_));
+    std::memset (auc_Low_,      0, sizeof (auc_Low_));
+    std::memset (auc_High_,     0, sizeof (auc_High_));
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     AssignClasses_
+//
+//  Synopsis:   Gives each byte used by a pattern its own column in the
+//              transition table, and every other byte one shared column
+//
+//  Notes:      Ignoring case puts both cases of a letter in one column.
+//----------------------------------------------------------------------------
+
+void MultiPatternData::AssignClasses_ ()
+{
+    bool ab_Used[256];
+
+    std::memset (ab_Used, 0, sizeof (ab_Used));
+
+    StringListIter iter (strl_Patterns_);
+
+    while (iter)
+    {
+        const String& str (*iter);
+
+        ++iter;
+
+        const uchar* p     = str.PointerToFirstByte();
+        const uchar* p_End = p + str.Length();
+
+        while (p < p_End)
+        {
+            uchar uc = *p++;
+
+            ab_Used[b_CaseSensitive_ ? uc : ByteToLower (uc)] = true;
+        }
+    }
+
+    uintsys u_NumUsed = 0;
+
+    for (uintsys u = 0; u < 256; ++u)
+    {
+        if (ab_Used[u])
+        {
+            auc_Class_[u] = (uchar) u_NumUsed++;
+        }
+    }
+
+    u_NumClasses_ = u_NumUsed;
+
+    for (uintsys u = 0; u < 256; ++u)
+    {
+        if (ab_Used[u])
+        {
+            continue;
+        }
+
+        if (!b_CaseSensitive_ && (ByteToLower ((uchar) u) != u))
+        {
+            auc_Class_[u] = auc_Class_[ByteToLower ((uchar) u)];
+
+            if (ab_Used[ByteToLower ((uchar) u)])
+            {
+                continue;
+            }
+        }
+
+        auc_Class_[u] = (uchar) u_NumUsed;
+        u_NumClasses_ = u_NumUsed + 1;
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     BuildTrie_
+//
+//  Synopsis:   Adds each pattern to a trie held in the transition table,
+//              where 0 means there is no edge yet
+//----------------------------------------------------------------------------
+
+void MultiPatternData::BuildTrie_ ()
+{
+    uintsys u_NumPatterns = strl_Patterns_.NumItems();
+    uintsys u_MaxStates   = 1 + strl_Patterns_.Size();
+
+    if (u_MaxStates > MULTI_PATTERN_ROW / u_NumClasses_)
+    {
+        throw Exception ("MultiPattern::MultiPattern: Too many patterns");
+    }
+
+    pu_Next_       = NewArray<uint32>  (u_MaxStates * u_NumClasses_, 0);
+    pn_Output_     = NewArray<intsys>  (u_MaxStates, -1);
+    pu_Dictionary_ = NewArray<uint32>  (u_MaxStates, 0);
+    pn_Duplicate_  = NewArray<intsys>  (u_NumPatterns, -1);
+    pu_Length_     = NewArray<uintsys> (u_NumPatterns, 0);
+
+    u_NumStates_ = 1;
+
+    StringListIter iter (strl_Patterns_);
+
+    for (uintsys u_Pattern = 0; iter; ++u_Pattern)
+    {
+        const String& str (*iter);
+
+        ++iter;
+
+        pu_Length_[u_Pattern] = str.Length();
+
+        if (str.IsEmpty())
+        {
+            continue;
+        }
+
+        const uchar* p     = str.PointerToFirstByte();
+        const uchar* p_End = p + str.Length();
+
+        uintsys u_Row = 0;
+
+        while (p < p_End)
+        {
+            uint32& u_Cell = pu_Next_[u_Row + auc_Class_[*p++]];
+
+            if (u_Cell == 0)
+            {
+                u_Cell = (uint32) (u_NumStates_++ * u_NumClasses_);
+            }
+
+            u_Row = u_Cell;
+        }
+
+        intsys* pn_Last = &pn_Output_[u_Row / u_NumClasses_];
+
+        while (*pn_Last >= 0)
+        {
+            pn_Last = &pn_Duplicate_[*pn_Last];
+        }
+
+        *pn_Last = (intsys) u_Pattern;
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     LinkFailures_
+//
+//  Synopsis:   Turns the trie into a full automaton
+//
+//  Notes:      States are visited breadth first, so the state a missing
+//              edge falls back to already has a complete row to copy.  The
+//              dictionary link of a state is the longest suffix of it that
+//              is itself a pattern.
+//----------------------------------------------------------------------------
+
+void MultiPatternData::LinkFailures_ ()
+{
+    uintsys C = u_NumClasses_;
+
+    ArrayPointerHolder<uint32> pu_Fail  (NewArray<uint32> (u_NumStates_, 0));
+    ArrayPointerHolder<uint32> pu_Queue (NewArray<uint32> (u_NumStates_, 0));
+
+    uintsys u_Head = 0;
+    uintsys u_Tail = 0;
+
+    for (uintsys c = 0; c < C; ++c)
+    {
+        if (pu_Next_[c] != 0)
+        {
+            pu_Queue[u_Tail++] = pu_Next_[c] / C;
+        }
+    }
+
+    while (u_Head < u_Tail)
+    {
+        uintsys u_State   = pu_Queue[u_Head++];
+        uint32* pu_Row    = pu_Next_ + u_State * C;
+        uint32* pu_Parent = pu_Next_ + pu_Fail[u_State] * C;
+
+        for (uintsys c = 0; c < C; ++c)
+        {
+            if (pu_Row[c] == 0)
+            {
+                pu_Row[c] = pu_Parent[c];
+
+                continue;
+            }
+
+            uintsys u_Child = pu_Row[c] / C;
+            uintsys u_Fail  = pu_Parent[c] / C;
+
+            pu_Fail[u_Child]        = (uint32) u_Fail;
+            pu_Dictionary_[u_Child] = (pn_Output_[u_Fail] >= 0) ?
+                                      (uint32) u_Fail : pu_Dictionary_[u_Fail];
+
+            pu_Queue[u_Tail++] = (uint32) u_Child;
+        }
+    }
+
+    for (uintsys u = 0; u < u_NumStates_ * C; ++u)
+    {
+        uintsys u_Target = pu_Next_[u] / C;
+
+        if ((pn_Output_[u_Target] >= 0) || (pu_Dictionary_[u_Target] != 0))
+        {
+            pu_Next_[u] |= MULTI_PATTERN_MATCH;
+        }
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     FindStartBytes_
+//
+//  Synopsis:   Records which bytes can begin a match and sets up the tables
+//              used to skip the rest
+//----------------------------------------------------------------------------
+
+void MultiPatternData::FindStartBytes_ ()
+{
+    for (uintsys u = 0; u < 256; ++u)
+    {
+        if ((pu_Next_[auc_Class_[u]] & MULTI_PATTERN_ROW) != 0)
+        {
+            ab_Start_[u] = true;
+            ++u_NumStart_;
+        }
+    }
+
+    for (uintsys u = 0; u < 16; ++u)
+    {
+        auc_High_[u] = (uchar) (1 << (u & 7));
+    }
+
+    uintsys u_NumKeys = 0;
+
+    for (uintsys u = 0; u < 256; ++u)
+    {
+        if (!ab_Start_[u])
+        {
+            continue;
+        }
+
+        auc_Low_[u & 15] |= (uchar) (1 << ((u >> 4) & 7));
+
+        uchar uc       = (uchar) u;
+        bool  b_Paired = IsLetter (uc) && ab_Start_[uc ^ 0x20];
+
+        if (b_Paired && (uc < 'a'))
+        {
+            continue;   // counted with its lower case
+        }
+
+        if (u_NumKeys < 3)
+        {
+            auc_KeyOr_[u_NumKeys]    = b_Paired ? 0x20 : 0;
+            auc_KeyValue_[u_NumKeys] = uc;
+        }
+
+        ++u_NumKeys;
+    }
+
+    u_NumKeys_ = (u_NumKeys <= 3) ? u_NumKeys : 0;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     MultiPattern
+//
+//  Synopsis:   Compiles the patterns
+//----------------------------------------------------------------------------
+
+MultiPattern::MultiPattern (const StringList& strl_Patterns,
+                            bool b_CaseSensitive)
+    : SharedResource (RESOURCE_NEW_ON_WRITE,
+                      new(std::nothrow) MultiPatternData)
+{
+    MultiPatternData* p_Data = ModifyData();
+
+    p_Data->strl_Patterns_   = strl_Patterns;
+    p_Data->b_CaseSensitive_ = b_CaseSensitive;
+
+    p_Data->AssignClasses_();
+    p_Data->BuildTrie_();
+    p_Data->LinkFailures_();
+    p_Data->FindStartBytes_();
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   Advance
+//
+//  Synopsis:   Runs the automaton until it reaches a state that reports a
+//              pattern or the end of the text, or, if asked, until it is
+//              back at the root
+//----------------------------------------------------------------------------
+
+static inline const uchar* Advance (const uint32* pu_Next,
+                                    const uchar* auc_Class,
+                                    const uchar* p, const uchar* p_End,
+                                    uint32& u_Cell, bool b_StopAtRoot)
+{
+    uint32 u = u_Cell;
+
+    while (p < p_End)
+    {
+        u = pu_Next[(u & MULTI_PATTERN_ROW) + auc_Class[*p++]];
+
+        if (((u & MULTI_PATTERN_MATCH) != 0) || (b_StopAtRoot && (u == 0)))
+        {
+            break;
+        }
+    }
+
+    u_Cell = u;
+
+    return p;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Run_
+//
+//  Synopsis:   Runs the automaton over the text, reporting matches to the
+//              caller's match or list
+//
+//  Notes:      Without a list the scan stops at the first match.  The
+//              skip is given up for the rest of the text if it averages
+//              fewer than 8 bytes over MULTI_PATTERN_SKIP_TRIES tries.
+//----------------------------------------------------------------------------
+
+template<class SKIP>
+uintsys MultiPattern::Run_ (const SKIP& skip,
+                            const uchar* p_Begin, uintsys u_Length,
+                            MultiPatternMatch* p_First,
+                            MultiPatternMatchList* p_List) const
+{
+    const MultiPatternData* p_Data = ViewData();
+
+    const uint32* pu_Next   = p_Data->pu_Next_;
+    const uchar*  auc_Class = p_Data->auc_Class_;
+
+    const uchar* p     = p_Begin;
+    const uchar* p_End = p_Begin + u_Length;
+
+    uintsys u_Found   = 0;
+    uint32  u_Cell    = 0;
+    uintsys u_Skips   = 0;
+    uintsys u_Skipped = 0;
+
+    while (p < p_End)
+    {
+        if (u_Skips < MULTI_PATTERN_SKIP_TRIES)
+        {
+            if (u_Cell == 0)
+            {
+                const uchar* p_Next = skip.Next (p, p_End);
+
+                u_Skipped += p_Next - p;
+                p          = p_Next;
+
+                if (p == p_End)
+                {
+                    break;
+                }
+
+                // keep skipping only while it pays
+
+                if ((++u_Skips == MULTI_PATTERN_SKIP_TRIES) &&
+                    (u_Skipped >= MULTI_PATTERN_SKIP_TRIES * 8))
+                {
+                    u_Skips   = 0;
+                    u_Skipped = 0;
+                }
+            }
+
+            p = Advance (pu_Next, auc_Class, p, p_End, u_Cell, true);
+        }
+        else
+        {
+            p = Advance (pu_Next, auc_Class, p, p_End, u_Cell, false);
+        }
+
+        if ((u_Cell & MULTI_PATTERN_MATCH) == 0)
+        {
+            continue;
+        }
+
+        uintsys u_End   = p - p_Begin;
+        uintsys u_State = (u_Cell & MULTI_PATTERN_ROW) / p_Data->u_NumClasses_;
+
+        if (p_Data->pn_Output_[u_State] < 0)
+        {
+            u_State = p_Data->pu_Dictionary_[u_State];
+        }
+
+        while (u_State != 0)
+        {
+            intsys n = p_Data->pn_Output_[u_State];
+
+            for (; n >= 0; n = p_Data->pn_Duplicate_[n])
+            {
+                uintsys u_Bytes = p_Data->pu_Length_[n];
+
+                MultiPatternMatch match (n, u_End - u_Bytes, u_Bytes);
+
+                ++u_Found;
+
+                if (p_List == 0)
+                {
+                    if (p_First != 0)
+                    {
+                        *p_First = match;
+                    }
+
+                    return u_Found;
+                }
+
+                p_List->Append (match);
+            }
+
+            u_State = p_Data->pu_Dictionary_[u_State];
+        }
+    }
+
+    return u_Found;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Scan_
+//
+//  Synopsis:   Picks a way to skip text that cannot begin a match, based
+//              on the start bytes and the ByteSearch engine, and runs the
+//              automaton
+//----------------------------------------------------------------------------
+
+uintsys MultiPattern::Scan_ (const uchar* p, uintsys u_Length,
+                             MultiPatternMatch* p_First,
+                             MultiPatternMatchList* p_List) const
+{
+    const MultiPatternData* p_Data = ViewData();
+
+    if (p_Data->u_NumStates_ <= 1)
+    {
+        return 0;
+    }
+
+    switch (ByteSearch::Engine())
+    {
+#ifdef HAVE_AVX2
+    case BYTE_SEARCH_AVX2:
+        if (p_Data->u_NumStart_ <= MULTI_PATTERN_PREFILTER_BYTES)
+        {
+            NibbleSkip skip (p_Data->auc_Low_, p_Data->auc_High_,
+                             p_Data->ab_Start_);
+
+            return Run_ (skip, p, u_Length, p_First, p_List);
+        }
+        break;
+#endif
+#ifdef HAVE_SSE2
+    case BYTE_SEARCH_SSE2:
+        if (p_Data->u_NumKeys_ != 0)
+        {
+            KeySkip skip (p_Data->auc_KeyOr_, p_Data->auc_KeyValue_,
+                          p_Data->u_NumKeys_, p_Data->ab_Start_);
+
+            return Run_ (skip, p, u_Length, p_First, p_List);
+        }
+        break;
+#endif
+    default:
+        break;
+    }
+
+    return Run_ (NoSkip(), p, u_Length, p_First, p_List);
+}
+
+} // namespace mikestoolbox
@@ -0,0 +1,331 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       MutexProfile.cpp
+//
+//  Synopsis:   Registry and reporting of lock contention statistics
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+namespace mikestoolbox {
+
+//+---------------------------------------------------------------------------
+//  Class:      MutexRegistry
+//
+//  Synopsis:   Every live profile, and the totals of destroyed mutexes by
+//              name so that short-lived mutexes still show up
+//----------------------------------------------------------------------------
+
+class MutexRegistry
+{
+public:
+
+    MutexRegistry ()
+        : mutex_       ()
+        , p_First_     (0)
+        , map_Retired_ ()
+    {
+        // nothing
+    }
+
+    Mutex                   mutex_;
+    MutexProfile*           p_First_;
+    Map<String,MutexStats>  map_Retired_;
+};
+
+//+---------------------------------------------------------------------------
+//  Function:   Registry
+//
+//  Synopsis:   The registry is created on first use and never destroyed,
+//              since named static mutexes in other files may be
+//              constructed before or destroyed after anything here
+//----------------------------------------------------------------------------
+
+static MutexRegistry& Registry ()
+{
+    static MutexRegistry* p_Registry = new MutexRegistry;
+
+    return *p_Registry;
+}
+
+//+---------------------------------------------------------------------------
+//  Class:      MoreWaitFirst
+//
+//  Synopsis:   Orders a report with the most time spent waiting first
+//----------------------------------------------------------------------------
+
+class MoreWaitFirst
+{
+public:
+
+    bool operator () (const MutexStats& s1, const MutexStats& s2) const
+    {
+        if (s1.TotalWait() != s2.TotalWait())
+        {
+            return (s1.TotalWait() > s2.TotalWait());
+        }
+
+        return (s1.Name() < s2.Name());
+    }
+};
+
+static String ReportColumn (uint64 u, uintsys u_Width)
+{
+    String str;
+
+    str.Append (u);
+    str.PadFront (u_Width);
+
+    return str;
+}
+
+static String ReportMicroseconds (double d_Seconds, uintsys u_Width)
+{
+    return ReportColumn (uint64 (d_Seconds * 1000000.0 + 0.5), u_Width);
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     MutexProfile
+//
+//  Synopsis:   Constructor
+//----------------------------------------------------------------------------
+
+MutexProfile::MutexProfile (const char* pz_Name)
+    : stats_      (pz_Name)
+    , timer_Hold_ ()
+    , p_Next_     (0)
+    , p_Prev_     (0)
+{
+    // nothing
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     IsEnabled
+//
+//  Synopsis:   Returns true if the library was built with PROFILE_MUTEXES
+//----------------------------------------------------------------------------
+
+bool MutexProfile::IsEnabled ()
+{
+#if defined(PROFILE_MUTEXES) && !defined(SINGLE_THREADED)
+    return true;
+#else
+    return false;
+#endif
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Register_
+//
+//  Synopsis:   Creates the profile for a newly constructed named Mutex
+//----------------------------------------------------------------------------
+
+MutexProfile* MutexProfile::Register_ (const char* pz_Name)
+{
+    MutexRegistry& registry = Registry();
+    MutexProfile*  p_Profile = new MutexProfile (pz_Name);
+
+    MutexLocker lock (registry.mutex_);
+
+    p_Profile->p_Next_ = registry.p_First_;
+
+    if (registry.p_First_ != 0)
+    {
+        registry.p_First_->p_Prev_ = p_Profile;
+    }
+
+    registry.p_First_ = p_Profile;
+
+    return p_Profile;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Unregister_
+//
+//  Synopsis:   Folds the profile of a destroyed Mutex into the totals kept
+//              for its name
+//----------------------------------------------------------------------------
+
+void MutexProfile::Unregister_ (MutexProfile* p_Profile)
+{
+    MutexRegistry& registry = Registry();
+
+    {
+        MutexLocker lock (registry.mutex_);
+
+        if (p_Profile->p_Prev_ != 0)
+        {
+            p_Profile->p_Prev_->p_Next_ = p_Profile->p_Next_;
+        }
+        else
+        {
+            registry.p_First_ = p_Profile->p_Next_;
+        }
+
+        if (p_Profile->p_Next_ != 0)
+        {
+            p_Profile->p_Next_->p_Prev_ = p_Profile->p_Prev_;
+        }
+
+        const String& str_Name = p_Profile->stats_.Name();
+        MutexStats&   stats    = registry.map_Retired_[str_Name];
+
+        if (stats.Name().IsEmpty())
+        {
+            stats.str_Name_ = str_Name;
+        }
+
+        stats.Add (p_Profile->stats_);
+    }
+
+    delete p_Profile;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Snapshot
+//
+//  Synopsis:   Returns the statistics of every named Mutex, combined by
+//              name, with the most time spent waiting first
+//----------------------------------------------------------------------------
+
+MutexStatsList MutexProfile::Snapshot ()
+{
+    MutexRegistry& registry = Registry();
+
+    Map<String,MutexStats> map_Stats;
+
+    {
+        MutexLocker lock (registry.mutex_);
+
+        map_Stats = registry.map_Retired_;
+
+        for (MutexProfile* p = registry.p_First_; p != 0; p = p->p_Next_)
+        {
+            MutexStats& stats = map_Stats[p->stats_.Name()];
+
+            if (stats.Name().IsEmpty())
+            {
+                stats.str_Name_ = p->stats_.Name();
+            }
+
+            stats.Add (p->stats_);
+        }
+    }
+
+    MutexStatsList list_Stats;
+
+    for (MapIter<String,MutexStats> iter (map_Stats); iter; ++iter)
+    {
+        list_Stats.Append (iter.Value());
+    }
+
+    list_Stats.Sort (MoreWaitFirst());
+
+    return list_Stats;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Report
+//
+//  Synopsis:   Formats a Snapshot() as a table, one named Mutex per line.
+//              Times are in microseconds.
+//----------------------------------------------------------------------------
+
+String MutexProfile::Report ()
+{
+    MutexStatsList list_Stats (Snapshot());
+
+    uintsys u_NameWidth = 5;
+
+    for (ListIter<MutexStats> iter (list_Stats); iter; ++iter)
+    {
+        u_NameWidth = Maximum (u_NameWidth, iter->Name().Length());
+    }
+
+    String str_Report ("mutex");
+
+    str_Report.PadEnd (u_NameWidth);
+    str_Report.Append ("     acquired    contended"
+                       "    wait (us)     max wait"
+                       "    hold (us)     max hold\n");
+
+    for (ListIter<MutexStats> iter (list_Stats); iter; ++iter)
+    {
+        String str_Name (iter->Name());
+
+        str_Name.PadEnd (u_NameWidth);
+
+        str_Report.Append (str_Name);
+        str_Report.Append (ReportColumn       (iter->Acquisitions(), 13));
+        str_Report.Append (ReportColumn       (iter->Contentions(),  13));
+        str_Report.Append (ReportMicroseconds (iter->TotalWait(),    13));
+        str_Report.Append (ReportMicroseconds (iter->MaxWait(),      13));
+        str_Report.Append (ReportMicroseconds (iter->TotalHold(),    13));
+        str_Report.Append (ReportMicroseconds (iter->MaxHold(),      13));
+        str_Report.Append ('\n');
+    }
+
+    return str_Report;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Reset
+//
+//  Synopsis:   Zeroes every counter.  A Mutex which is held at the time
+//              still adds its hold time when it is unlocked.
+//----------------------------------------------------------------------------
+
+void MutexProfile::Reset ()
+{
+    MutexRegistry& registry = Registry();
+
+    MutexLocker lock (registry.mutex_);
+
+    registry.map_Retired_.Clear();
+
+    for (MutexProfile* p = registry.p_First_; p != 0; p = p->p_Next_)
+    {
+        p->stats_.Clear();
+    }
+}
+
+} // namespace mikestoolbox
@@ -861,7 +861,7 @@ bool Socket::EnableTcpNoDelay_ (bool b_Enable)
 
 TcpListener::TcpListener (SOCKET h_Socket)
     : Socket               (h_Socket)
-    , mutex_Accept_        ()
+    , mutex_Accept_        ("TcpListener::mutex_Accept_")
     , u_RecvChunkSize_     (SOCKET_RECV_CHUNK_SIZE)
     , u_MaxReadAhead_      (SOCKET_MAX_READ_AHEAD)
     , u_MaxLineLength_     (0)
@@ -1330,6 +1330,25 @@ bool TcpSocket::SendData (const String& str_Data, double d_Timeout)
 {
     strl_SendBuffer_.Append (str_Data);
 
+    return SendBuffered_ (d_Timeout);
+}
+
+bool TcpSocket::SendData (const StringBuilder& sb_Data, double d_Timeout)
+{
+    strl_SendBuffer_.Append (sb_Data.Pieces());
+
+    return SendBuffered_ (d_Timeout);
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     SendBuffered_
+//
+//  Synopsis:   Sends some of the send buffer once it holds a few packets
+//              worth of data, after SendData has queued more
+//----------------------------------------------------------------------------
+
+bool TcpSocket::SendBuffered_ (double d_Timeout)
+{
     if (!IsWritable())
     {
         SetLastError_ (ERROR_SOCKET_NOT_WRITABLE);
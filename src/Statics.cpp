@@ -61,6 +61,7 @@ const intsys gn_MultiThreadedZero  = 0;
 } // namespace internal
 
 int  DoubleFormat::n_DefaultPrecision_   = 8;
+bool DoubleFormat::b_DefaultShortest_    = false;
 bool DoubleFormat::b_DefaultScientific_  = false;
 bool DoubleFormat::b_DefaultDecimal_     = false;
 
@@ -78,6 +79,15 @@ const StringList gstrl_EmptyStringListToInitializeEmptyListBaseClass;
 
 double AutoPrintTimer::d_DefaultThreshold_ = 0.0;
 
+uintsys Thread::u_DefaultStackSize_ = 0;
+
+ByteSearchEngine ByteSearch::e_Engine_ = BYTE_SEARCH_UNKNOWN;
+
+bool    HeapMemory::b_DefaultSecure_  = false;
+double  HeapMemory::d_GrowthFactor_   = 1.5;
+uintsys HeapMemory::u_GrowthStep_     = 2 * 1024 * 1024;
+uintsys HeapMemory::u_LargeBlockSize_ = 1024 * 1024;
+
 const uintsys   Date::u_SecondsPerDay_ = 24 * 60 * 60;
 const Date      Date::date_UNIX_Epoch_ (FourDigitYear (1970), 1, 1);
 
@@ -69,25 +69,6 @@ static const uchar auc_HexValue[256] = {
     __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __
 };
 
-static const uchar auc_Base64Decode[256] = {
-    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
-    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
-    __, __, __, __, __, __, __, __, __, __, __, 62, __, __, __, 63,
-    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, __, __, __, __, __, __,
-    __,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
-    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, __, __, __, __, __,
-    __, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
-    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, __, __, __, __, __,
-    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
-    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
-    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
-    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
-    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
-    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
-    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __,
-    __, __, __, __, __, __, __, __, __, __, __, __, __, __, __, __
-};
-
 #undef __
 
 // table of lengths of UTF-8 byte sequences indexed by the first byte
@@ -321,6 +302,50 @@ bool StringIter::Extract (String& str)
     return true;
 }
 
+//+---------------------------------------------------------------------------
+//  Method:     ExtractArray_
+//
+//  Synopsis:   Copies u_Count values of u_Width bytes into p_Out, swapping
+//              the bytes of each when their order is not the machine's
+//----------------------------------------------------------------------------
+
+bool StringIter::ExtractArray_ (void* p_Out, uintsys u_Count, uintsys u_Width,
+                                ParseError& error)
+{
+    if (u_Count > Capacity() / u_Width)
+    {
+        error.SetUnexpectedEndOfData();
+
+        return false;
+    }
+
+    if (u_Count == 0)
+    {
+        return true;
+    }
+
+    if (b_LittleEndian_ == ByteOrder::IsLittleEndian())
+    {
+        std::memcpy (p_Out, p_Char_, u_Count * u_Width);
+    }
+    else if (u_Width == 2)
+    {
+        ByteOrder::SwapArray16 (p_Char_, u_Count, p_Out);
+    }
+    else if (u_Width == 4)
+    {
+        ByteOrder::SwapArray32 (p_Char_, u_Count, p_Out);
+    }
+    else
+    {
+        ByteOrder::SwapArray64 (p_Char_, u_Count, p_Out);
+    }
+
+    p_Char_ += u_Count * u_Width;
+
+    return true;
+}
+
 bool StringIter::SkipChar (char c, ParseError& error)
 {
     uchar uc = 0;
@@ -746,136 +771,83 @@ StringIter& StringIter::operator-= (uintsys u_NumBytes)
     return *this;
 }
 
-static inline uintsys MakeLowBitMask (uintsys u_NumBits)
-{
-    uint32 u_Mask = 0xFFFFFFFF;
-
-    return u_Mask >> (32 - u_NumBits);
-}
-
-static inline bool ExtractBytes (StringIter& iter, uintsys u_NumBytes,
-                                 uintsys& u, ParseError& error)
-{
-    u = 0;
-
-    switch (u_NumBytes)
-    {
-        case 0: return true;
-        case 1: return iter.ExtractUint8  (u, error);
-        case 2: return iter.ExtractUint16 (u, error);
-        case 3: return iter.ExtractUint24 (u, error);
-        case 4: return iter.ExtractUint32 (u, error);
-    }
-
-    error.SetNumericOverflow();
-
-    return false;
-}
+//+---------------------------------------------------------------------------
+//  Method:     Refill_
+//
+//  Synopsis:   Tops the bit register up with as many whole bytes as fit
+//
+//  Notes:      With eight bytes left one unaligned load does it; bits of
+//              the word beyond the bytes counted are the next bits of the
+//              data anyway, so loading them again later changes nothing
+//----------------------------------------------------------------------------
 
-bool StringBitIter::ExtractBitsBigEndian_ (uintsys u_NumBits, uintsys& u,
-                                           ParseError& error)
+void StringBitIter::Refill_ ()
 {
-    u = 0;
-
-    if (u_NumBits == 0)
+    if (p_End_ - p_Char_ >= 8)
     {
-        return true;
-    }
+        uintsys u_NumBytes = (64 - u_NumBits_) / 8;
 
-    uintsys u_BitsNeeded   = u_NumBits + u_BitOffset_;
-    uintsys u_BytesNeeded  = (u_BitsNeeded + 7) / 8;
-    uintsys u_NewBitOffset = u_BitsNeeded % 8;
+        if (b_LittleEndian_)
+        {
+            u_Bits_ |= ByteOrder::LoadUint64LE (p_Char_) << u_NumBits_;
+        }
+        else
+        {
+            u_Bits_ |= ByteOrder::LoadUint64BE (p_Char_) >> u_NumBits_;
+        }
 
-    if (iter_.Capacity() < u_BytesNeeded)
-    {
-        error.SetUnexpectedEndOfData();
+        p_Char_    += u_NumBytes;
+        u_NumBits_ += u_NumBytes * 8;
 
-        return false;
+        return;
     }
 
-    StringIter temp (iter_);
-
-    if (!ExtractBytes (temp, u_BytesNeeded, u, error))
+    while ((p_Char_ < p_End_) && (u_NumBits_ <= 56))
     {
-        return false;
-    }
-
-    uintsys u_Shift = (u_NewBitOffset == 0) ? 0 : (8 - u_NewBitOffset);
+        uint64 u_Byte = *p_Char_++;
 
-    u = (u >> u_Shift) & MakeLowBitMask (u_NumBits);
-
-    u_BitOffset_ = u_NewBitOffset;
+        if (b_LittleEndian_)
+        {
+            u_Bits_ |= u_Byte << u_NumBits_;
+        }
+        else
+        {
+            u_Bits_ |= u_Byte << (56 - u_NumBits_);
+        }
 
-    if (u_NewBitOffset == 0)
-    {
-        iter_.Swap (temp);
+        u_NumBits_ += 8;
     }
-    else
-    {
-        iter_ += (u_BytesNeeded - 1);
-    }
-
-    return true;
 }
 
-static inline uintsys SwapEndianness (uintsys u_NumBytes, uintsys u)
-{
-    switch (u_NumBytes)
-    {
-        case 0: return 0;
-        case 1: return u & 0xFF;
-        case 2: return SwapEndian16Bit (u);
-        case 3: return SwapEndian24Bit (u);
-        case 4: return SwapEndian32Bit (u);
-    }
-
-    throw Exception ("SwapEndianness: can't swap more than 4 bytes");
-}
+//+---------------------------------------------------------------------------
+//  Method:     SetByteOrder_
+//
+//  Synopsis:   Puts the bytes still in the register back and skips as many
+//              bits of the first one as were already extracted from it
+//----------------------------------------------------------------------------
 
-bool StringBitIter::ExtractBitsLittleEndian_ (uintsys u_NumBits, uintsys& u,
-                                              ParseError& error)
+void StringBitIter::SetByteOrder_ (bool b_LittleEndian)
 {
-    u = 0;
-
-    if (u_NumBits == 0)
+    if (b_LittleEndian == b_LittleEndian_)
     {
-        return true;
+        return;
     }
 
-    uintsys u_BitsNeeded   = u_NumBits + u_BitOffset_;
-    uintsys u_BytesNeeded  = (u_BitsNeeded + 7) / 8;
-    uintsys u_NewBitOffset = u_BitsNeeded % 8;
+    uintsys u_Used = (8 - (u_NumBits_ % 8)) % 8;
 
-    if (iter_.Capacity() < u_BytesNeeded)
-    {
-        error.SetUnexpectedEndOfData();
-
-        return false;
-    }
+    p_Char_ -= (u_NumBits_ + 7) / 8;
 
-    StringIter temp (iter_);
+    u_Bits_         = 0;
+    u_NumBits_      = 0;
+    b_LittleEndian_ = b_LittleEndian;
 
-    if (!ExtractBytes (temp, u_BytesNeeded, u, error))
+    if (u_Used > 0)
     {
-        return false;
-    }
-
-    u = SwapEndianness (u_BytesNeeded, u);
-
-    u = (u >> u_BitOffset_) & MakeLowBitMask (u_NumBits);
+        uintsys    u_Skipped = 0;
+        ParseError error;
 
-    u_BitOffset_ = u_NewBitOffset;
-
-    if (u_NewBitOffset == 0)
-    {
-        iter_.Swap (temp);
+        ExtractBits (u_Used, u_Skipped, error);
     }
-    else
-    {
-        iter_ += (u_BytesNeeded - 1);
-    }
-
-    return true;
 }
 
 SubString& SubString::operator= (const String& str_Replace)
@@ -922,58 +894,17 @@ SubString& SubString::operator= (const String& str_Replace)
 template<typename INT>
 static void SignedNumberToString (INT n, String& str)
 {
-    if (n == 0)
-    {
-        str.Append ('0');
-
-        return;
-    }
-
-    str.Reserve (16);
-
-    bool b_IsNegative = (n < 0);
+    char ac[24];
 
-    n = AbsoluteValue (n);
-
-    while (n != 0)
-    {
-        char c = (n % 10) + '0';
-
-        n /= 10;
-
-        str.Append (c);
-    }
-
-    if (b_IsNegative)
-    {
-        str.Append ('-');
-    }
-
-    str.Reverse();
+    str.Append (ac, Number::FormatInt (n, ac));
 }
 
 template<typename UINT>
 static void NumberToString (UINT u, String& str)
 {
-    if (u == 0)
-    {
-        str.Append ('0');
+    char ac[24];
 
-        return;
-    }
-
-    str.Reserve (16);
-
-    while (u != 0)
-    {
-        char c = (u % 10) + '0';
-
-        u /= 10;
-
-        str.Append (c);
-    }
-
-    str.Reverse();
+    str.Append (ac, Number::FormatUint (u, ac));
 }
 
 String::String (int64 n)
@@ -1031,58 +962,87 @@ String::String (const void* pv)
     operator= (ac);
 }
 
-static inline bool IsInvalidBase64Char (uchar uc)
+//+---------------------------------------------------------------------------
+//  Method:     AsLowerCase, AsUpperCase
+//
+//  Synopsis:   Return a copy with the ASCII letters in one case
+//----------------------------------------------------------------------------
+
+const String String::AsLowerCase () const
 {
-    return (uc >= 64);
+    String str_Result;
+
+    uintsys u_Length = Length();
+
+    if (u_Length != 0)
+    {
+        AsciiCase::ToLower (PointerToFirstByte(), u_Length,
+                            str_Result.Allocate (u_Length));
+    }
+
+    return str_Result;
 }
 
-const String String::Base64Decode () const
+const String String::AsUpperCase () const
 {
     String str_Result;
 
     uintsys u_Length = Length();
-    uintsys u_Max    = ((u_Length + 3) / 4) * 3;
 
-    str_Result.Reserve (u_Max);
+    if (u_Length != 0)
+    {
+        AsciiCase::ToUpper (PointerToFirstByte(), u_Length,
+                            str_Result.Allocate (u_Length));
+    }
 
-    StringIter iter (*this);
+    return str_Result;
+}
 
-    uintsys u_Current =  0;
-    uintsys u_Shift   = 18;
+const String String::Base64Decode () const
+{
+    String str_Result;
 
-    while (iter)
+    uintsys u_Length = Length();
+    uintsys u_Max    = Base64::DecodedLength (u_Length);
+
+    if (u_Length != 0)
     {
-        uchar uc = auc_Base64Decode[*iter++];
+        uchar* p_Result = str_Result.Allocate (u_Max);
 
-        if (IsInvalidBase64Char (uc))
-        {
-            continue;
-        }
+        str_Result.Truncate (Base64::Decode (PointerToFirstByte(), u_Length,
+                                             p_Result));
+    }
 
-        if (u_Shift == 0)
-        {
-            u_Current |= uc;
+    return str_Result;
+}
 
-            str_Result.AppendUint24 (u_Current);
+//+---------------------------------------------------------------------------
+//  Method:     Base64Decode
+//
+//  Synopsis:   Strict decoding, which allows nothing but the alphabet, CR
+//              and LF, and requires the padding
+//
+//  Notes:      Returns an empty string if the error is set
+//----------------------------------------------------------------------------
 
-            u_Current =  0;
-            u_Shift   = 18;
-        }
-        else
-        {
-            u_Current |= (uc << u_Shift);
+const String String::Base64Decode (ParseError& error) const
+{
+    String str_Result;
 
-            u_Shift -= 6;
-        }
-    }
+    uintsys u_Length = Length();
+    uintsys u_Max    = Base64::DecodedLength (u_Length);
 
-    if (u_Shift == 6)
+    if (u_Length != 0)
     {
-        str_Result.AppendUint8 (u_Current >> 16);
+        uchar* p_Result = str_Result.Allocate (u_Max);
+
+        str_Result.Truncate (Base64::Decode (PointerToFirstByte(), u_Length,
+                                             p_Result, error));
     }
-    else if (u_Shift == 0)
+
+    if (!error)
     {
-        str_Result.AppendUint16 (u_Current >> 8);
+        str_Result.Clear();
     }
 
     return str_Result;
@@ -1097,56 +1057,13 @@ static uintsys Base64ResultSize (uintsys u_BytesToEncode,
     u_OutputLineLength  = (u_OutputLineLength == 0) ? 76 : u_OutputLineLength;
 
     uintsys u_LengthEOL  = std::strlen (pz_EOL);
-    uintsys u_FullGroups = u_BytesToEncode / 3;
-    uintsys u_ExtraBytes = u_BytesToEncode - 3 * u_FullGroups;
-    uintsys u_EncodeSize = u_FullGroups * 4 + (u_ExtraBytes ? 4 : 0);
+    uintsys u_EncodeSize = Base64::EncodedLength (u_BytesToEncode);
     uintsys u_NumLines   = u_EncodeSize / u_OutputLineLength +
                          ((u_EncodeSize % u_OutputLineLength) ? 1 : 0);
 
     return u_EncodeSize + u_NumLines * u_LengthEOL;
 }
 
-static inline char GetBase64Char (uintsys u)
-{
-    return gpz_Base64[u & 0x3F];
-}
-
-static inline void AppendBase64Group24 (uintsys u_Group, String& str)
-{
-    uchar auc[4];
-
-    auc[0] = GetBase64Char (u_Group >> 18);
-    auc[1] = GetBase64Char (u_Group >> 12);
-    auc[2] = GetBase64Char (u_Group >>  6);
-    auc[3] = GetBase64Char (u_Group      );
-
-    str.Append ((const uchar*)auc, 4);
-}
-
-static inline void AppendBase64Group16 (uintsys u_Group, String& str)
-{
-    uchar auc[4];
-
-    auc[0] = GetBase64Char (u_Group >> 10);
-    auc[1] = GetBase64Char (u_Group >>  4);
-    auc[2] = GetBase64Char (u_Group <<  2);
-    auc[3] = '=';
-
-    str.Append ((const uchar*)auc, 4);
-}
-
-static inline void AppendBase64Group8 (uintsys u_Group, String& str)
-{
-    uchar auc[4];
-
-    auc[0] = GetBase64Char (u_Group >> 2);
-    auc[1] = GetBase64Char (u_Group << 4);
-    auc[2] = '=';
-    auc[3] = '=';
-
-    str.Append ((const uchar*)auc, 4);
-}
-
 const String String::Base64Encode (uintsys u_LineLength,
                                    const char* pz_EOL) const
 {
@@ -1155,46 +1072,32 @@ const String String::Base64Encode (uintsys u_LineLength,
         return String(pz_EOL);
     }
 
-    uintsys u_Size  = Base64ResultSize (Length(), u_LineLength, pz_EOL);
-    uintsys u_Group = 0;
-    uintsys u_Count = 0;
-
-    String str_Result ((Preallocate (u_Size)));
+    uintsys u_Size = Base64ResultSize (Length(), u_LineLength, pz_EOL);
 
-    StringIter iter (*this);
-
-    ParseError error;
+    String str_Result;
 
-    while (iter.ExtractUint24BE (u_Group, error))
-    {
-        AppendBase64Group24 (u_Group, str_Result);
+    // each full line is encoded straight into the result, followed by
+    // the EOL
 
-        u_Count += 4;
+    uintsys u_LengthEOL   = std::strlen (pz_EOL);
+    uintsys u_BytesToLine = (u_LineLength / 4) * 3;
+    uintsys u_Remaining   = Length();
 
-        if (u_Count >= u_LineLength)
-        {
-            str_Result.Append (pz_EOL);
+    const uchar* p = PointerToFirstByte();
+    uchar*       q = str_Result.Allocate (u_Size);
 
-            u_Count = 0;
-        }
-    }
-
-    if (iter.ExtractUint16BE (u_Group, error))
+    while (u_Remaining != 0)
     {
-        AppendBase64Group16 (u_Group, str_Result);
+        uintsys u_Bytes = Minimum (u_Remaining, u_BytesToLine);
 
-        u_Count += 4;
-    }
-    else if (iter.ExtractUint8 (u_Group, error))
-    {
-        AppendBase64Group8 (u_Group, str_Result);
+        q += Base64::Encode (p, u_Bytes, q);
 
-        u_Count += 4;
-    }
+        std::memcpy (q, pz_EOL, u_LengthEOL);
 
-    if (u_Count != 0)
-    {
-        str_Result.Append (pz_EOL);
+        q += u_LengthEOL;
+        p += u_Bytes;
+
+        u_Remaining -= u_Bytes;
     }
 
     return str_Result;
@@ -1341,21 +1244,13 @@ StringIter String::FindFirst (const String& str, const Index& offset,
         b_Case = false;
     }
 
-    uintsys u_NumTries = Length() - u_SearchLength - u_Offset + 1;
+    const uchar* p_Start = PointerToFirstByte();
+    const uchar* p_Found = ByteSearch::Find (p_Start + u_Offset,
+                                             Length() - u_Offset,
+                                             str.PointerToFirstByte(),
+                                             u_SearchLength, b_Case);
 
-    const uchar* p_SearchString = str.PointerToFirstByte();
-    const uchar* p_NextSearch   = PointerToFirstByte() + u_Offset;
-
-    for (uintsys u=0; u<u_NumTries; ++u)
-    {
-        if (StringCompare (p_NextSearch++, p_SearchString, u_SearchLength,
-                           b_Case) == 0)
-        {
-            return StringIter (*this, u_Offset + u);
-        }
-    }
-
-    return StringIter();
+    return p_Found ? StringIter (*this, p_Found - p_Start) : StringIter();
 }
 
 StringIter String::FindFirst (char c, const Index& offset, bool b_Case) const
@@ -1369,17 +1264,14 @@ StringIter String::FindFirst (char c, const Index& offset, bool b_Case) const
 
     if (offset.Calculate (Length(), u_Offset))
     {
-        const uchar* p_NextSearch = mem_.PointerToFirstByte() + u_Offset;
-
-        uintsys u_Length = Length();
-
-        for (uintsys u=u_Offset; u<u_Length; ++u)
+        const uchar* p_Start = mem_.PointerToFirstByte();
+        const uchar* p_Found = ByteSearch::Find (p_Start + u_Offset,
+                                                 Length() - u_Offset,
+                                                 (const uchar*) &c, 1,
+                                                 b_Case);
+        if (p_Found)
         {
-            if (mikestoolbox::ByteCompare (*p_NextSearch++,
-                                           (uchar)c, b_Case) == 0)
-            {
-                return StringIter (*this, u);
-            }
+            return StringIter (*this, p_Found - p_Start);
         }
     }
 
@@ -1413,27 +1305,21 @@ StringIter String::FindLast (const String& str, const Index& offset,
         b_Case = false;
     }
 
-    uintsys u_NumTries = u_Offset + 1;
+    // a match may start at any offset up to and including u_Offset
 
-    if (u_NumTries > Length() - u_SearchLength + 1)
-    {
-        u_NumTries = Length() - u_SearchLength + 1;
-        u_Offset   = u_NumTries - 1;
-    }
+    uintsys u_SearchEnd = u_Offset + u_SearchLength;
 
-    const uchar* p_SearchString = str.PointerToFirstByte();
-    const uchar* p_NextSearch   = PointerToFirstByte() + u_Offset;
-
-    for (uintsys u=0; u<u_NumTries; ++u)
+    if (u_SearchEnd > Length())
     {
-        if (StringCompare (p_NextSearch--, p_SearchString, u_SearchLength,
-                           b_Case) == 0)
-        {
-            return StringIter (*this, u_Offset - u);
-        }
+        u_SearchEnd = Length();
     }
 
-    return StringIter();
+    const uchar* p_Start = PointerToFirstByte();
+    const uchar* p_Found = ByteSearch::FindLast (p_Start, u_SearchEnd,
+                                                 str.PointerToFirstByte(),
+                                                 u_SearchLength, b_Case);
+
+    return p_Found ? StringIter (*this, p_Found - p_Start) : StringIter();
 }
 
 StringIter String::FindLast (char c, const Index& offset, bool b_Case) const
@@ -1447,15 +1333,13 @@ StringIter String::FindLast (char c, const Index& offset, bool b_Case) const
 
     if (offset.Calculate (Length(), u_Offset))
     {
-        const uchar* p_NextSearch = mem_.PointerToFirstByte() + u_Offset;
-
-        for (uintsys u=0; u<=u_Offset; ++u)
+        const uchar* p_Start = mem_.PointerToFirstByte();
+        const uchar* p_Found = ByteSearch::FindLast (p_Start, u_Offset + 1,
+                                                     (const uchar*) &c, 1,
+                                                     b_Case);
+        if (p_Found)
         {
-            if (mikestoolbox::ByteCompare (*p_NextSearch--, (uchar)c,
-                                           b_Case) == 0)
-            {
-                return StringIter (*this, u_Offset - u);
-            }
+            return StringIter (*this, p_Found - p_Start);
         }
     }
 
@@ -1571,42 +1455,12 @@ void String::IncrementBinary ()
 
 const StringList String::LineBreak () const
 {
-    StringList strl;
-
-    if (IsEmpty())
-    {
-        return strl;
-    }
-
-    StringIter iter1 (*this);
-    StringIter iter2 (iter1);
-
-    while (iter1)
-    {
-        uchar uc (*iter1++);
-
-        if (uc == '\n')
-        {
-            const uchar* p_Start = iter2.Pointer();
-            const uchar* p_End   = iter1.Pointer();
-
-            uintsys u_Length = p_End - p_Start;
-
-            String str_Line (p_Start, u_Length);
-
-            strl.Append (str_Line);
-
-            iter2 = iter1;
-        }
-    }
+    StringList     strl;
+    StringLineIter iter (*this);
 
-    if (iter2)
+    for (; iter; ++iter)
     {
-        String str_Line;
-
-        iter2.Extract (str_Line);
-
-        strl.Append (str_Line);
+        strl.Append (String (*iter));
     }
 
     return strl;
@@ -1704,6 +1558,41 @@ String& String::Reverse ()
     return *this;
 }
 
+//+---------------------------------------------------------------------------
+//  Method:     ToLowerCase, ToUpperCase
+//
+//  Synopsis:   Change the case of the ASCII letters without making a copy,
+//              unless the memory is shared with another String
+//----------------------------------------------------------------------------
+
+String& String::ToLowerCase ()
+{
+    uintsys u_Length = Length();
+
+    if (u_Length != 0)
+    {
+        uchar* p = mem_.EditInPlace();
+
+        AsciiCase::ToLower (p, u_Length, p);
+    }
+
+    return *this;
+}
+
+String& String::ToUpperCase ()
+{
+    uintsys u_Length = Length();
+
+    if (u_Length != 0)
+    {
+        uchar* p = mem_.EditInPlace();
+
+        AsciiCase::ToUpper (p, u_Length, p);
+    }
+
+    return *this;
+}
+
 static void AppendSanitary (uchar uc, String& str)
 {
     if ((uc < 0x20) || (uc >= 0x7F))
@@ -1800,66 +1689,19 @@ const String String::Segment (const Index& offset, uintsys u_NumBytes) const
     return str;
 }
 
-static const uchar ESCAPE_CHAR  = '\\';
-static const uchar SINGLE_QUOTE = '\'';
-static const uchar DOUBLE_QUOTE = '"';
-
 const StringList String::ShellParse (ParseError& error) const
 {
-    StringList strl;
-    String     str_Element;
-
-    bool  b_Escaped = false;
-    bool  b_InQuote = false;
-    uchar uc_Quote  = DOUBLE_QUOTE;
+    StringList     strl;
+    String         str_Word;
+    ParseError     error_Words;
+    ShellParseIter iter (*this);
 
-    StringIter iter (*this);
-
-    while (iter)
+    while (iter.Next (str_Word, error_Words))
     {
-        uchar uc = *iter++;
-
-        if (b_Escaped)
-        {
-            b_Escaped = false;
-
-            str_Element += uc;
-        }
-        else if (uc == ESCAPE_CHAR)
-        {
-            b_Escaped = true;
-        }
-        else if (b_InQuote)
-        {
-            if (uc == uc_Quote)
-            {
-                b_InQuote = false;
-            }
-            else
-            {
-                str_Element += uc;
-            }
-        }
-        else if (std::isspace (uc))
-        {
-            strl.AppendNonEmpty (str_Element);
-
-            str_Element.Clear();
-        }
-        else if ((uc == SINGLE_QUOTE) || (uc == DOUBLE_QUOTE))
-        {
-            b_InQuote = true;
-            uc_Quote  = uc;
-        }
-        else
-        {
-            str_Element += uc;
-        }
+        strl.Append (str_Word);
     }
 
-    strl.AppendNonEmpty (str_Element);
-
-    if (b_InQuote || b_Escaped)
+    if (!error_Words)
     {
         strl.Clear();
 
@@ -1893,34 +1735,16 @@ const StringList String::Split (const String& str_Pattern,
         return strl;
     }
 
-    if (u_MaxStrings == 0)
+    if (b_IgnoreCase_ || !str_Pattern.IsCaseSensitive())
     {
-        u_MaxStrings = ~u_MaxStrings;
+        b_Case = false;
     }
 
-    intsys  n_Offset        =  0;
-    intsys  n_MatchLocation = -1;
-    uintsys u_PatternLength = str_Pattern.Length();
-
-    while (strl.NumItems() < u_MaxStrings - 1)
-    {
-        StringIter iter = FindFirst (str_Pattern, n_Offset, b_Case);
-
-        if (!iter)
-        {
-            break;
-        }
-
-        n_MatchLocation = iter.Offset();
+    StringSplitIter iter (*this, str_Pattern, u_MaxStrings, b_Case);
 
-        strl.Append (Segment (n_Offset, n_MatchLocation - n_Offset));
-
-        n_Offset = n_MatchLocation + u_PatternLength;
-    }
-
-    if (n_Offset <= (intsys)u_Length)
+    for (; iter; ++iter)
     {
-        strl.Append (Segment (n_Offset, u_Length - n_Offset));
+        strl.Append (String (*iter));
     }
 
     return strl;
@@ -1933,32 +1757,13 @@ const StringList String::Split (uintsys u_MaxStrings) const
         return StringList (*this);
     }
 
-    if (u_MaxStrings == 0)
-    {
-        u_MaxStrings = ~u_MaxStrings;
-    }
-
     StringList strl;
 
-    uintsys u_Length = Length();
-    uintsys u_Limit  = Minimum (u_MaxStrings - 1, u_Length);
-
-    StringIter iter (*this);
-
-    for (uintsys u=0; (iter && (u<u_Limit)); ++u)
-    {
-        String str (*iter++);
-
-        strl.Append (str);
-    }
+    StringSplitIter iter (*this, "", u_MaxStrings);
 
-    if (iter)
+    for (; iter; ++iter)
     {
-        String str_Segment;
-
-        iter.Extract (str_Segment);
-
-        strl.Append (str_Segment);
+        strl.Append (String (*iter));
     }
 
     return strl;
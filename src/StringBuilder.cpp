@@ -0,0 +1,257 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       StringBuilder.cpp
+//
+//  Synopsis:   Implementation of StringBuilder methods
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+namespace mikestoolbox {
+
+//+---------------------------------------------------------------------------
+//  Method:     SmallTail_
+//
+//  Synopsis:   Returns the last piece if a fragment of the given length
+//              should be copied onto it rather than kept as its own piece
+//----------------------------------------------------------------------------
+
+String* StringBuilder::SmallTail_ (uintsys u_NumChars)
+{
+    if ((u_NumChars >= STRING_BUILDER_SMALL_PIECE) || !b_OwnTail_)
+    {
+        return 0;
+    }
+
+    String& str_Tail (strl_Pieces_[-1]);
+
+    if (str_Tail.Length() + u_NumChars > STRING_BUILDER_CHUNK)
+    {
+        return 0;
+    }
+
+    return &str_Tail;
+}
+
+StringBuilder& StringBuilder::Append (const StringBuilder& sb)
+{
+    if (&sb == this)
+    {
+        StringList strl_Copy (strl_Pieces_);
+
+        strl_Pieces_.Append (strl_Copy);
+    }
+    else
+    {
+        strl_Pieces_.Append (sb.strl_Pieces_);
+    }
+
+    if (!sb.strl_Pieces_.IsEmpty())
+    {
+        b_OwnTail_ = false;     // the other builder may still write to it
+    }
+
+    u_Length_ += sb.u_Length_;
+
+    return *this;
+}
+
+StringBuilder& StringBuilder::Append (const String& str)
+{
+    uintsys u_NumChars = str.Length();
+
+    if (String* p_Tail = SmallTail_ (u_NumChars))
+    {
+        p_Tail->Append (str);
+    }
+    else if (u_NumChars != 0)
+    {
+        strl_Pieces_.Append (str);
+
+        b_OwnTail_ = (u_NumChars < STRING_BUILDER_SMALL_PIECE);
+    }
+
+    u_Length_ += u_NumChars;
+
+    return *this;
+}
+
+StringBuilder& StringBuilder::Append (const char* pz)
+{
+    uintsys u_NumChars = (pz == 0) ? 0 : std::strlen (pz);
+
+    if (String* p_Tail = SmallTail_ (u_NumChars))
+    {
+        p_Tail->Append (pz, u_NumChars);
+    }
+    else if (u_NumChars != 0)
+    {
+        strl_Pieces_.Append (String (pz, u_NumChars));
+
+        b_OwnTail_ = (u_NumChars < STRING_BUILDER_SMALL_PIECE);
+    }
+
+    u_Length_ += u_NumChars;
+
+    return *this;
+}
+
+StringBuilder& StringBuilder::Prepend (const String& str)
+{
+    if (!str.IsEmpty())
+    {
+        strl_Pieces_.Prepend (str);
+
+        u_Length_ += str.Length();
+    }
+
+    return *this;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Insert
+//
+//  Synopsis:   Inserts a String at the given character offset
+//
+//  Notes:      Only the piece containing the offset is copied, and only
+//              when the offset falls in the middle of it
+//----------------------------------------------------------------------------
+
+StringBuilder& StringBuilder::Insert (uintsys u_Offset, const String& str)
+{
+    if (u_Offset > u_Length_)
+    {
+        throw Exception ("StringBuilder::Insert: Offset out of range");
+    }
+
+    if (u_Offset == u_Length_)
+    {
+        return Append (str);
+    }
+
+    if (str.IsEmpty())
+    {
+        return *this;
+    }
+
+    StringListIter iter (strl_Pieces_);
+
+    uintsys u_Index = 0;
+
+    while (u_Offset >= iter->Length())
+    {
+        u_Offset -= iter->Length();
+
+        ++u_Index;
+        ++iter;
+    }
+
+    if (u_Offset == 0)
+    {
+        strl_Pieces_.Insert (u_Index, str);
+    }
+    else
+    {
+        const String str_Piece (*iter);
+
+        strl_Pieces_[u_Index] = str_Piece.Head (u_Offset);
+
+        strl_Pieces_.Insert (u_Index + 1, str);
+        strl_Pieces_.Insert (u_Index + 2,
+                             str_Piece.Tail (str_Piece.Length() - u_Offset));
+    }
+
+    u_Length_ += str.Length();
+
+    return *this;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     ToString
+//
+//  Synopsis:   Copies the pieces into one contiguous String
+//
+//  Notes:      A single piece is returned as is, sharing its memory
+//----------------------------------------------------------------------------
+
+const String StringBuilder::ToString () const
+{
+    if (strl_Pieces_.NumItems() == 1)
+    {
+        return strl_Pieces_[0];
+    }
+
+    String str_Result;
+
+    str_Result.Reserve (u_Length_);
+
+    StringListIter iter (strl_Pieces_);
+
+    while (iter)
+    {
+        str_Result.Append (*iter);
+
+        ++iter;
+    }
+
+    return str_Result;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Flatten
+//
+//  Synopsis:   Replaces the pieces with one contiguous String and returns it
+//----------------------------------------------------------------------------
+
+const String StringBuilder::Flatten ()
+{
+    if (strl_Pieces_.NumItems() > 1)
+    {
+        strl_Pieces_ = StringList (ToString());
+
+        b_OwnTail_ = false;
+    }
+
+    return strl_Pieces_.IsEmpty() ? String() : strl_Pieces_[0];
+}
+
+} // namespace mikestoolbox
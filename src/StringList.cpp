@@ -164,6 +164,27 @@ const StringList StringList::Grep (const PerlRegex& rex_Pattern) const
     return strl_Return;
 }
 
+const StringList StringList::Grep (const MultiPattern& patterns) const
+{
+    StringList strl_Return;
+
+    StringListIter iter (*this);
+
+    while (iter)
+    {
+        const String& str (*iter);
+
+        ++iter;
+
+        if (patterns.Contains (str))
+        {
+            strl_Return.Append (str);
+        }
+    }
+
+    return strl_Return;
+}
+
 StringListByteIter::StringListByteIter (const StringList& strl)
     : iter_Strings_ (strl)
     , iter_Bytes_   (0, 0)
@@ -0,0 +1,289 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+//+---------------------------------------------------------------------------
+//  File:       StringSplitIter.cpp
+//
+//  Synopsis:   Implementation of the split and shell iterators
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+namespace mikestoolbox {
+
+//+---------------------------------------------------------------------------
+//  Method:     Start_
+//
+//  Synopsis:   Finds the first piece
+//
+//  Notes:      Empty text has no pieces, except that String::Split gives
+//              back the empty String itself for an empty pattern and a
+//              limit of one piece, and so does this
+//----------------------------------------------------------------------------
+
+void StringSplitIter::Start_ (uintsys u_MaxStrings)
+{
+    bool b_EmptyPattern = !b_SplitChar_ && (p_Regex_ == 0)
+                                        && view_Pattern_.IsEmpty();
+
+    if (view_.IsEmpty() && !(b_EmptyPattern && (u_MaxStrings == 1)))
+    {
+        b_Last_ = true;
+
+        return;
+    }
+
+    u_Remaining_ = (u_MaxStrings == 0) ? ~u_MaxStrings : u_MaxStrings;
+
+    Advance_();
+}
+
+void StringSplitIter::Advance_ ()
+{
+    b_Valid_ = !b_Last_;
+
+    if (!b_Valid_)
+    {
+        return;
+    }
+
+    uintsys u_Found = 0;
+    uintsys u_Skip  = 0;
+
+    if ((--u_Remaining_ == 0) || !Find_ (u_Found, u_Skip))
+    {
+        u_Found = view_.Length();
+        b_Last_ = true;
+    }
+
+    view_Piece_ = StringView (view_, u_Offset_, u_Found - u_Offset_);
+    u_Offset_   = u_Found + u_Skip;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Find_
+//
+//  Synopsis:   Finds the separator that ends the piece starting at
+//              u_Offset_, giving its offset and length
+//----------------------------------------------------------------------------
+
+bool StringSplitIter::Find_ (uintsys& u_Found, uintsys& u_Skip) const
+{
+    if (p_Regex_ != 0)
+    {
+        return FindRegex_ (u_Found, u_Skip);
+    }
+
+    const uchar* p_Start  = view_.PointerToFirstByte();
+    uintsys      u_Length = view_.Length();
+
+    const uchar* p_Pattern       = view_Pattern_.PointerToFirstByte();
+    uintsys      u_PatternLength = view_Pattern_.Length();
+
+    if (b_SplitChar_)
+    {
+        p_Pattern       = &uc_SplitChar_;
+        u_PatternLength = 1;
+    }
+    else if (u_PatternLength == 0)
+    {
+        u_Found = u_Offset_ + 1;    // between characters
+        u_Skip  = 0;
+
+        return (u_Found < u_Length);
+    }
+
+    const uchar* p_Found = ByteSearch::Find (p_Start + u_Offset_,
+                                             u_Length - u_Offset_,
+                                             p_Pattern, u_PatternLength,
+                                             b_Case_);
+    if (p_Found == 0)
+    {
+        return false;
+    }
+
+    u_Found = p_Found - p_Start;
+    u_Skip  = u_PatternLength;
+
+    return true;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     FindRegex_
+//
+//  Synopsis:   Finds the next match of the regex that can end a piece
+//
+//  Notes:      The search runs over the whole text from the start of the
+//              piece, so lookbehind sees what came before it.  An empty
+//              match where the piece starts, or at the end of the text,
+//              doesn't count.
+//----------------------------------------------------------------------------
+
+bool StringSplitIter::FindRegex_ (uintsys& u_Found, uintsys& u_Skip) const
+{
+    const uchar* p_Start  = view_.PointerToFirstByte();
+    uintsys      u_Length = view_.Length();
+    uintsys      u_Search = u_Offset_;
+
+    PerlRegexOptions options;
+    PerlRegexMatches matches;
+
+    while (u_Search < u_Length)
+    {
+        options.StartingOffset (u_Search);
+
+        intsys n_Match = p_Regex_->Match (p_Start, u_Length, options,
+                                          matches);
+        if (n_Match < 0)
+        {
+            return false;
+        }
+
+        u_Found = n_Match;
+        u_Skip  = matches.GetMatchLength (0);
+
+        if (u_Skip != 0)
+        {
+            return true;
+        }
+
+        if (u_Found == u_Length)
+        {
+            return false;
+        }
+
+        if (u_Found != u_Offset_)
+        {
+            return true;
+        }
+
+        u_Search = u_Found + 1;
+    }
+
+    return false;
+}
+
+static const uchar ESCAPE_CHAR  = '\\';
+static const uchar SINGLE_QUOTE = '\'';
+static const uchar DOUBLE_QUOTE = '"';
+
+static inline bool IsShellSpecial (uchar uc, bool b_InQuote, uchar uc_Quote)
+{
+    if (b_InQuote)
+    {
+        return (uc == uc_Quote) || (uc == ESCAPE_CHAR);
+    }
+
+    return (uc == ESCAPE_CHAR) || (uc == SINGLE_QUOTE) ||
+           (uc == DOUBLE_QUOTE) || std::isspace (uc);
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Next
+//
+//  Synopsis:   Gets the next word, as ShellParse would
+//
+//  Notes:      A backslash escapes the next character, in quotes or not.
+//              Runs of characters that stand for themselves are appended
+//              in one go rather than a byte at a time.
+//----------------------------------------------------------------------------
+
+bool ShellParseIter::Next (String& str_Word, ParseError& error)
+{
+    str_Word.Truncate (0);
+
+    bool  b_InQuote = false;
+    uchar uc_Quote  = DOUBLE_QUOTE;
+
+    while (p_Char_ != p_End_)
+    {
+        const uchar* p_Run = p_Char_;
+
+        while ((p_Char_ != p_End_) &&
+               !IsShellSpecial (*p_Char_, b_InQuote, uc_Quote))
+        {
+            ++p_Char_;
+        }
+
+        str_Word.Append (p_Run, p_Char_ - p_Run);
+
+        if (p_Char_ == p_End_)
+        {
+            break;
+        }
+
+        uchar uc = *p_Char_++;
+
+        if (uc == ESCAPE_CHAR)
+        {
+            if (p_Char_ == p_End_)
+            {
+                error.SetUnexpectedEndOfData();
+
+                return false;
+            }
+
+            str_Word.Append (*p_Char_++);
+        }
+        else if (b_InQuote)
+        {
+            b_InQuote = false;      // the closing quote
+        }
+        else if ((uc == SINGLE_QUOTE) || (uc == DOUBLE_QUOTE))
+        {
+            b_InQuote = true;
+            uc_Quote  = uc;
+        }
+        else if (!str_Word.IsEmpty())
+        {
+            return true;            // white space ends the word
+        }
+    }
+
+    if (b_InQuote)
+    {
+        error.SetUnexpectedEndOfData();
+
+        return false;
+    }
+
+    return !str_Word.IsEmpty();
+}
+
+} // namespace mikestoolbox
@@ -0,0 +1,183 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+//+---------------------------------------------------------------------------
+//  File:       StringView.cpp
+//
+//  Synopsis:   Implementation of StringView methods
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+namespace mikestoolbox {
+
+intsys StringView::Compare (const StringView& view, bool b_Case) const
+{
+    uintsys u_CharsToCompare = Minimum (u_Length_, view.u_Length_);
+
+    if (u_CharsToCompare != 0)
+    {
+        intsys n_Compare = StringCompare (p_Start_, view.p_Start_,
+                                          u_CharsToCompare, b_Case);
+        if (n_Compare != 0)
+        {
+            return ((n_Compare > 0) ? 1 : -1);
+        }
+    }
+
+    return ((u_Length_ == view.u_Length_) ? 0 :
+           ((u_Length_ >  view.u_Length_) ? 1 : -1));
+}
+
+intsys StringView::FindFirst (const StringView& view, const Index& offset,
+                              bool b_Case) const
+{
+    uintsys u_Offset = 0;
+
+    if (!offset.Calculate (u_Length_, u_Offset))
+    {
+        return -1;
+    }
+
+    uintsys u_SearchLength = view.u_Length_;
+
+    if (u_SearchLength == 0)
+    {
+        return (intsys) u_Offset;
+    }
+
+    if (u_Offset + u_SearchLength > u_Length_)
+    {
+        return -1;
+    }
+
+    const uchar* p_Found = ByteSearch::Find (p_Start_ + u_Offset,
+                                             u_Length_ - u_Offset,
+                                             view.p_Start_, u_SearchLength,
+                                             b_Case);
+
+    return p_Found ? (p_Found - p_Start_) : -1;
+}
+
+intsys StringView::FindFirst (char c, const Index& offset, bool b_Case) const
+{
+    return FindFirst (StringView (&c, 1), offset, b_Case);
+}
+
+intsys StringView::FindLast (const StringView& view, const Index& offset,
+                             bool b_Case) const
+{
+    uintsys u_Offset = 0;
+
+    if (!offset.Calculate (u_Length_, u_Offset))
+    {
+        return -1;
+    }
+
+    uintsys u_SearchLength = view.u_Length_;
+
+    if (u_SearchLength == 0)
+    {
+        return (intsys) u_Offset;
+    }
+
+    if (u_SearchLength > u_Length_)
+    {
+        return -1;
+    }
+
+    // a match may start at any offset up to and including u_Offset
+
+    uintsys u_SearchEnd = Minimum (u_Offset + u_SearchLength, u_Length_);
+
+    const uchar* p_Found = ByteSearch::FindLast (p_Start_, u_SearchEnd,
+                                                 view.p_Start_,
+                                                 u_SearchLength, b_Case);
+
+    return p_Found ? (p_Found - p_Start_) : -1;
+}
+
+intsys StringView::FindLast (char c, const Index& offset, bool b_Case) const
+{
+    return FindLast (StringView (&c, 1), offset, b_Case);
+}
+
+const StringView StringView::Segment (const Index& offset,
+                                      uintsys u_NumBytes) const
+{
+    uintsys u_Offset = 0;
+
+    if (!offset.Calculate (u_Length_, u_Offset))
+    {
+        return StringView();
+    }
+
+    uintsys u_End = u_Offset + u_NumBytes;
+
+    if ((u_End < u_Offset) || (u_End > u_Length_))
+    {
+        u_NumBytes = u_Length_ - u_Offset;
+    }
+
+    return StringView (*this, u_Offset, u_NumBytes);
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Split
+//
+//  Synopsis:   Splits the view where the pattern occurs, the same way
+//              String::Split does, without copying any bytes
+//----------------------------------------------------------------------------
+
+const StringViewList StringView::Split (const StringView& view_Pattern,
+                                        uintsys u_MaxStrings,
+                                        bool b_Case) const
+{
+    StringViewList  list;
+    StringSplitIter iter (*this, view_Pattern, u_MaxStrings, b_Case);
+
+    for (; iter; ++iter)
+    {
+        list.Append (*iter);
+    }
+
+    return list;
+}
+
+} // namespace mikestoolbox
@@ -57,7 +57,7 @@ uintsys getThreadId()
 
 Thread::~Thread ()
 {
-    // nothing
+    delete p_Result_;
 }
 
 void Thread::Suspend ()
@@ -75,6 +75,31 @@ void Thread::SetPriority (intsys n_Priority)
     // nothing
 }
 
+bool Thread::SetPolicy (ThreadPolicy, intsys)
+{
+    return false;
+}
+
+bool Thread::SetAffinity (const List<uintsys>&)
+{
+    return false;
+}
+
+List<uintsys> Thread::Affinity () const
+{
+    return List<uintsys>();
+}
+
+bool Thread::SetNumaNode (uintsys)
+{
+    return false;
+}
+
+void Thread::SetName (const String& str_Name)
+{
+    str_Name_ = str_Name;
+}
+
 uintsys Thread::GetId () const
 {
     return 0;
@@ -117,6 +142,8 @@ void Thread::Run ()
 
     date_Stop_ = Date();
     b_Running_ = false;
+
+    Exited_ (this);
 }
 
 #else
@@ -137,6 +164,48 @@ void Thread::Stop_ ()
     // nothing -- can be overridden
 }
 
+//+---------------------------------------------------------------------------
+//  Method:     Result
+//
+//  Synopsis:   Returns a Future for the exit code of the thread
+//----------------------------------------------------------------------------
+
+Future<intsys> Thread::Result () const
+{
+    return p_Result_->GetFuture();
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Exited_
+//
+//  Synopsis:   Called by the thread as it finishes, to set b_Exited_ and
+//              then satisfy the Futures returned by Result()
+//
+//  Notes:      Everything is copied out of the object first, since its
+//              owner may delete it as soon as b_Exited_ is set.  Setting
+//              b_Exited_ first means that a Future which is ready implies
+//              HasExited(), so the Thread can be deleted after Get().
+//----------------------------------------------------------------------------
+
+void Thread::Exited_ (Thread* p_This)
+{
+    Promise<intsys> promise       (*p_This->p_Result_);
+    bool            b_Exception   (p_This->b_Exception_);
+    intsys          n_ExitCode    (p_This->n_ExitCode_);
+    String          str_Exception (p_This->str_Exception_);
+
+    p_This->b_Exited_.Store (true);    // the owner may delete p_This now
+
+    if (b_Exception)
+    {
+        promise.SetException (str_Exception);
+    }
+    else
+    {
+        promise.SetValue (n_ExitCode);
+    }
+}
+
 intsys SimpleThread::Main_ ()
 {
     switch (type_)
@@ -0,0 +1,612 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       ThreadPool.cpp
+//
+//  Synopsis:   Implementation of ThreadPool class
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+namespace mikestoolbox {
+
+static THREAD_LOCAL ThreadPoolWorker* gp_CurrentWorker = 0;
+
+//+---------------------------------------------------------------------------
+//  Class:      ParallelRange
+//
+//  Synopsis:   Shared state of a ParallelFor.  Each thread taking part
+//              claims the next chunk of the range until none are left.
+//----------------------------------------------------------------------------
+
+class ParallelRange
+{
+public:
+
+    ParallelRange (RangeFunction func, void* p_Arg, uintsys u_Begin,
+                   uintsys u_End, uintsys u_Grain)
+        : func_    (func)
+        , p_Arg_   (p_Arg)
+        , u_End_   (u_End)
+        , u_Grain_ (u_Grain)
+        , u_Next_  (u_Begin)
+    {
+        // nothing
+    }
+
+    void Run ()
+    {
+        for (;;)
+        {
+            uintsys u_Begin = u_Next_.FetchAdd (u_Grain_);
+
+            if (u_Begin >= u_End_)
+            {
+                break;
+            }
+
+            func_ (u_Begin, Minimum (u_Begin + u_Grain_, u_End_), p_Arg_);
+        }
+    }
+
+    void Cancel ()
+    {
+        u_Next_.Store (u_End_);
+    }
+
+private:
+
+    RangeFunction   func_;
+    void*           p_Arg_;
+    uintsys         u_End_;
+    uintsys         u_Grain_;
+    Atomic<uintsys> u_Next_;
+};
+
+class ParallelRangeTask : public Task
+{
+public:
+
+    ParallelRangeTask (ParallelRange& range) : range_ (range) { }
+
+private:
+
+    virtual void Main_ () { range_.Run(); }
+
+    ParallelRange& range_;
+};
+
+//+---------------------------------------------------------------------------
+//  Task
+//----------------------------------------------------------------------------
+
+Task::~Task ()
+{
+    // nothing
+}
+
+void Task::Run_ ()
+{
+    try
+    {
+        Main_();
+    }
+    catch (StringException& e)
+    {
+        b_Exception_   = true;
+        str_Exception_ = e.StringMessage();
+    }
+    catch (Exception& e)
+    {
+        b_Exception_   = true;
+        str_Exception_ = e.Message();
+    }
+    catch (...)
+    {
+        b_Exception_   = true;
+    }
+
+    b_Done_.Store (true);
+}
+
+void FunctionTask::Main_ ()
+{
+    func_ (p_Arg_);
+}
+
+//+---------------------------------------------------------------------------
+//  Executor
+//----------------------------------------------------------------------------
+
+Executor::~Executor ()
+{
+    // nothing
+}
+
+void Executor::RunTask_ (Task* p_Task)
+{
+    p_Task->AddReference_();
+    p_Task->Run_();
+    p_Task->Release_();
+}
+
+InlineExecutor& InlineExecutor::Instance ()
+{
+    static InlineExecutor executor;
+
+    return executor;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Wait
+//
+//  Synopsis:   Waits for the task to finish.  An untimed wait runs other
+//              tasks from the same pool while it waits.
+//----------------------------------------------------------------------------
+
+bool TaskHandle::Wait (uintsys u_TimeoutMilliseconds) const
+{
+    if (p_Task_ == 0)
+    {
+        return true;
+    }
+
+    ThreadPool* p_Pool = p_Task_->p_Pool_;
+    bool        b_Help = (u_TimeoutMilliseconds == WAIT_FOREVER);
+
+    QueueWait wait (u_TimeoutMilliseconds);
+
+    while (!p_Task_->IsDone())
+    {
+        if (b_Help && (p_Pool != 0) && p_Pool->RunOneTask_())
+        {
+            continue;
+        }
+
+        if (!wait.Pause())
+        {
+            return p_Task_->IsDone();
+        }
+    }
+
+    return true;
+}
+
+//+---------------------------------------------------------------------------
+//  ThreadPoolWorker
+//----------------------------------------------------------------------------
+
+ThreadPoolWorker::ThreadPoolWorker (ThreadPool& pool, uintsys u_Index)
+    : pool_       (pool)
+    , u_Index_    (u_Index)
+    , u_Random_   (u_Index * 0x9E3779B97F4A7C15ULL + 1)
+    , deque_      (THREAD_POOL_DEQUE_SIZE)
+    , b_Sleeping_ (false)
+    , cond_Wake_  ()
+{
+    // nothing
+}
+
+intsys ThreadPoolWorker::Main_ ()
+{
+    const uintsys u_SpinLimit = 64;
+
+    gp_CurrentWorker = this;
+
+    uintsys u_Idle = 0;
+
+    for (;;)
+    {
+        Task* p_Task = pool_.FindTask_ (this);
+
+        if (p_Task != 0)
+        {
+            ThreadPool::RunTask_ (p_Task);
+
+            u_Idle = 0;
+        }
+        else if (ShouldStop())
+        {
+            break;
+        }
+        else if (++u_Idle < u_SpinLimit)
+        {
+            YieldThread();
+        }
+        else
+        {
+            Sleep_();
+
+            u_Idle = 0;
+        }
+    }
+
+    gp_CurrentWorker = 0;
+
+    return 0;
+}
+
+void ThreadPoolWorker::Stop_ ()
+{
+    Wake_();
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Sleep_
+//
+//  Synopsis:   Announces that we are going to sleep, then checks for work
+//              once more so that a task submitted in between is not missed
+//----------------------------------------------------------------------------
+
+void ThreadPoolWorker::Sleep_ ()
+{
+    b_Sleeping_.Exchange (true);
+
+    AtomicFence();
+
+    if (pool_.HasWork_() || ShouldStop())
+    {
+        if (b_Sleeping_.Exchange (false))
+        {
+            return;
+        }
+
+        // somebody has already woken us, so consume the signal
+    }
+
+    cond_Wake_.Wait();
+}
+
+bool ThreadPoolWorker::Wake_ ()
+{
+    if (b_Sleeping_.Load() && b_Sleeping_.Exchange (false))
+    {
+        cond_Wake_.Signal();
+
+        return true;
+    }
+
+    return false;
+}
+
+//+---------------------------------------------------------------------------
+//  ThreadPool
+//----------------------------------------------------------------------------
+
+ThreadPool::ThreadPool (uintsys u_NumThreads)
+    : pp_Workers_   (0)
+    , u_NumThreads_ (0)
+    , queue_Tasks_  (THREAD_POOL_QUEUE_SIZE)
+    , b_Stopped_    (false)
+{
+#ifndef SINGLE_THREADED
+    if (u_NumThreads == 0)
+    {
+        u_NumThreads = NumProcessors();
+    }
+
+    pp_Workers_ = new ThreadPoolWorker* [u_NumThreads];
+
+    for (uintsys u = 0; u < u_NumThreads; ++u)
+    {
+        pp_Workers_[u] = new ThreadPoolWorker (*this, u);
+    }
+
+    u_NumThreads_ = u_NumThreads;
+
+    for (uintsys u = 0; u < u_NumThreads_; ++u)
+    {
+        pp_Workers_[u]->Run();
+    }
+#endif
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     ~ThreadPool
+//
+//  Synopsis:   Stops the workers and waits for them to exit.  A worker is
+//              deleted only once its thread no longer touches the object.
+//
+//  Notes:      A worker stopped before its thread got going never calls
+//              Main_, so this waits on HasExited rather than on Main_
+//----------------------------------------------------------------------------
+
+ThreadPool::~ThreadPool ()
+{
+    Stop();
+
+    for (uintsys u = 0; u < u_NumThreads_; ++u)
+    {
+        while (!pp_Workers_[u]->HasExited())
+        {
+            millisleep (1);
+        }
+    }
+
+    while (RunOneTask_())
+    {
+        // run anything submitted while the workers were exiting
+    }
+
+    for (uintsys u = 0; u < u_NumThreads_; ++u)
+    {
+        delete pp_Workers_[u];
+    }
+
+    delete [] pp_Workers_;
+}
+
+void ThreadPool::Execute (Task* p_Task)
+{
+    Submit (p_Task);
+}
+
+void ThreadPool::Stop ()
+{
+    if (b_Stopped_.Exchange (true))
+    {
+        return;
+    }
+
+    for (uintsys u = 0; u < u_NumThreads_; ++u)
+    {
+        pp_Workers_[u]->Stop();
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Submit
+//
+//  Synopsis:   Queues a task and returns a handle for waiting on it.  A
+//              worker submitting a task pushes it onto its own deque;
+//              other threads use the pool's queue.
+//----------------------------------------------------------------------------
+
+TaskHandle ThreadPool::Submit (Task* p_Task)
+{
+    TaskHandle handle (p_Task);
+
+    if (IsStopped())
+    {
+        throw Exception ("ThreadPool::Submit: the pool has been stopped");
+    }
+
+    p_Task->p_Pool_ = this;
+
+    p_Task->AddReference_();    // held by the pool until the task has run
+
+    if (u_NumThreads_ == 0)
+    {
+        RunTask_ (p_Task);
+
+        return handle;
+    }
+
+    ThreadPoolWorker* p_Worker = CurrentWorker_();
+
+    if ((p_Worker == 0) || !p_Worker->deque_.Push (p_Task))
+    {
+        while (!queue_Tasks_.TryPush (p_Task))
+        {
+            if (!RunOneTask_())
+            {
+                YieldThread();
+            }
+        }
+    }
+
+    WakeWorker_();
+
+    return handle;
+}
+
+void ThreadPool::ParallelFor (uintsys u_Begin, uintsys u_End,
+                              RangeFunction func, void* p_Arg,
+                              uintsys u_Grain)
+{
+    if (u_End <= u_Begin)
+    {
+        return;
+    }
+
+    uintsys u_Count = u_End - u_Begin;
+
+    if (u_Grain == 0)
+    {
+        u_Grain = Maximum (u_Count / (8 * (u_NumThreads_ + 1)), (uintsys) 1);
+    }
+
+    uintsys u_Chunks  = (u_Count + u_Grain - 1) / u_Grain;
+    uintsys u_Helpers = Minimum (u_NumThreads_, u_Chunks - 1);
+
+    ParallelRange    range (func, p_Arg, u_Begin, u_End, u_Grain);
+    List<TaskHandle> list_Handles;
+
+    for (uintsys u = 0; u < u_Helpers; ++u)
+    {
+        list_Handles.Append (Submit (new ParallelRangeTask (range)));
+    }
+
+    try
+    {
+        range.Run();
+    }
+    catch (...)
+    {
+        range.Cancel();
+
+        for (uintsys u = 0; u < u_Helpers; ++u)
+        {
+            list_Handles[u].Wait();
+        }
+
+        throw;
+    }
+
+    for (uintsys u = 0; u < u_Helpers; ++u)
+    {
+        list_Handles[u].Wait();
+    }
+
+    for (uintsys u = 0; u < u_Helpers; ++u)
+    {
+        if (list_Handles[u].ExceptionCaught())
+        {
+            throw StringException (list_Handles[u].ExceptionMessage());
+        }
+    }
+}
+
+ThreadPoolWorker* ThreadPool::CurrentWorker_ () const
+{
+    if ((gp_CurrentWorker != 0) && (&gp_CurrentWorker->pool_ == this))
+    {
+        return gp_CurrentWorker;
+    }
+
+    return 0;
+}
+
+void ThreadPool::RunTask_ (Task* p_Task)
+{
+    p_Task->Run_();
+    p_Task->Release_();
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     FindTask_
+//
+//  Synopsis:   Looks for work in the worker's own deque, then the pool's
+//              queue, then steals from the other workers starting at a
+//              random one
+//----------------------------------------------------------------------------
+
+Task* ThreadPool::FindTask_ (ThreadPoolWorker* p_Worker)
+{
+    Task* p_Task = 0;
+
+    if ((p_Worker != 0) && ((p_Task = p_Worker->deque_.Pop()) != 0))
+    {
+        return p_Task;
+    }
+
+    if (queue_Tasks_.TryPop (p_Task))
+    {
+        return p_Task;
+    }
+
+    uintsys u_Start = 0;
+
+    if (p_Worker != 0)
+    {
+        uintsys& u_Random = p_Worker->u_Random_;
+
+        u_Random ^= u_Random << 13;
+        u_Random ^= u_Random >> 7;
+        u_Random ^= u_Random << 17;
+
+        u_Start = u_Random;
+    }
+
+    for (uintsys u = 0; u < u_NumThreads_; ++u)
+    {
+        ThreadPoolWorker* p_Victim = pp_Workers_[(u_Start+u) % u_NumThreads_];
+
+        if (p_Victim == p_Worker)
+        {
+            continue;
+        }
+
+        if ((p_Task = p_Victim->deque_.Steal()) != 0)
+        {
+            return p_Task;
+        }
+    }
+
+    return 0;
+}
+
+bool ThreadPool::RunOneTask_ ()
+{
+    Task* p_Task = FindTask_ (CurrentWorker_());
+
+    if (p_Task == 0)
+    {
+        return false;
+    }
+
+    RunTask_ (p_Task);
+
+    return true;
+}
+
+bool ThreadPool::HasWork_ () const
+{
+    if (!queue_Tasks_.IsEmpty())
+    {
+        return true;
+    }
+
+    for (uintsys u = 0; u < u_NumThreads_; ++u)
+    {
+        if (!pp_Workers_[u]->deque_.IsEmpty())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ThreadPool::WakeWorker_ ()
+{
+    AtomicFence();
+
+    for (uintsys u = 0; u < u_NumThreads_; ++u)
+    {
+        if (pp_Workers_[u]->Wake_())
+        {
+            return;
+        }
+    }
+}
+
+} // namespace mikestoolbox
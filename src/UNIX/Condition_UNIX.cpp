@@ -0,0 +1,155 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       UNIX/Condition_UNIX.cpp
+//
+//  Synopsis:   UNIX implementation of Condition class
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+#ifdef PLATFORM_UNIX
+
+#ifndef SINGLE_THREADED
+
+namespace mikestoolbox {
+
+#ifdef HAVE_FUTEX
+
+//+---------------------------------------------------------------------------
+//  Method:     Block_
+//
+//  Synopsis:   Sleeps until the sequence number changes from u_Sequence or
+//              the time runs out.  Returns false on timeout.  The kernel
+//              checks the sequence number for us, atomically with going
+//              to sleep.
+//----------------------------------------------------------------------------
+
+bool Condition::Block_ (uint32 u_Sequence, double d_Seconds)
+{
+    struct timespec  ts;
+    struct timespec* p_Timeout = 0;
+
+    if (d_Seconds == 0.0)
+    {
+        return false;
+    }
+
+    if (d_Seconds > 0.0)
+    {
+        ts.tv_sec  = (time_t) d_Seconds;
+        ts.tv_nsec = (long) ((d_Seconds - ts.tv_sec) * 1e9);
+
+        p_Timeout = &ts;
+    }
+
+    long n_Result = syscall (SYS_futex, u_Sequence_.Address(),
+                             FUTEX_WAIT_PRIVATE, u_Sequence, p_Timeout, 0, 0);
+
+    return (n_Result == 0) || (errno != ETIMEDOUT);
+}
+
+void Condition::Wake_ (bool b_All)
+{
+    syscall (SYS_futex, u_Sequence_.Address(), FUTEX_WAKE_PRIVATE,
+             b_All ? INT_MAX : 1, 0, 0, 0);
+}
+
+#else
+
+bool Condition::Block_ (uint32 u_Sequence, double d_Seconds)
+{
+    if (d_Seconds == 0.0)
+    {
+        return false;
+    }
+
+    MutexLocker locker (mutex_);
+
+    if (u_Sequence_.Load() != u_Sequence)
+    {
+        return true;
+    }
+
+    if (d_Seconds < 0.0)
+    {
+        if (pthread_cond_wait (&condition_, &mutex_.mutex_) != 0)
+        {
+            throw Exception ("Condition::Wait failed to wait for condition");
+        }
+
+        return true;
+    }
+
+    struct timeval  tv;
+    struct timespec ts;
+
+    gettimeofday (&tv, 0);
+
+    double d_When = tv.tv_sec + tv.tv_usec / 1e6 + d_Seconds;
+
+    ts.tv_sec  = (time_t) d_When;
+    ts.tv_nsec = (long) ((d_When - ts.tv_sec) * 1e9);
+
+    return pthread_cond_timedwait (&condition_, &mutex_.mutex_, &ts)
+           != ETIMEDOUT;
+}
+
+void Condition::Wake_ (bool b_All)
+{
+    MutexLocker locker (mutex_);
+
+    int n_Result = b_All ? pthread_cond_broadcast (&condition_)
+                         : pthread_cond_signal    (&condition_);
+
+    if (n_Result != 0)
+    {
+        throw Exception ("Condition::Signal failed to signal condition");
+    }
+}
+
+#endif // HAVE_FUTEX
+
+} // namespace mikestoolbox
+
+#endif // SINGLE_THREADED
+
+#endif // PLATFORM_UNIX
@@ -0,0 +1,239 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       UNIX/FileWatcher_UNIX.cpp
+//
+//  Synopsis:   inotify implementation of the FileWatcher class
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+#ifdef HAVE_INOTIFY
+
+namespace mikestoolbox {
+
+bool FileWatcher::Open_ ()
+{
+    h_Notify_ = inotify_init1 (IN_NONBLOCK | IN_CLOEXEC);
+
+    return IsOpen();
+}
+
+void FileWatcher::Close_ ()
+{
+    close (h_Notify_);
+
+    h_Notify_ = -1;
+}
+
+bool FileWatcher::AddWatch_ (const String& str_Path, uintsys u_Events,
+                             intsys& n_Watch)
+{
+    uint32 u_Mask = 0;
+
+    if (u_Events & FILE_EVENT_CREATE)
+    {
+        u_Mask |= IN_CREATE;
+    }
+
+    if (u_Events & FILE_EVENT_MODIFY)
+    {
+        u_Mask |= IN_MODIFY | IN_CLOSE_WRITE;
+    }
+
+    if (u_Events & FILE_EVENT_DELETE)
+    {
+        u_Mask |= IN_DELETE | IN_DELETE_SELF;
+    }
+
+    if (u_Events & FILE_EVENT_MOVE)
+    {
+        u_Mask |= IN_MOVED_FROM | IN_MOVED_TO | IN_MOVE_SELF;
+    }
+
+    int n_Result = inotify_add_watch (h_Notify_, str_Path.C(), u_Mask);
+
+    if (n_Result < 0)
+    {
+        return false;
+    }
+
+    n_Watch = n_Result;
+
+    return true;
+}
+
+void FileWatcher::RemoveWatch_ (intsys n_Watch)
+{
+    inotify_rm_watch (h_Notify_, (int) n_Watch);
+}
+
+static uintsys ConvertInotifyMask (uint32 u_Mask)
+{
+    uintsys u_Events = 0;
+
+    if (u_Mask & IN_CREATE)
+    {
+        u_Events |= FILE_EVENT_CREATE;
+    }
+
+    if (u_Mask & (IN_MODIFY | IN_CLOSE_WRITE))
+    {
+        u_Events |= FILE_EVENT_MODIFY;
+    }
+
+    if (u_Mask & (IN_DELETE | IN_DELETE_SELF))
+    {
+        u_Events |= FILE_EVENT_DELETE;
+    }
+
+    if (u_Mask & (IN_MOVED_FROM | IN_MOVED_TO | IN_MOVE_SELF))
+    {
+        u_Events |= FILE_EVENT_MOVE;
+    }
+
+    return u_Events;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     ReadEvents_
+//
+//  Synopsis:   Waits for the inotify descriptor to become readable and
+//              appends everything that can be read without blocking.
+//              Returns false if the timeout expired first.
+//----------------------------------------------------------------------------
+
+bool FileWatcher::ReadEvents_ (intsys n_TimeoutMilliseconds,
+                               FileEventList& list_Raw)
+{
+    if (!IsOpen())
+    {
+        return false;
+    }
+
+    struct pollfd pfd;
+
+    pfd.fd      = h_Notify_;
+    pfd.events  = POLLIN;
+    pfd.revents = 0;
+
+    int n_Ready = poll (&pfd, 1, (n_TimeoutMilliseconds < 0)
+                                    ? -1 : (int) n_TimeoutMilliseconds);
+
+    if (n_Ready <= 0)
+    {
+        return false;
+    }
+
+    const uintsys u_BufferSize = 16384;
+
+    // aligned for struct inotify_event
+
+    uintsys au_Buffer[u_BufferSize / sizeof(uintsys)];
+
+    for (;;)
+    {
+        ssize_t n_Read = read (h_Notify_, au_Buffer, u_BufferSize);
+
+        if (n_Read <= 0)
+        {
+            break;
+        }
+
+        MutexLocker locker (mutex_);
+
+        const char* p_Event = (const char*) au_Buffer;
+        const char* p_End   = p_Event + n_Read;
+
+        while (p_Event < p_End)
+        {
+            const struct inotify_event* p_Notify =
+                (const struct inotify_event*) p_Event;
+
+            p_Event += sizeof(struct inotify_event) + p_Notify->len;
+
+            String str_Path;
+
+            if (p_Notify->mask & IN_Q_OVERFLOW)     // events were dropped
+            {
+                list_Raw.Append (FileEvent (str_Path, FILE_EVENT_OVERFLOW));
+
+                continue;
+            }
+
+            if (!map_Paths_.Find (p_Notify->wd, str_Path))
+            {
+                continue;
+            }
+
+            if (p_Notify->mask & IN_IGNORED)    // watch removed by kernel
+            {
+                map_Paths_.Delete   (p_Notify->wd);
+                map_Watches_.Delete (str_Path);
+
+                continue;
+            }
+
+            if (p_Notify->len > 0)
+            {
+                if (str_Path[-1] != '/')
+                {
+                    str_Path.Append ('/');
+                }
+
+                str_Path.Append (p_Notify->name);
+            }
+
+            uintsys u_Events = ConvertInotifyMask (p_Notify->mask);
+
+            if (u_Events != 0)
+            {
+                list_Raw.Append (FileEvent (str_Path, u_Events));
+            }
+        }
+    }
+
+    return true;
+}
+
+} // namespace mikestoolbox
+
+#endif // HAVE_INOTIFY
@@ -0,0 +1,139 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       UNIX/FileWriter_UNIX.cpp
+//
+//  Synopsis:   UNIX implementation of the FileWriter class
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+#ifdef PLATFORM_UNIX
+
+namespace mikestoolbox {
+
+FileWriter::FileWriter (const String& str_Name, int n_Flags)
+    : str_Name_         (str_Name)
+    , h_File_           (-1)
+    , mutex_Buffer_     ()
+    , mutex_Write_      ()
+    , mutex_Sync_       ()
+    , str_Buffer_       ()
+    , str_Pending_      ()
+    , u_BufferSize_     (FILE_WRITER_BUFFER_SIZE)
+    , d_FlushInterval_  (FILE_WRITER_FLUSH_INTERVAL)
+    , d_BufferAge_      (0.0)
+    , timer_BufferAge_  ()
+    , u_BytesAppended_  (0)
+    , u_BytesWritten_   (0)
+    , u_BytesSynced_    (0)
+    , b_IsOpen_         (false)
+{
+    b_IsOpen_ = Open_ (n_Flags);
+}
+
+bool FileWriter::Open_ (int n_Flags)
+{
+    int n_OpenFlags = O_WRONLY | O_APPEND;
+
+    if (n_Flags & FILE_CREATE_OK)
+    {
+        n_OpenFlags |= O_CREAT;
+    }
+
+    h_File_ = open (str_Name_.C(), n_OpenFlags, S_IRUSR|S_IWUSR);
+
+    return (h_File_ >= 0);
+}
+
+bool FileWriter::Write_ (const String& str_Contents, uintsys& u_Written)
+{
+    const char* p_Bytes  = str_Contents.C();
+    uintsys     u_Length = str_Contents.Length();
+
+    u_Written = 0;
+
+    while (u_Length > 0)
+    {
+        ssize_t n_Write = write (h_File_, p_Bytes, u_Length);
+
+        if (n_Write < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return false;
+        }
+
+        if (n_Write == 0)
+        {
+            return false;
+        }
+
+        p_Bytes   += n_Write;
+        u_Length  -= n_Write;
+        u_Written += n_Write;
+    }
+
+    return true;
+}
+
+bool FileWriter::Sync_ ()
+{
+#if defined(PLATFORM_OSX)
+    return (fsync (h_File_) == 0);
+#else
+    return (fdatasync (h_File_) == 0);
+#endif
+}
+
+void FileWriter::Close_ ()
+{
+    close (h_File_);
+
+    h_File_ = -1;
+}
+
+} // namespace mikestoolbox
+
+#endif // PLATFORM_UNIX
@@ -224,11 +224,17 @@ static bool WriteBytesToFile (int h_Dest, const char* p_Bytes, uintsys u_Length)
     {
         ssize_t n_Write = write (h_Dest, p_Bytes, u_Length);
 
+        if ((n_Write < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+
         if (n_Write <= 0)
         {
             return false;
         }
 
+        p_Bytes  += n_Write;
         u_Length -= n_Write;
     }
 
@@ -240,6 +246,289 @@ static inline bool WriteStringToFile (int h_Dest, const String& str)
     return WriteBytesToFile (h_Dest, str.C(), str.Length());
 }
 
+//+---------------------------------------------------------------------------
+//  Function:   WriteLinesToFile
+//
+//  Synopsis:   Writes the Strings in a StringList with writev so that the
+//              lines never have to be joined into one big String
+//----------------------------------------------------------------------------
+
+static bool WriteLinesToFile (int h_Dest, const StringList& strl_Lines)
+{
+    const int n_MaxVectors = 64;
+
+    struct iovec aiov[n_MaxVectors];
+
+    StringListIter iter (strl_Lines);
+
+    while (iter)
+    {
+        int n_Vectors = 0;
+
+        while (iter && (n_Vectors < n_MaxVectors))
+        {
+            const String& str (*iter);
+
+            if (!str.IsEmpty())
+            {
+                aiov[n_Vectors].iov_base = (void*) str.C();
+                aiov[n_Vectors].iov_len  = str.Length();
+
+                ++n_Vectors;
+            }
+
+            ++iter;
+        }
+
+        struct iovec* p_Vector = aiov;
+
+        while (n_Vectors > 0)
+        {
+            ssize_t n_Write = writev (h_Dest, p_Vector, n_Vectors);
+
+            if ((n_Write < 0) && (errno == EINTR))
+            {
+                continue;
+            }
+
+            if (n_Write <= 0)
+            {
+                return false;
+            }
+
+            // skip the vectors that were written completely, then adjust
+            // the one that was only partially written
+
+            while ((n_Vectors > 0) && ((size_t)n_Write >= p_Vector->iov_len))
+            {
+                n_Write -= p_Vector->iov_len;
+
+                ++p_Vector;
+                --n_Vectors;
+            }
+
+            if (n_Vectors > 0)
+            {
+                p_Vector->iov_base  = (char*) p_Vector->iov_base + n_Write;
+                p_Vector->iov_len  -= n_Write;
+            }
+        }
+    }
+
+    return true;
+}
+
+//+---------------------------------------------------------------------------
+//  Class:      FileContents
+//
+//  Synopsis:   Lets the Write and Append methods share one implementation
+//              for String and StringList contents
+//----------------------------------------------------------------------------
+
+class FileContents
+{
+public:
+
+    FileContents (const String& str);
+    FileContents (const StringList& strl);
+
+    bool    WriteTo (int h_Dest) const;
+
+private:
+
+    const String*     p_String_;
+    const StringList* p_Lines_;
+};
+
+inline FileContents::FileContents (const String& str)
+    : p_String_ (&str)
+    , p_Lines_  (0)
+{
+    // nothing
+}
+
+inline FileContents::FileContents (const StringList& strl)
+    : p_String_ (0)
+    , p_Lines_  (&strl)
+{
+    // nothing
+}
+
+inline bool FileContents::WriteTo (int h_Dest) const
+{
+    if (p_String_)
+    {
+        return WriteStringToFile (h_Dest, *p_String_);
+    }
+
+    return WriteLinesToFile (h_Dest, *p_Lines_);
+}
+
+static bool SyncDirectory (const String& str_Directory)
+{
+    UnixFileHandle handle (open (str_Directory.C(), O_RDONLY));
+
+    if (!handle.IsOpen())
+    {
+        return false;
+    }
+
+    return (fsync (handle) == 0);
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   ReplaceFileAtomically
+//
+//  Synopsis:   Writes the contents to a temporary file in the same directory,
+//              syncs it, and renames it over the original.  Readers see
+//              either the old file or the new one, never a partial write,
+//              and the new file survives a crash once this returns true.
+//----------------------------------------------------------------------------
+
+static bool ReplaceFileAtomically (const File& file,
+                                   const FileContents& contents,
+                                   int n_Flags)
+{
+    String str_Name (file.Name());
+
+    struct stat stat_Buf;
+
+    bool b_Exists = (stat (str_Name.C(), &stat_Buf) == 0);
+
+    if (b_Exists ? !(n_Flags & FILE_REPLACE_EXISTING)
+                 : !(n_Flags & FILE_CREATE_OK))
+    {
+        return false;
+    }
+
+    String str_Directory (file.Directory());
+    String str_Template  (str_Directory, ".", file.BaseName(), ".XXXXXX");
+    String str_Temp;
+
+    char* pz_Temp = (char*) str_Temp.Allocate (str_Template.Length());
+
+    std::memcpy (pz_Temp, str_Template.C(), str_Template.Length());
+
+    {
+        UnixFileHandle handle (mkstemp (pz_Temp));
+
+        if (!handle.IsOpen())
+        {
+            return false;
+        }
+
+        bool b_Success = true;
+
+        if (b_Exists)
+        {
+            b_Success = (fchmod (handle, stat_Buf.st_mode & 07777) == 0);
+        }
+
+        if (!b_Success || !contents.WriteTo (handle) || (fsync (handle) != 0))
+        {
+            unlink (pz_Temp);
+
+            return false;
+        }
+    }
+
+    if (b_Exists)
+    {
+        if (rename (pz_Temp, str_Name.C()) != 0)
+        {
+            unlink (pz_Temp);
+
+            return false;
+        }
+    }
+    else
+    {
+        // link fails if another process created the file in the meantime
+
+        bool b_Linked = (link (pz_Temp, str_Name.C()) == 0);
+
+        unlink (pz_Temp);
+
+        if (!b_Linked)
+        {
+            return false;
+        }
+    }
+
+    return SyncDirectory (str_Directory);
+}
+
+static bool WriteFile (const File& file, const FileContents& contents,
+                       int n_Flags)
+{
+    if (n_Flags & FILE_ATOMIC_REPLACE)
+    {
+        return ReplaceFileAtomically (file, contents, n_Flags);
+    }
+
+    int n_OpenFlags = O_WRONLY | O_TRUNC;
+
+    if (n_Flags & FILE_CREATE_OK)
+    {
+        n_OpenFlags |= O_CREAT;
+    }
+
+    if (!(n_Flags & FILE_REPLACE_EXISTING))
+    {
+        n_OpenFlags |= O_EXCL;
+    }
+
+    String str_Name (file.Name());
+
+    UnixFileHandle handle (open (str_Name.C(), n_OpenFlags, S_IRUSR|S_IWUSR));
+
+    if (handle.IsOpen())
+    {
+        if (contents.WriteTo (handle))
+        {
+            return true;
+        }
+
+        unlink (str_Name.C());
+    }
+
+    return false;
+}
+
+static bool AppendFile (const File& file, const FileContents& contents,
+                        int n_Flags)
+{
+    int n_OpenFlags = O_WRONLY;
+
+    if (n_Flags & FILE_CREATE_OK)
+    {
+        n_OpenFlags |= O_CREAT;
+    }
+
+    UnixFileHandle handle (open (file.Name().C(), n_OpenFlags,
+                                 S_IRUSR|S_IWUSR));
+
+    if (handle.IsOpen())
+    {
+        off_t n_OriginalLength = lseek (handle, 0, SEEK_END);
+
+        if (n_OriginalLength >= 0)
+        {
+            if (contents.WriteTo (handle))
+            {
+                return true;
+            }
+
+            if (ftruncate (handle, n_OriginalLength) < 0)
+            {
+                return false;
+            }
+        }
+    }
+
+    return false;
+}
+
 static bool CopyFileContents (int h_Dest, int h_Source)
 {
     const uintsys u_BufferSize = 8192;
@@ -364,34 +653,12 @@ String GetDirectory ()
 
 bool File::Append (const String& str_Contents, int n_Flags)
 {
-    int n_OpenFlags = O_WRONLY;
-
-    if (n_Flags & FILE_CREATE_OK)
-    {
-        n_OpenFlags |= O_CREAT;
-    }
-
-    UnixFileHandle handle (open (str_Name_.C(), n_OpenFlags, S_IRUSR|S_IWUSR));
-
-    if (handle.IsOpen())
-    {
-        off_t n_OriginalLength = lseek (handle, 0, SEEK_END);
-
-        if (n_OriginalLength >= 0)
-        {
-            if (WriteStringToFile (handle, str_Contents))
-            {
-                return true;
-            }
-
-            if (ftruncate (handle, n_OriginalLength) < 0)
-            {
-                return false;
-            }
-        }
-    }
+    return AppendFile (*this, FileContents (str_Contents), n_Flags);
+}
 
-    return false;
+bool File::Append (const StringList& strl_Lines, int n_Flags)
+{
+    return AppendFile (*this, FileContents (strl_Lines), n_Flags);
 }
 
 bool File::Read (String& str_Contents) const
@@ -440,31 +707,12 @@ bool File::Read (String& str_Contents) const
 
 bool File::Write (const String& str_Contents, int n_Flags)
 {
-    int n_OpenFlags = O_WRONLY | O_TRUNC;
-
-    if (n_Flags & FILE_CREATE_OK)
-    {
-        n_OpenFlags |= O_CREAT;
-    }
-
-    if (!(n_Flags & FILE_REPLACE_EXISTING))
-    {
-        n_OpenFlags |= O_EXCL;
-    }
-
-    UnixFileHandle handle (open (str_Name_.C(), n_OpenFlags, S_IRUSR|S_IWUSR));
-
-    if (handle.IsOpen())
-    {
-        if (WriteStringToFile (handle, str_Contents))
-        {
-            return true;
-        }
-
-        Delete();
-    }
+    return WriteFile (*this, FileContents (str_Contents), n_Flags);
+}
 
-    return false;
+bool File::Write (const StringList& strl_Lines, int n_Flags)
+{
+    return WriteFile (*this, FileContents (strl_Lines), n_Flags);
 }
 
 StringList ReadDirectory (const String& str_Directory)
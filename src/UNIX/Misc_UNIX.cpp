@@ -54,6 +54,90 @@ void millisleep (uintsys u_Milliseconds)
     select (0, 0, 0, 0, &t);
 }
 
+uintsys NumProcessors ()
+{
+    long n_Count = sysconf (_SC_NPROCESSORS_ONLN);
+
+    return (n_Count > 0) ? (uintsys) n_Count : 1;
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   ReadNumberList
+//
+//  Synopsis:   Reads a sysfs list such as "0-3,8-11" into its numbers
+//----------------------------------------------------------------------------
+
+static List<uintsys> ReadNumberList (const String& str_Path)
+{
+    List<uintsys> list_Numbers;
+    String        str_List;
+
+    if (!File (str_Path).Read (str_List))
+    {
+        return list_Numbers;
+    }
+
+    StringList strl_Ranges (str_List.Split (','));
+
+    while (!strl_Ranges.IsEmpty())
+    {
+        StringList strl_Range (strl_Ranges.Shift().Split ('-'));
+
+        if (strl_Range.IsEmpty())
+        {
+            continue;
+        }
+
+        uintsys u_First = strl_Range.Shift().AsUint();
+        uintsys u_Last  = strl_Range.IsEmpty() ? u_First
+                                               : strl_Range.Shift().AsUint();
+
+        for (uintsys u = u_First; u <= u_Last; ++u)
+        {
+            list_Numbers.Append (u);
+        }
+    }
+
+    return list_Numbers;
+}
+
+uintsys NumNumaNodes ()
+{
+    List<uintsys> list_Nodes (
+        ReadNumberList ("/sys/devices/system/node/online"));
+
+    return list_Nodes.IsEmpty() ? 1 : list_Nodes.Pop() + 1;
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   NumaNodeProcessors
+//
+//  Synopsis:   Returns the processors which belong to a NUMA node.  A
+//              system without NUMA information is one node holding every
+//              processor.
+//----------------------------------------------------------------------------
+
+List<uintsys> NumaNodeProcessors (uintsys u_Node)
+{
+    String str_Path ("/sys/devices/system/node/node");
+
+    str_Path.Append (u_Node);
+    str_Path.Append ("/cpulist");
+
+    List<uintsys> list_Processors (ReadNumberList (str_Path));
+
+    if (list_Processors.IsEmpty() && (u_Node == 0) &&
+        !File ("/sys/devices/system/node").Exists())
+    {
+        for (uintsys u = 0; u < NumProcessors(); ++u)
+        {
+            list_Processors.Append (u);
+        }
+    }
+
+    return list_Processors;
+}
+
 } // namespace mikestoolbox
 
 #endif // PLATFORM_UNIX
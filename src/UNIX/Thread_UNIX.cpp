@@ -57,6 +57,141 @@ uintsys getThreadId()
     return (uintsys)pthread_self();
 }
 
+//+---------------------------------------------------------------------------
+//  Function:   SystemThreadId
+//
+//  Synopsis:   Returns the kernel's id for the calling thread, which is
+//              what setpriority() needs to change one thread's priority
+//----------------------------------------------------------------------------
+
+static intsys SystemThreadId ()
+{
+#ifdef HAVE_THREAD_AFFINITY
+    return (intsys) syscall (SYS_gettid);
+#else
+    return 1;
+#endif
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Create_
+//
+//  Synopsis:   Creates the system thread, which waits for Run()
+//----------------------------------------------------------------------------
+
+void Thread::Create_ (uintsys u_StackSize)
+{
+    if (u_StackSize == 0)
+    {
+        u_StackSize = u_DefaultStackSize_;
+    }
+
+    pthread_attr_t attrs;
+
+    if (pthread_attr_init (&attrs) != 0)
+    {
+        throw Exception ("Thread: Failed to create thread");
+    }
+
+    if (u_StackSize != 0)
+    {
+        uintsys u_PageSize = (uintsys) sysconf (_SC_PAGESIZE);
+
+        u_StackSize = Maximum (u_StackSize, (uintsys) PTHREAD_STACK_MIN);
+        u_StackSize = (u_StackSize + u_PageSize - 1) & ~(u_PageSize - 1);
+
+        if (pthread_attr_setstacksize (&attrs, u_StackSize) != 0)
+        {
+            pthread_attr_destroy (&attrs);
+
+            throw Exception ("Thread: Invalid stack size");
+        }
+    }
+
+    int n_Error = pthread_create (&h_Thread_, &attrs, Thread::ThreadMain_,
+                                  this);
+
+    pthread_attr_destroy (&attrs);
+
+    if (n_Error != 0)
+    {
+        throw Exception ("Thread: Failed to create thread");
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     ApplySettings_
+//
+//  Synopsis:   Applies the settings which only the thread itself can
+//              change, once Run() has been called
+//----------------------------------------------------------------------------
+
+void Thread::ApplySettings_ ()
+{
+    if (n_Priority_ != THREAD_PRIORITY_NORMAL)
+    {
+        ApplyPriority_();
+    }
+
+#ifdef HAVE_THREAD_AFFINITY
+    if ((n_NumaNode_ >= 0) && (n_NumaNode_ < (intsys) (8 * sizeof(long))))
+    {
+        unsigned long ul_NodeMask = 1UL << n_NumaNode_;
+
+        syscall (SYS_set_mempolicy, MPOL_PREFERRED, &ul_NodeMask,
+                 8 * sizeof(ul_NodeMask) + 1);
+    }
+#endif
+
+#ifdef PLATFORM_OSX
+    if (!str_Name_.IsEmpty())
+    {
+        char sz_Name[64];
+
+        str_Name_.CopyTo (sz_Name, sizeof(sz_Name));
+
+        pthread_setname_np (sz_Name);
+    }
+#endif
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     ApplyPriority_
+//
+//  Synopsis:   On Linux each thread under the normal policies has its own
+//              nice value, so THREAD_PRIORITY_HIGHEST..LOWEST map to nice
+//              -10..10.  Elsewhere the priority is scaled into the range
+//              of the thread's current policy.
+//
+//  Notes:      Raising the priority usually needs privileges; without
+//              them the thread keeps its old priority
+//----------------------------------------------------------------------------
+
+void Thread::ApplyPriority_ ()
+{
+#ifdef HAVE_THREAD_AFFINITY
+    setpriority (PRIO_PROCESS, (id_t) n_SystemId_.Load(),
+                 (int) (-5 * n_Priority_));
+#else
+    int         n_Policy = 0;
+    sched_param param;
+
+    if (pthread_getschedparam (h_Thread_, &n_Policy, &param) == 0)
+    {
+        intsys n_Min = sched_get_priority_min (n_Policy);
+        intsys n_Max = sched_get_priority_max (n_Policy);
+        intsys n_Mid = (n_Min + n_Max) / 2;
+
+        intsys n_Value = n_Mid + n_Priority_ * (n_Max - n_Min) / 4;
+
+        param.sched_priority = (int) Minimum (Maximum (n_Value, n_Min),
+                                              n_Max);
+
+        pthread_setschedparam (h_Thread_, n_Policy, &param);
+    }
+#endif
+}
+
 void* Thread::ThreadMain_ (void* p_Thread)
 {
     Thread* p_This = (Thread*) p_Thread;
@@ -65,8 +200,12 @@ void* Thread::ThreadMain_ (void* p_Thread)
     {
         pthread_detach (pthread_self());
 
+        p_This->n_SystemId_.Store (SystemThreadId());
+
         p_This->cond_Startup_.Wait();
 
+        p_This->ApplySettings_();
+
         p_This->date_Start_ = Date();
         p_This->date_Stop_  = p_This->date_Start_;
 
@@ -101,12 +240,26 @@ void* Thread::ThreadMain_ (void* p_Thread)
     p_This->date_Stop_ = Date();
     p_This->b_Running_ = false;
 
+    {
+        // the thread is detached, so h_Thread_ and the kernel id may be
+        // reused as soon as it returns
+
+        MutexLocker locker (p_This->mutex_Handle_);
+
+        p_This->n_SystemId_.Store (0);
+        p_This->b_Finished_ = true;
+    }
+
+    Exited_ (p_This);                  // the owner may delete p_This now
+
+    MemoryCache::ThreadExit();
+
     return 0;
 }
 
 Thread::~Thread ()
 {
-    // nothing
+    delete p_Result_;
 }
 
 void Thread::Suspend ()
@@ -123,14 +276,202 @@ void Thread::Resume ()
 #endif
 }
 
+//+---------------------------------------------------------------------------
+//  Method:     SetPriority
+//
+//  Synopsis:   Sets the priority, at once if the thread has started
+//
+//  Notes:      Like the other setters below, this only stores the value
+//              once the thread has finished, since its handle and kernel
+//              id may then belong to another thread
+//----------------------------------------------------------------------------
+
 void Thread::SetPriority (intsys n_Priority)
 {
-    if (b_Running_)
+    n_Priority_ = n_Priority;
+
+    MutexLocker locker (mutex_Handle_);
+
+    if (!b_Finished_ && (n_SystemId_.Load() != 0))
     {
-        //+++ change active priority
+        ApplyPriority_();
     }
+}
 
-    n_Priority_ = n_Priority;
+//+---------------------------------------------------------------------------
+//  Method:     SetPolicy
+//
+//  Synopsis:   Changes the scheduling policy.  n_Priority is the real-time
+//              priority for THREAD_POLICY_FIFO and THREAD_POLICY_ROUND_ROBIN
+//              and is clamped to the range the system allows; the other
+//              policies ignore it.  Returns false if the policy is not
+//              supported or not permitted, or if the thread has finished.
+//----------------------------------------------------------------------------
+
+bool Thread::SetPolicy (ThreadPolicy policy, intsys n_Priority)
+{
+    int n_Policy = SCHED_OTHER;
+
+    switch (policy)
+    {
+        case THREAD_POLICY_NORMAL:      n_Policy = SCHED_OTHER; break;
+        case THREAD_POLICY_FIFO:        n_Policy = SCHED_FIFO;  break;
+        case THREAD_POLICY_ROUND_ROBIN: n_Policy = SCHED_RR;    break;
+#ifdef SCHED_BATCH
+        case THREAD_POLICY_BATCH:       n_Policy = SCHED_BATCH; break;
+#endif
+#ifdef SCHED_IDLE
+        case THREAD_POLICY_IDLE:        n_Policy = SCHED_IDLE;  break;
+#endif
+        default:                        return false;
+    }
+
+    sched_param param;
+
+    std::memset (&param, 0, sizeof(param));
+
+    if ((n_Policy == SCHED_FIFO) || (n_Policy == SCHED_RR))
+    {
+        intsys n_Min = sched_get_priority_min (n_Policy);
+        intsys n_Max = sched_get_priority_max (n_Policy);
+
+        param.sched_priority = (int) Minimum (Maximum (n_Priority, n_Min),
+                                              n_Max);
+    }
+
+    MutexLocker locker (mutex_Handle_);
+
+    if (b_Finished_)
+    {
+        return false;
+    }
+
+    return (pthread_setschedparam (h_Thread_, n_Policy, &param) == 0);
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     SetAffinity
+//
+//  Synopsis:   Restricts the thread to the given processors, numbered from
+//              zero.  Returns false if the list is empty, the system
+//              rejects it or the thread has finished.
+//----------------------------------------------------------------------------
+
+bool Thread::SetAffinity (const List<uintsys>& list_Processors)
+{
+#ifdef HAVE_THREAD_AFFINITY
+    if (list_Processors.IsEmpty())
+    {
+        return false;
+    }
+
+    cpu_set_t set;
+
+    CPU_ZERO (&set);
+
+    for (ListIter<uintsys> iter (list_Processors); iter; ++iter)
+    {
+        if (*iter >= CPU_SETSIZE)
+        {
+            return false;
+        }
+
+        CPU_SET (*iter, &set);
+    }
+
+    MutexLocker locker (mutex_Handle_);
+
+    if (b_Finished_)
+    {
+        return false;
+    }
+
+    return (pthread_setaffinity_np (h_Thread_, sizeof(set), &set) == 0);
+#else
+    (void) list_Processors;
+
+    return false;
+#endif
+}
+
+List<uintsys> Thread::Affinity () const
+{
+    List<uintsys> list_Processors;
+
+#ifdef HAVE_THREAD_AFFINITY
+    cpu_set_t set;
+
+    CPU_ZERO (&set);
+
+    MutexLocker locker (mutex_Handle_);
+
+    if (!b_Finished_ &&
+        (pthread_getaffinity_np (h_Thread_, sizeof(set), &set) == 0))
+    {
+        for (uintsys u = 0; u < CPU_SETSIZE; ++u)
+        {
+            if (CPU_ISSET (u, &set))
+            {
+                list_Processors.Append (u);
+            }
+        }
+    }
+#endif
+
+    return list_Processors;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     SetNumaNode
+//
+//  Synopsis:   Runs the thread on the processors of one NUMA node and
+//              prefers that node's memory for its allocations
+//
+//  Notes:      The memory policy can only be set by the thread itself, so
+//              it takes effect when the thread starts, or at once if a
+//              running thread calls this on itself
+//----------------------------------------------------------------------------
+
+bool Thread::SetNumaNode (uintsys u_Node)
+{
+    if (!SetAffinity (NumaNodeProcessors (u_Node)))
+    {
+        return false;
+    }
+
+    n_NumaNode_ = (intsys) u_Node;
+
+    if (pthread_equal (pthread_self(), h_Thread_))
+    {
+        ApplySettings_();
+    }
+
+    return true;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     SetName
+//
+//  Synopsis:   Names the thread for top, ps and perf.  Linux keeps only the
+//              first 15 characters.
+//----------------------------------------------------------------------------
+
+void Thread::SetName (const String& str_Name)
+{
+    str_Name_ = str_Name;
+
+#ifdef HAVE_THREAD_AFFINITY
+    char sz_Name[17];   // CopyTo() leaves room for two terminators
+
+    str_Name_.CopyTo (sz_Name, sizeof(sz_Name));
+
+    MutexLocker locker (mutex_Handle_);
+
+    if (!b_Finished_)
+    {
+        pthread_setname_np (h_Thread_, sz_Name);
+    }
+#endif
 }
 
 uintsys Thread::GetId () const
@@ -0,0 +1,1113 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       Unicode.cpp
+//
+//  Synopsis:   Implementation of Unicode methods
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+#ifdef HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef HAVE_AVX2
+#include <immintrin.h>
+#endif
+
+namespace mikestoolbox {
+
+//+---------------------------------------------------------------------------
+//  Function:   DecodeUTF8Char
+//
+//  Synopsis:   Decodes the multi-byte character at p and returns its length,
+//              or sets the error and returns zero
+//----------------------------------------------------------------------------
+
+static inline uintsys DecodeUTF8Char (const uchar* p, const uchar* p_End,
+                                      uint32& u, ParseError& error)
+{
+    uint32  u_Min = 0;
+    uintsys n     = 0;
+
+    if ((p[0] & 0xE0) == 0xC0)
+    {
+        u     = p[0] & 0x1F;
+        u_Min = 0x80;
+        n     = 2;
+    }
+    else if ((p[0] & 0xF0) == 0xE0)
+    {
+        u     = p[0] & 0x0F;
+        u_Min = 0x800;
+        n     = 3;
+    }
+    else if ((p[0] & 0xF8) == 0xF0)
+    {
+        u     = p[0] & 0x07;
+        u_Min = 0x10000;
+        n     = 4;
+    }
+    else
+    {
+        error.SetIllegalByteSequence();
+
+        return 0;
+    }
+
+    if ((uintsys)(p_End - p) < n)
+    {
+        error.SetUnexpectedEndOfData();
+
+        return 0;
+    }
+
+    for (uintsys i = 1; i < n; ++i)
+    {
+        if ((p[i] & 0xC0) != 0x80)
+        {
+            error.SetIllegalByteSequence();
+
+            return 0;
+        }
+
+        u = (u << 6) | (p[i] & 0x3F);
+    }
+
+    if ((u < u_Min) || (u > MAX_UNICODE_CODE_POINT))
+    {
+        error.SetResultOutOfRange();
+
+        return 0;
+    }
+
+    if ((u & 0xFFFFF800) == 0xD800)
+    {
+        error.SetUnicodeSurrogate();
+
+        return 0;
+    }
+
+    return n;
+}
+
+//  The same for a character already known to be well-formed
+
+static inline uintsys DecodeValidUTF8Char (const uchar* p, uint32& u)
+{
+    if (p[0] < 0xE0)
+    {
+        u = (uint32(p[0] & 0x1F) << 6) | (p[1] & 0x3F);
+
+        return 2;
+    }
+
+    if (p[0] < 0xF0)
+    {
+        u = (uint32(p[0] & 0x0F) << 12) | (uint32(p[1] & 0x3F) << 6) |
+            (p[2] & 0x3F);
+
+        return 3;
+    }
+
+    u = (uint32(p[0] & 0x07) << 18) | (uint32(p[1] & 0x3F) << 12) |
+        (uint32(p[2] & 0x3F) <<  6) | (p[3] & 0x3F);
+
+    return 4;
+}
+
+static inline void PutUTF8 (uint32 u, uchar*& q)
+{
+    if (u < 0x80)
+    {
+        *q++ = (uchar) u;
+    }
+    else if (u < 0x800)
+    {
+        q[0] = (uchar) (0xC0 | (u >> 6));
+        q[1] = (uchar) (0x80 | (u & 0x3F));
+
+        q += 2;
+    }
+    else if (u < 0x10000)
+    {
+        q[0] = (uchar) (0xE0 | (u >> 12));
+        q[1] = (uchar) (0x80 | ((u >> 6) & 0x3F));
+        q[2] = (uchar) (0x80 | (u & 0x3F));
+
+        q += 3;
+    }
+    else
+    {
+        q[0] = (uchar) (0xF0 | (u >> 18));
+        q[1] = (uchar) (0x80 | ((u >> 12) & 0x3F));
+        q[2] = (uchar) (0x80 | ((u >> 6) & 0x3F));
+        q[3] = (uchar) (0x80 | (u & 0x3F));
+
+        q += 4;
+    }
+}
+
+static inline void PutUTF16 (uint32 u, uchar*& q)
+{
+    if (u < 0x10000)
+    {
+        q[0] = (uchar) (u >> 8);
+        q[1] = (uchar)  u;
+
+        q += 2;
+    }
+    else
+    {
+        uint32 u_High = 0xD800 | ((u - 0x10000) >> 10);
+        uint32 u_Low  = 0xDC00 | (u & 0x3FF);
+
+        q[0] = (uchar) (u_High >> 8);
+        q[1] = (uchar)  u_High;
+        q[2] = (uchar) (u_Low >> 8);
+        q[3] = (uchar)  u_Low;
+
+        q += 4;
+    }
+}
+
+static inline void PutUTF32 (uint32 u, uchar*& q)
+{
+    q[0] = 0;
+    q[1] = (uchar) (u >> 16);
+    q[2] = (uchar) (u >> 8);
+    q[3] = (uchar)  u;
+
+    q += 4;
+}
+
+static inline uint32 GetUTF16 (const uchar* p)
+{
+    return (uint32(p[0]) << 8) | p[1];
+}
+
+static inline uint32 GetUTF32 (const uchar* p)
+{
+    return (uint32(p[0]) << 24) | (uint32(p[1]) << 16) |
+           (uint32(p[2]) <<  8) |  p[3];
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   SkipAscii
+//
+//  Synopsis:   Moves p past ASCII eight bytes at a time, stopping at or
+//              before the first byte with its high bit set
+//----------------------------------------------------------------------------
+
+static inline void SkipAscii (const uchar*& p, const uchar* p_End)
+{
+    for ( ; p_End - p >= 8; p += 8)
+    {
+        uint64 u = 0;
+
+        std::memcpy (&u, p, 8);
+
+        if (u & 0x8080808080808080ULL)
+        {
+            break;
+        }
+    }
+}
+
+#ifdef HAVE_SSE2
+
+//+---------------------------------------------------------------------------
+//  Synopsis:   Each of these converts ASCII sixteen characters at a time,
+//              stopping at the first block that has anything else in it
+//----------------------------------------------------------------------------
+
+static inline void SkipAsciiSse2 (const uchar*& p, const uchar* p_End)
+{
+    for ( ; p_End - p >= 16; p += 16)
+    {
+        __m128i v = _mm_loadu_si128 ((const __m128i*) p);
+
+        if (_mm_movemask_epi8 (v) != 0)
+        {
+            break;
+        }
+    }
+}
+
+static inline void CopyAsciiSse2 (const uchar*& p, const uchar* p_End,
+                                  uchar*& q)
+{
+    for ( ; p_End - p >= 16; p += 16, q += 16)
+    {
+        __m128i v = _mm_loadu_si128 ((const __m128i*) p);
+
+        if (_mm_movemask_epi8 (v) != 0)
+        {
+            break;
+        }
+
+        _mm_storeu_si128 ((__m128i*) q, v);
+    }
+}
+
+static inline void WidenAsciiSse2 (const uchar*& p, const uchar* p_End,
+                                   uchar*& q)
+{
+    __m128i v_Zero = _mm_setzero_si128();
+
+    for ( ; p_End - p >= 16; p += 16, q += 32)
+    {
+        __m128i v = _mm_loadu_si128 ((const __m128i*) p);
+
+        if (_mm_movemask_epi8 (v) != 0)
+        {
+            break;
+        }
+
+        _mm_storeu_si128 ((__m128i*)  q,     _mm_unpacklo_epi8 (v_Zero, v));
+        _mm_storeu_si128 ((__m128i*) (q+16), _mm_unpackhi_epi8 (v_Zero, v));
+    }
+}
+
+static inline void WidenAsciiTwiceSse2 (const uchar*& p, const uchar* p_End,
+                                        uchar*& q)
+{
+    __m128i v_Zero = _mm_setzero_si128();
+
+    for ( ; p_End - p >= 16; p += 16, q += 64)
+    {
+        __m128i v = _mm_loadu_si128 ((const __m128i*) p);
+
+        if (_mm_movemask_epi8 (v) != 0)
+        {
+            break;
+        }
+
+        __m128i v_Low  = _mm_unpacklo_epi8 (v_Zero, v);
+        __m128i v_High = _mm_unpackhi_epi8 (v_Zero, v);
+
+        _mm_storeu_si128 ((__m128i*)  q,
+                          _mm_unpacklo_epi16 (v_Zero, v_Low));
+        _mm_storeu_si128 ((__m128i*) (q+16),
+                          _mm_unpackhi_epi16 (v_Zero, v_Low));
+        _mm_storeu_si128 ((__m128i*) (q+32),
+                          _mm_unpacklo_epi16 (v_Zero, v_High));
+        _mm_storeu_si128 ((__m128i*) (q+48),
+                          _mm_unpackhi_epi16 (v_Zero, v_High));
+    }
+}
+
+//  A big-endian UTF-16 unit is ASCII when its first byte is zero and its
+//  second is below 0x80, that is when the little-endian lane has none of
+//  the bits in 0x80FF set; the character is then the lane's high byte
+
+static inline void NarrowUTF16Sse2 (const uchar*& p, const uchar* p_End,
+                                    uchar*& q)
+{
+    __m128i v_Mask = _mm_set1_epi16 ((short) 0x80FF);
+    __m128i v_Zero = _mm_setzero_si128();
+
+    for ( ; p_End - p >= 32; p += 32, q += 16)
+    {
+        __m128i v1 = _mm_loadu_si128 ((const __m128i*)  p);
+        __m128i v2 = _mm_loadu_si128 ((const __m128i*) (p+16));
+
+        __m128i v_Bad = _mm_and_si128 (_mm_or_si128 (v1, v2), v_Mask);
+
+        if (_mm_movemask_epi8 (_mm_cmpeq_epi16 (v_Bad, v_Zero)) != 0xFFFF)
+        {
+            break;
+        }
+
+        _mm_storeu_si128 ((__m128i*) q,
+                          _mm_packus_epi16 (_mm_srli_epi16 (v1, 8),
+                                            _mm_srli_epi16 (v2, 8)));
+    }
+}
+
+static inline void NarrowUTF32Sse2 (const uchar*& p, const uchar* p_End,
+                                    uchar*& q)
+{
+    __m128i v_Mask = _mm_set1_epi32 ((int) 0x80FFFFFF);
+    __m128i v_Zero = _mm_setzero_si128();
+
+    for ( ; p_End - p >= 64; p += 64, q += 16)
+    {
+        __m128i v1 = _mm_loadu_si128 ((const __m128i*)  p);
+        __m128i v2 = _mm_loadu_si128 ((const __m128i*) (p+16));
+        __m128i v3 = _mm_loadu_si128 ((const __m128i*) (p+32));
+        __m128i v4 = _mm_loadu_si128 ((const __m128i*) (p+48));
+
+        __m128i v_Bad = _mm_or_si128 (_mm_or_si128 (v1, v2),
+                                      _mm_or_si128 (v3, v4));
+
+        v_Bad = _mm_and_si128 (v_Bad, v_Mask);
+
+        if (_mm_movemask_epi8 (_mm_cmpeq_epi32 (v_Bad, v_Zero)) != 0xFFFF)
+        {
+            break;
+        }
+
+        __m128i v12 = _mm_packs_epi32 (_mm_srli_epi32 (v1, 24),
+                                       _mm_srli_epi32 (v2, 24));
+        __m128i v34 = _mm_packs_epi32 (_mm_srli_epi32 (v3, 24),
+                                       _mm_srli_epi32 (v4, 24));
+
+        _mm_storeu_si128 ((__m128i*) q, _mm_packus_epi16 (v12, v34));
+    }
+}
+
+#endif
+
+#ifdef HAVE_AVX2
+
+//+---------------------------------------------------------------------------
+//  Synopsis:   The same thirty-two characters at a time
+//----------------------------------------------------------------------------
+
+__attribute__((target("avx2"), noinline))
+static void CopyAsciiAvx2 (const uchar*& p, const uchar* p_End, uchar*& q)
+{
+    for ( ; p_End - p >= 32; p += 32, q += 32)
+    {
+        __m256i v = _mm256_loadu_si256 ((const __m256i*) p);
+
+        if (_mm256_movemask_epi8 (v) != 0)
+        {
+            break;
+        }
+
+        _mm256_storeu_si256 ((__m256i*) q, v);
+    }
+}
+
+__attribute__((target("avx2"), noinline))
+static void WidenAsciiAvx2 (const uchar*& p, const uchar* p_End, uchar*& q)
+{
+    for ( ; p_End - p >= 32; p += 32, q += 64)
+    {
+        __m256i v = _mm256_loadu_si256 ((const __m256i*) p);
+
+        if (_mm256_movemask_epi8 (v) != 0)
+        {
+            break;
+        }
+
+        __m256i v1 = _mm256_cvtepu8_epi16 (_mm256_castsi256_si128 (v));
+        __m256i v2 = _mm256_cvtepu8_epi16 (_mm256_extracti128_si256 (v, 1));
+
+        _mm256_storeu_si256 ((__m256i*)  q,     _mm256_slli_epi16 (v1, 8));
+        _mm256_storeu_si256 ((__m256i*) (q+32), _mm256_slli_epi16 (v2, 8));
+    }
+}
+
+__attribute__((target("avx2"), noinline))
+static void NarrowUTF16Avx2 (const uchar*& p, const uchar* p_End, uchar*& q)
+{
+    __m256i v_Mask = _mm256_set1_epi16 ((short) 0x80FF);
+
+    for ( ; p_End - p >= 64; p += 64, q += 32)
+    {
+        __m256i v1 = _mm256_loadu_si256 ((const __m256i*)  p);
+        __m256i v2 = _mm256_loadu_si256 ((const __m256i*) (p+32));
+
+        __m256i v_Bad = _mm256_and_si256 (_mm256_or_si256 (v1, v2), v_Mask);
+
+        if (!_mm256_testz_si256 (v_Bad, v_Bad))
+        {
+            break;
+        }
+
+        __m256i v = _mm256_packus_epi16 (_mm256_srli_epi16 (v1, 8),
+                                         _mm256_srli_epi16 (v2, 8));
+
+        _mm256_storeu_si256 ((__m256i*) q, _mm256_permute4x64_epi64 (v, 0xD8));
+    }
+}
+
+//  Flags for the UTF-8 lookup tables, one bit for each kind of error a
+//  pair of bytes can show, after Keiser and Lemire
+
+enum
+{
+    UTF8_TOO_SHORT  = 0x01,     // lead byte not followed by a continuation
+    UTF8_TOO_LONG   = 0x02,     // ASCII followed by a continuation
+    UTF8_OVERLONG_3 = 0x04,     // E0 followed by 80..9F
+    UTF8_TOO_LARGE  = 0x08,     // F4 followed by 90..BF, or F5 and above
+    UTF8_SURROGATE  = 0x10,     // ED followed by A0..BF
+    UTF8_OVERLONG_2 = 0x20,     // C0 or C1
+    UTF8_OVERLONG_4 = 0x40,     // F0 followed by 80..8F, or F5 and above
+    UTF8_TWO_CONTS  = 0x80,     // continuation following a continuation
+    UTF8_CARRY      = UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS
+};
+
+#define T(x) ((char) (x))
+
+//+---------------------------------------------------------------------------
+//  Function:   ValidateAvx2
+//
+//  Synopsis:   Checks the whole buffer 32 bytes at a time
+//
+//  Notes:      Every byte is looked up in three tables, by the high and low
+//              nibbles of the byte before it and by its own high nibble,
+//              and the results are ANDed: a bit left standing is an error,
+//              except that a continuation two or three bytes after a lead
+//              byte that wants one is expected to leave UTF8_TWO_CONTS.
+//              A block with nothing but ASCII only needs the one before it
+//              not to end in the middle of a character.
+//----------------------------------------------------------------------------
+
+__attribute__((target("avx2"), noinline))
+static bool ValidateAvx2 (const uchar* p, const uchar* p_End)
+{
+    const __m256i v_Byte1High = _mm256_setr_epi8 (
+        T(UTF8_TOO_LONG), T(UTF8_TOO_LONG), T(UTF8_TOO_LONG),
+        T(UTF8_TOO_LONG), T(UTF8_TOO_LONG), T(UTF8_TOO_LONG),
+        T(UTF8_TOO_LONG), T(UTF8_TOO_LONG),
+        T(UTF8_TWO_CONTS), T(UTF8_TWO_CONTS), T(UTF8_TWO_CONTS),
+        T(UTF8_TWO_CONTS),
+        T(UTF8_TOO_SHORT | UTF8_OVERLONG_2),
+        T(UTF8_TOO_SHORT),
+        T(UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE),
+        T(UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+
+        T(UTF8_TOO_LONG), T(UTF8_TOO_LONG), T(UTF8_TOO_LONG),
+        T(UTF8_TOO_LONG), T(UTF8_TOO_LONG), T(UTF8_TOO_LONG),
+        T(UTF8_TOO_LONG), T(UTF8_TOO_LONG),
+        T(UTF8_TWO_CONTS), T(UTF8_TWO_CONTS), T(UTF8_TWO_CONTS),
+        T(UTF8_TWO_CONTS),
+        T(UTF8_TOO_SHORT | UTF8_OVERLONG_2),
+        T(UTF8_TOO_SHORT),
+        T(UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE),
+        T(UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_OVERLONG_4));
+
+    const __m256i v_Byte1Low = _mm256_setr_epi8 (
+        T(UTF8_CARRY | UTF8_OVERLONG_2 | UTF8_OVERLONG_3 | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_OVERLONG_2),
+        T(UTF8_CARRY),
+        T(UTF8_CARRY),
+        T(UTF8_CARRY | UTF8_TOO_LARGE),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4 | UTF8_SURROGATE),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+
+        T(UTF8_CARRY | UTF8_OVERLONG_2 | UTF8_OVERLONG_3 | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_OVERLONG_2),
+        T(UTF8_CARRY),
+        T(UTF8_CARRY),
+        T(UTF8_CARRY | UTF8_TOO_LARGE),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4 | UTF8_SURROGATE),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4),
+        T(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_OVERLONG_4));
+
+    const __m256i v_Byte2High = _mm256_setr_epi8 (
+        T(UTF8_TOO_SHORT), T(UTF8_TOO_SHORT), T(UTF8_TOO_SHORT),
+        T(UTF8_TOO_SHORT), T(UTF8_TOO_SHORT), T(UTF8_TOO_SHORT),
+        T(UTF8_TOO_SHORT), T(UTF8_TOO_SHORT),
+        T(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+          UTF8_OVERLONG_3 | UTF8_OVERLONG_4),
+        T(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+          UTF8_OVERLONG_3 | UTF8_TOO_LARGE),
+        T(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+          UTF8_SURROGATE | UTF8_TOO_LARGE),
+        T(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+          UTF8_SURROGATE | UTF8_TOO_LARGE),
+        T(UTF8_TOO_SHORT), T(UTF8_TOO_SHORT), T(UTF8_TOO_SHORT),
+        T(UTF8_TOO_SHORT),
+
+        T(UTF8_TOO_SHORT), T(UTF8_TOO_SHORT), T(UTF8_TOO_SHORT),
+        T(UTF8_TOO_SHORT), T(UTF8_TOO_SHORT), T(UTF8_TOO_SHORT),
+        T(UTF8_TOO_SHORT), T(UTF8_TOO_SHORT),
+        T(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+          UTF8_OVERLONG_3 | UTF8_OVERLONG_4),
+        T(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+          UTF8_OVERLONG_3 | UTF8_TOO_LARGE),
+        T(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+          UTF8_SURROGATE | UTF8_TOO_LARGE),
+        T(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+          UTF8_SURROGATE | UTF8_TOO_LARGE),
+        T(UTF8_TOO_SHORT), T(UTF8_TOO_SHORT), T(UTF8_TOO_SHORT),
+        T(UTF8_TOO_SHORT));
+
+    //  Subtracting these leaves something only in the last three bytes
+    //  of a block that ends in the middle of a character
+
+    const __m256i v_Incomplete = _mm256_setr_epi8 (
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        T(0xF0-1), T(0xE0-1), T(0xC0-1));
+
+    const __m256i v_Nibble = _mm256_set1_epi8 (0x0F);
+    const __m256i v_Third  = _mm256_set1_epi8 (T(0xE0-0x80));
+    const __m256i v_Fourth = _mm256_set1_epi8 (T(0xF0-0x80));
+    const __m256i v_High   = _mm256_set1_epi8 (T(0x80));
+
+    __m256i v_Error = _mm256_setzero_si256();
+    __m256i v_Prev  = _mm256_setzero_si256();
+    __m256i v_Tail  = _mm256_setzero_si256();
+
+    uchar auc_Last[32];
+
+    while (p < p_End)
+    {
+        __m256i v;
+
+        if (p_End - p >= 32)
+        {
+            v  = _mm256_loadu_si256 ((const __m256i*) p);
+            p += 32;
+        }
+        else
+        {
+            std::memset (auc_Last, 0, sizeof(auc_Last));
+            std::memcpy (auc_Last, p, p_End - p);
+
+            v = _mm256_loadu_si256 ((const __m256i*) auc_Last);
+            p = p_End;
+        }
+
+        if (_mm256_movemask_epi8 (v) == 0)
+        {
+            v_Error = _mm256_or_si256 (v_Error, v_Tail);
+            v_Tail  = _mm256_setzero_si256();
+        }
+        else
+        {
+            __m256i v_Across = _mm256_permute2x128_si256 (v_Prev, v, 0x21);
+
+            __m256i v_Prev1 = _mm256_alignr_epi8 (v, v_Across, 15);
+            __m256i v_Prev2 = _mm256_alignr_epi8 (v, v_Across, 14);
+            __m256i v_Prev3 = _mm256_alignr_epi8 (v, v_Across, 13);
+
+            __m256i v_High1 = _mm256_and_si256 (
+                                  _mm256_srli_epi16 (v_Prev1, 4), v_Nibble);
+            __m256i v_Low1  = _mm256_and_si256 (v_Prev1, v_Nibble);
+            __m256i v_High2 = _mm256_and_si256 (
+                                  _mm256_srli_epi16 (v, 4), v_Nibble);
+
+            __m256i v_Flags = _mm256_and_si256 (
+                                  _mm256_and_si256 (
+                                      _mm256_shuffle_epi8 (v_Byte1High,
+                                                           v_High1),
+                                      _mm256_shuffle_epi8 (v_Byte1Low,
+                                                           v_Low1)),
+                                  _mm256_shuffle_epi8 (v_Byte2High,
+                                                       v_High2));
+
+            __m256i v_Must23 = _mm256_or_si256 (
+                                   _mm256_subs_epu8 (v_Prev2, v_Third),
+                                   _mm256_subs_epu8 (v_Prev3, v_Fourth));
+
+            v_Must23 = _mm256_and_si256 (v_Must23, v_High);
+
+            v_Error = _mm256_or_si256 (v_Error,
+                                       _mm256_xor_si256 (v_Must23, v_Flags));
+            v_Tail  = _mm256_subs_epu8 (v, v_Incomplete);
+        }
+
+        v_Prev = v;
+    }
+
+    v_Error = _mm256_or_si256 (v_Error, v_Tail);
+
+    return _mm256_testz_si256 (v_Error, v_Error) != 0;
+}
+
+#undef T
+
+#endif
+
+//+---------------------------------------------------------------------------
+//  Function:   CopyAscii and friends
+//
+//  Synopsis:   Convert the run of ASCII at p, a block at a time with the
+//              vector engines and then a character at a time, stopping at
+//              the first character that isn't ASCII
+//----------------------------------------------------------------------------
+
+static inline void CopyAscii (ByteSearchEngine engine, const uchar*& p,
+                              const uchar* p_End, uchar*& q)
+{
+    switch (engine)
+    {
+#ifdef HAVE_AVX2
+    case BYTE_SEARCH_AVX2:
+        CopyAsciiAvx2 (p, p_End, q);
+        break;
+#endif
+#ifdef HAVE_SSE2
+    case BYTE_SEARCH_SSE2:
+        CopyAsciiSse2 (p, p_End, q);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    while ((p < p_End) && (*p < 0x80))
+    {
+        *q++ = *p++;
+    }
+}
+
+static inline void WidenAscii (ByteSearchEngine engine, const uchar*& p,
+                               const uchar* p_End, uchar*& q)
+{
+    switch (engine)
+    {
+#ifdef HAVE_AVX2
+    case BYTE_SEARCH_AVX2:
+        WidenAsciiAvx2 (p, p_End, q);
+        break;
+#endif
+#ifdef HAVE_SSE2
+    case BYTE_SEARCH_SSE2:
+        WidenAsciiSse2 (p, p_End, q);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    for ( ; (p < p_End) && (*p < 0x80); q += 2)
+    {
+        q[0] = 0;
+        q[1] = *p++;
+    }
+}
+
+static inline void WidenAsciiTwice (ByteSearchEngine engine, const uchar*& p,
+                                    const uchar* p_End, uchar*& q)
+{
+    switch (engine)
+    {
+#ifdef HAVE_AVX2
+    case BYTE_SEARCH_AVX2:
+#endif
+#ifdef HAVE_SSE2
+    case BYTE_SEARCH_SSE2:
+        WidenAsciiTwiceSse2 (p, p_End, q);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    for ( ; (p < p_End) && (*p < 0x80); q += 4)
+    {
+        q[0] = 0;
+        q[1] = 0;
+        q[2] = 0;
+        q[3] = *p++;
+    }
+}
+
+static inline void NarrowUTF16 (ByteSearchEngine engine, const uchar*& p,
+                                const uchar* p_End, uchar*& q)
+{
+    switch (engine)
+    {
+#ifdef HAVE_AVX2
+    case BYTE_SEARCH_AVX2:
+        NarrowUTF16Avx2 (p, p_End, q);
+        break;
+#endif
+#ifdef HAVE_SSE2
+    case BYTE_SEARCH_SSE2:
+        NarrowUTF16Sse2 (p, p_End, q);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    for ( ; (p_End - p >= 2) && (p[0] == 0) && (p[1] < 0x80); p += 2)
+    {
+        *q++ = p[1];
+    }
+}
+
+static inline void NarrowUTF32 (ByteSearchEngine engine, const uchar*& p,
+                                const uchar* p_End, uchar*& q)
+{
+    switch (engine)
+    {
+#ifdef HAVE_AVX2
+    case BYTE_SEARCH_AVX2:
+#endif
+#ifdef HAVE_SSE2
+    case BYTE_SEARCH_SSE2:
+        NarrowUTF32Sse2 (p, p_End, q);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    for ( ; (p_End - p >= 4) && (GetUTF32 (p) < 0x80); p += 4)
+    {
+        *q++ = p[3];
+    }
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     IsValidUTF8
+//
+//  Synopsis:   Returns true if the bytes are well-formed UTF-8
+//----------------------------------------------------------------------------
+
+bool Unicode::IsValidUTF8 (const uchar* p, uintsys u_NumBytes)
+{
+    const uchar* p_End  = p + u_NumBytes;
+
+    ByteSearchEngine engine = ByteSearch::Engine();
+
+#ifdef HAVE_AVX2
+    if (engine == BYTE_SEARCH_AVX2)
+    {
+        return ValidateAvx2 (p, p_End);
+    }
+#endif
+
+    ParseError error;
+    uint32     u = 0;
+
+    while (p < p_End)
+    {
+        if (*p < 0x80)
+        {
+#ifdef HAVE_SSE2
+            if (engine == BYTE_SEARCH_SSE2)
+            {
+                SkipAsciiSse2 (p, p_End);
+            }
+#endif
+            SkipAscii (p, p_End);
+
+            while ((p < p_End) && (*p < 0x80))
+            {
+                ++p;
+            }
+
+            continue;
+        }
+
+        uintsys n = DecodeUTF8Char (p, p_End, u, error);
+
+        if (n == 0)
+        {
+            return false;
+        }
+
+        p += n;
+    }
+
+    return true;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Latin1ToUTF8
+//
+//  Synopsis:   Converts Latin-1 to UTF-8 and returns the number of bytes
+//              written
+//----------------------------------------------------------------------------
+
+uintsys Unicode::Latin1ToUTF8 (const uchar* p_In, uintsys u_NumBytes,
+                               uchar* p_Out)
+{
+    const uchar* p     = p_In;
+    const uchar* p_End = p_In + u_NumBytes;
+    uchar*       q     = p_Out;
+
+    ByteSearchEngine engine = ByteSearch::Engine();
+
+    while (p < p_End)
+    {
+        if (*p < 0x80)
+        {
+            CopyAscii (engine, p, p_End, q);
+        }
+        else
+        {
+            q[0] = (uchar) (0xC0 | (*p >> 6));
+            q[1] = (uchar) (0x80 | (*p & 0x3F));
+
+            ++p;
+            q += 2;
+        }
+    }
+
+    return q - p_Out;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     UTF16ToUTF8
+//
+//  Synopsis:   Converts big-endian UTF-16 to UTF-8 and returns the number of
+//              bytes written
+//
+//  Notes:      A surrogate that isn't half of a pair sets
+//              UnicodeSurrogate, as StringIter::ParseUTF16Char does, and an
+//              odd byte at the end sets UnexpectedEndOfData
+//----------------------------------------------------------------------------
+
+uintsys Unicode::UTF16ToUTF8 (const uchar* p_In, uintsys u_NumBytes,
+                              uchar* p_Out, ParseError& error)
+{
+    const uchar* p     = p_In;
+    const uchar* p_End = p_In + u_NumBytes;
+    uchar*       q     = p_Out;
+
+    ByteSearchEngine engine = ByteSearch::Engine();
+
+    while (p_End - p >= 2)
+    {
+        uint32 u = GetUTF16 (p);
+
+        if (u < 0x80)
+        {
+            NarrowUTF16 (engine, p, p_End, q);
+
+            continue;
+        }
+
+        if ((u & 0xF800) == 0xD800)
+        {
+            uint32 u_Low = (p_End - p >= 4) ? GetUTF16 (p + 2) : 0;
+
+            if ((u >= 0xDC00) || ((u_Low & 0xFC00) != 0xDC00))
+            {
+                error.SetUnicodeSurrogate();
+
+                return q - p_Out;
+            }
+
+            u  = (((u & 0x3FF) << 10) | (u_Low & 0x3FF)) + 0x10000;
+            p += 2;
+        }
+
+        p += 2;
+
+        PutUTF8 (u, q);
+    }
+
+    if (p != p_End)
+    {
+        error.SetUnexpectedEndOfData();
+    }
+
+    return q - p_Out;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     UTF32ToUTF8
+//
+//  Synopsis:   Converts big-endian UTF-32 to UTF-8 and returns the number of
+//              bytes written
+//----------------------------------------------------------------------------
+
+uintsys Unicode::UTF32ToUTF8 (const uchar* p_In, uintsys u_NumBytes,
+                              uchar* p_Out, ParseError& error)
+{
+    const uchar* p     = p_In;
+    const uchar* p_End = p_In + u_NumBytes;
+    uchar*       q     = p_Out;
+
+    ByteSearchEngine engine = ByteSearch::Engine();
+
+    while (p_End - p >= 4)
+    {
+        uint32 u = GetUTF32 (p);
+
+        if (u < 0x80)
+        {
+            NarrowUTF32 (engine, p, p_End, q);
+
+            continue;
+        }
+
+        if (u > MAX_UNICODE_CODE_POINT)
+        {
+            error.SetResultOutOfRange();
+
+            return q - p_Out;
+        }
+
+        if ((u & 0xFFFFF800) == 0xD800)
+        {
+            error.SetUnicodeSurrogate();
+
+            return q - p_Out;
+        }
+
+        p += 4;
+
+        PutUTF8 (u, q);
+    }
+
+    if (p != p_End)
+    {
+        error.SetUnexpectedEndOfData();
+    }
+
+    return q - p_Out;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     UTF8ToUTF16
+//
+//  Synopsis:   Converts UTF-8 to big-endian UTF-16 and returns the number of
+//              bytes written
+//----------------------------------------------------------------------------
+
+uintsys Unicode::UTF8ToUTF16 (const uchar* p_In, uintsys u_NumBytes,
+                              uchar* p_Out, ParseError& error)
+{
+    const uchar* p     = p_In;
+    const uchar* p_End = p_In + u_NumBytes;
+    uchar*       q     = p_Out;
+
+    ByteSearchEngine engine = ByteSearch::Engine();
+
+    bool b_Valid = false;
+
+#ifdef HAVE_AVX2
+    if (engine == BYTE_SEARCH_AVX2)
+    {
+        b_Valid = ValidateAvx2 (p, p_End);
+    }
+#endif
+
+    while (p < p_End)
+    {
+        if (*p < 0x80)
+        {
+            WidenAscii (engine, p, p_End, q);
+
+            continue;
+        }
+
+        uint32  u = 0;
+        uintsys n = b_Valid ? DecodeValidUTF8Char (p, u)
+                            : DecodeUTF8Char (p, p_End, u, error);
+
+        if (n == 0)
+        {
+            break;
+        }
+
+        p += n;
+
+        PutUTF16 (u, q);
+    }
+
+    return q - p_Out;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     UTF8ToUTF32
+//
+//  Synopsis:   Converts UTF-8 to big-endian UTF-32 and returns the number of
+//              bytes written
+//----------------------------------------------------------------------------
+
+uintsys Unicode::UTF8ToUTF32 (const uchar* p_In, uintsys u_NumBytes,
+                              uchar* p_Out, ParseError& error)
+{
+    const uchar* p     = p_In;
+    const uchar* p_End = p_In + u_NumBytes;
+    uchar*       q     = p_Out;
+
+    ByteSearchEngine engine = ByteSearch::Engine();
+
+    bool b_Valid = false;
+
+#ifdef HAVE_AVX2
+    if (engine == BYTE_SEARCH_AVX2)
+    {
+        b_Valid = ValidateAvx2 (p, p_End);
+    }
+#endif
+
+    while (p < p_End)
+    {
+        if (*p < 0x80)
+        {
+            WidenAsciiTwice (engine, p, p_End, q);
+
+            continue;
+        }
+
+        uint32  u = 0;
+        uintsys n = b_Valid ? DecodeValidUTF8Char (p, u)
+                            : DecodeUTF8Char (p, p_End, u, error);
+
+        if (n == 0)
+        {
+            break;
+        }
+
+        p += n;
+
+        PutUTF32 (u, q);
+    }
+
+    return q - p_Out;
+}
+
+} // namespace mikestoolbox
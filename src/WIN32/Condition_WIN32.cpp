@@ -0,0 +1,99 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       WIN32/Condition_WIN32.cpp
+//
+//  Synopsis:   Windows implementation of Condition class
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+#ifdef PLATFORM_WINDOWS
+
+#ifndef SINGLE_THREADED
+
+namespace mikestoolbox {
+
+//+---------------------------------------------------------------------------
+//  Method:     Block_
+//
+//  Synopsis:   Sleeps on the semaphore until woken or the time runs out.
+//              Returns false on timeout.
+//
+//  Notes:      The semaphore counts, so a wakeup released before we start
+//              waiting is not lost.  A stale count only causes a spurious
+//              wakeup, which the callers already handle.
+//----------------------------------------------------------------------------
+
+bool Condition::Block_ (uint32 u_Sequence, double d_Seconds)
+{
+    if (d_Seconds == 0.0)
+    {
+        return false;
+    }
+
+    if (u_Sequence_.Load() != u_Sequence)
+    {
+        return true;
+    }
+
+    DWORD dw_Milliseconds = INFINITE;
+
+    if (d_Seconds > 0.0)
+    {
+        dw_Milliseconds = (DWORD) (d_Seconds * 1000 + 0.5);
+    }
+
+    return WaitForSingleObject (h_Semaphore_, dw_Milliseconds) != WAIT_TIMEOUT;
+}
+
+void Condition::Wake_ (bool b_All)
+{
+    LONG n_Count = b_All ? (LONG) Maximum (u_Waiters_.Load(), 1U) : 1;
+
+    ReleaseSemaphore (h_Semaphore_, n_Count, 0);
+}
+
+} // namespace mikestoolbox
+
+#endif // SINGLE_THREADED
+
+#endif // PLATFORM_WINDOWS
@@ -0,0 +1,93 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       WIN32/FileReader_WIN32.cpp
+//
+//  Synopsis:   Windows implementation of the FileReader class
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+#ifdef PLATFORM_WINDOWS
+
+namespace mikestoolbox {
+
+FileReader::FileReader (const String& str_Name)
+    : str_Name_     (str_Name)
+    , h_File_       (INVALID_HANDLE_VALUE)
+    , u_BytesRead_  (0)
+    , b_IsOpen_     (false)
+    , b_AtEnd_      (false)
+{
+    b_IsOpen_ = Open_();
+}
+
+bool FileReader::Open_ ()
+{
+    h_File_ = CreateFile (str_Name_, GENERIC_READ, FILE_SHARE_READ, 0,
+                          OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0);
+
+    return (h_File_ != INVALID_HANDLE_VALUE);
+}
+
+intsys FileReader::Read_ (uchar* p_Buffer, uintsys u_MaxBytes)
+{
+    DWORD dw_Chunk = (DWORD) Minimum (u_MaxBytes, (uintsys)0x40000000);
+    DWORD dw_Read  = 0;
+
+    if (!ReadFile (h_File_, p_Buffer, dw_Chunk, &dw_Read, 0))
+    {
+        return -1;
+    }
+
+    return (intsys) dw_Read;
+}
+
+void FileReader::Close_ ()
+{
+    CloseHandle (h_File_);
+
+    h_File_ = INVALID_HANDLE_VALUE;
+}
+
+} // namespace mikestoolbox
+
+#endif // PLATFORM_WINDOWS
@@ -0,0 +1,124 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       WIN32/FileWriter_WIN32.cpp
+//
+//  Synopsis:   Windows implementation of the FileWriter class
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+
+#ifdef PLATFORM_WINDOWS
+
+namespace mikestoolbox {
+
+FileWriter::FileWriter (const String& str_Name, int n_Flags)
+    : str_Name_         (str_Name)
+    , h_File_           (INVALID_HANDLE_VALUE)
+    , mutex_Buffer_     ()
+    , mutex_Write_      ()
+    , mutex_Sync_       ()
+    , str_Buffer_       ()
+    , str_Pending_      ()
+    , u_BufferSize_     (FILE_WRITER_BUFFER_SIZE)
+    , d_FlushInterval_  (FILE_WRITER_FLUSH_INTERVAL)
+    , d_BufferAge_      (0.0)
+    , timer_BufferAge_  ()
+    , u_BytesAppended_  (0)
+    , u_BytesWritten_   (0)
+    , u_BytesSynced_    (0)
+    , b_IsOpen_         (false)
+{
+    b_IsOpen_ = Open_ (n_Flags);
+}
+
+bool FileWriter::Open_ (int n_Flags)
+{
+    DWORD dw_CreateOptions = (n_Flags & FILE_CREATE_OK) ? OPEN_ALWAYS
+                                                        : OPEN_EXISTING;
+
+    h_File_ = CreateFile (str_Name_, FILE_APPEND_DATA, FILE_SHARE_READ, 0,
+                          dw_CreateOptions, FILE_ATTRIBUTE_NORMAL, 0);
+
+    return (h_File_ != INVALID_HANDLE_VALUE);
+}
+
+bool FileWriter::Write_ (const String& str_Contents, uintsys& u_Written)
+{
+    const char* ps_Contents    = str_Contents.C();
+    uintsys     u_NeedToWrite  = str_Contents.Length();
+
+    u_Written = 0;
+
+    while (u_NeedToWrite > 0)
+    {
+        DWORD dw_Chunk   = (DWORD) Minimum (u_NeedToWrite, (uintsys)0x40000000);
+        DWORD dw_Written = 0;
+
+        if (!WriteFile (h_File_, ps_Contents, dw_Chunk, &dw_Written, 0) ||
+            (dw_Written == 0))
+        {
+            return false;
+        }
+
+        ps_Contents   += dw_Written;
+        u_NeedToWrite -= dw_Written;
+        u_Written     += dw_Written;
+    }
+
+    return true;
+}
+
+bool FileWriter::Sync_ ()
+{
+    return FlushFileBuffers (h_File_) ? true : false;
+}
+
+void FileWriter::Close_ ()
+{
+    CloseHandle (h_File_);
+
+    h_File_ = INVALID_HANDLE_VALUE;
+}
+
+} // namespace mikestoolbox
+
+#endif // PLATFORM_WINDOWS
@@ -462,8 +462,93 @@ bool File::Read (String& str_Contents) const
     return (dw_NeedToRead == 0);
 }
 
+//+---------------------------------------------------------------------------
+//  Function:   ReplaceFileAtomically
+//
+//  Synopsis:   Writes the contents to a temporary file next to the original,
+//              flushes it to disk, and moves it over the original
+//----------------------------------------------------------------------------
+
+static bool ReplaceFileAtomically (const WindowsString& str_Name,
+                                   const String& str_Contents,
+                                   int n_Flags)
+{
+    WIN32_FILE_ATTRIBUTE_DATA wfad;
+
+    bool b_Exists = GetFileAttributesEx (str_Name, GetFileExInfoStandard,
+                                         &wfad) ? true : false;
+
+    if (b_Exists ? !(n_Flags & FILE_REPLACE_EXISTING)
+                 : !(n_Flags & FILE_CREATE_OK))
+    {
+        return false;
+    }
+
+    String str_TempName (str_Name.UTF8());
+
+    str_TempName.Append (".tmp");
+    str_TempName.Append ((uint32) GetCurrentThreadId());
+
+    WindowsString str_Temp (str_TempName);
+
+    HANDLE handle = CreateFile (str_Temp, GENERIC_WRITE, 0, 0, CREATE_NEW,
+                                FILE_ATTRIBUTE_NORMAL, 0);
+
+    if (handle == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    const char* ps_Contents    = str_Contents.C();
+    DWORD       dw_NeedToWrite = str_Contents.Length();
+    DWORD       dw_Written     = 0;
+
+    while ((dw_NeedToWrite > 0) &&
+           WriteFile (handle, (const void*) ps_Contents, dw_NeedToWrite,
+                      &dw_Written, 0))
+    {
+        ps_Contents    += dw_Written;
+        dw_NeedToWrite -= dw_Written;
+    }
+
+    bool b_Success = (dw_NeedToWrite == 0) && FlushFileBuffers (handle);
+
+    CloseHandle (handle);
+
+    DWORD dw_Flags = MOVEFILE_WRITE_THROUGH;
+
+    if (b_Exists)
+    {
+        dw_Flags |= MOVEFILE_REPLACE_EXISTING;
+    }
+
+    if (b_Success && MoveFileEx (str_Temp, str_Name, dw_Flags))
+    {
+        return true;
+    }
+
+    DeleteFile (str_Temp);
+
+    return false;
+}
+
+bool File::Append (const StringList& strl_Lines, int n_Flags)
+{
+    return Append (strl_Lines.Join(), n_Flags);
+}
+
+bool File::Write (const StringList& strl_Lines, int n_Flags)
+{
+    return Write (strl_Lines.Join(), n_Flags);
+}
+
 bool File::Write (const String& str_Contents, int n_Flags)
 {
+    if (n_Flags & FILE_ATOMIC_REPLACE)
+    {
+        return ReplaceFileAtomically (str_Name_, str_Contents, n_Flags);
+    }
+
     DWORD dw_CreateOptions;
 
     if (n_Flags & FILE_CREATE_OK)
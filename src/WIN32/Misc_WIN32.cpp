@@ -49,6 +49,42 @@ void millisleep (uintsys u_Milliseconds)
     Sleep ((DWORD) u_Milliseconds);
 }
 
+uintsys NumProcessors ()
+{
+    SYSTEM_INFO info;
+
+    GetSystemInfo (&info);
+
+    return (info.dwNumberOfProcessors > 0) ? info.dwNumberOfProcessors : 1;
+}
+
+uintsys NumNumaNodes ()
+{
+    ULONG ul_Highest = 0;
+
+    return GetNumaHighestNodeNumber (&ul_Highest) ? ul_Highest + 1 : 1;
+}
+
+List<uintsys> NumaNodeProcessors (uintsys u_Node)
+{
+    List<uintsys> list_Processors;
+    ULONGLONG     ull_Mask = 0;
+
+    if ((u_Node <= 0xFF) && GetNumaNodeProcessorMask ((UCHAR) u_Node,
+                                                      &ull_Mask))
+    {
+        for (uintsys u = 0; u < 64; ++u)
+        {
+            if (ull_Mask & (ULONGLONG (1) << u))
+            {
+                list_Processors.Append (u);
+            }
+        }
+    }
+
+    return list_Processors;
+}
+
 } // namespace mikestoolbox
 
 #endif // PLATFORM_WINDOWS
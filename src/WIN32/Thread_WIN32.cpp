@@ -57,15 +57,43 @@ uintsys getThreadId()
     return (uintsys) GetCurrentThreadId();
 }
 
+void Thread::Create_ (uintsys u_StackSize)
+{
+    if (u_StackSize == 0)
+    {
+        u_StackSize = u_DefaultStackSize_;
+    }
+
+    h_Thread_ = CreateThread (0, (SIZE_T) u_StackSize, Thread::ThreadMain_,
+                              (void*)this, 0, &dw_ThreadId_);
+
+    if (h_Thread_ == 0)
+    {
+        throw Exception ("Thread: Failed to create thread");
+    }
+}
+
+void Thread::ApplySettings_ ()
+{
+    ApplyPriority_();
+}
+
+void Thread::ApplyPriority_ ()
+{
+    SetThreadPriority (h_Thread_, (int) n_Priority_);
+}
+
 DWORD WINAPI Thread::ThreadMain_ (void* p_Thread)
 {
     Thread* p_This = (Thread*) p_Thread;
 
     try
     {
+        p_This->n_SystemId_.Store ((intsys) GetCurrentThreadId());
+
         p_This->cond_Startup_.Wait();
 
-        SetThreadPriority (GetCurrentThread(), p_This->n_Priority_);
+        p_This->ApplySettings_();
 
         p_This->date_Start_ = Date();
         p_This->date_Stop_  = p_This->date_Start_;
@@ -101,6 +129,12 @@ DWORD WINAPI Thread::ThreadMain_ (void* p_Thread)
     p_This->date_Stop_ = Date();
     p_This->b_Running_ = false;
 
+    p_This->n_SystemId_.Store (0);
+
+    Exited_ (p_This);                  // the owner may delete p_This now
+
+    MemoryCache::ThreadExit();
+
     //OpenSSL: ERR_remove_state (0);
 
     ExitThread (0);
@@ -109,6 +143,8 @@ DWORD WINAPI Thread::ThreadMain_ (void* p_Thread)
 Thread::~Thread ()
 {
     CloseHandle (h_Thread_);
+
+    delete p_Result_;
 }
 
 void Thread::Suspend ()
@@ -135,7 +171,7 @@ void Thread::SetPriority (intsys n_Priority)
 
             if (b_Running_)
             {
-                SetThreadPriority (h_Thread_, n_Priority_);
+                ApplyPriority_();
             }
 
             break;
@@ -143,6 +179,124 @@ void Thread::SetPriority (intsys n_Priority)
     }
 }
 
+//+---------------------------------------------------------------------------
+//  Method:     SetPolicy
+//
+//  Synopsis:   Windows has no scheduling policies, so each is mapped to the
+//              nearest thread priority.  n_Priority is ignored.
+//----------------------------------------------------------------------------
+
+bool Thread::SetPolicy (ThreadPolicy policy, intsys)
+{
+    int n_Priority = THREAD_PRIORITY_NORMAL;
+
+    switch (policy)
+    {
+        case THREAD_POLICY_NORMAL:
+            n_Priority = THREAD_PRIORITY_NORMAL;
+            break;
+
+        case THREAD_POLICY_BATCH:
+            n_Priority = THREAD_PRIORITY_BELOW_NORMAL;
+            break;
+
+        case THREAD_POLICY_IDLE:
+            n_Priority = THREAD_PRIORITY_IDLE;
+            break;
+
+        case THREAD_POLICY_FIFO:
+        case THREAD_POLICY_ROUND_ROBIN:
+            n_Priority = THREAD_PRIORITY_TIME_CRITICAL;
+            break;
+
+        default:
+            return false;
+    }
+
+    return (SetThreadPriority (h_Thread_, n_Priority) != 0);
+}
+
+bool Thread::SetAffinity (const List<uintsys>& list_Processors)
+{
+    DWORD_PTR dw_Mask = 0;
+
+    for (ListIter<uintsys> iter (list_Processors); iter; ++iter)
+    {
+        if (*iter >= 8 * sizeof(DWORD_PTR))
+        {
+            return false;
+        }
+
+        dw_Mask |= DWORD_PTR (1) << *iter;
+    }
+
+    return (dw_Mask != 0) && (SetThreadAffinityMask (h_Thread_, dw_Mask) != 0);
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     Affinity
+//
+//  Synopsis:   Windows can only read a thread's mask by replacing it, so
+//              the old mask is put straight back
+//----------------------------------------------------------------------------
+
+List<uintsys> Thread::Affinity () const
+{
+    List<uintsys> list_Processors;
+    DWORD_PTR     dw_Process = 0;
+    DWORD_PTR     dw_System  = 0;
+
+    if (GetProcessAffinityMask (GetCurrentProcess(), &dw_Process, &dw_System))
+    {
+        DWORD_PTR dw_Mask = SetThreadAffinityMask (h_Thread_, dw_Process);
+
+        if (dw_Mask != 0)
+        {
+            SetThreadAffinityMask (h_Thread_, dw_Mask);
+        }
+
+        for (uintsys u = 0; u < 8 * sizeof(DWORD_PTR); ++u)
+        {
+            if (dw_Mask & (DWORD_PTR (1) << u))
+            {
+                list_Processors.Append (u);
+            }
+        }
+    }
+
+    return list_Processors;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     SetNumaNode
+//
+//  Synopsis:   Windows allocates from the node a thread runs on, so running
+//              on the node's processors is enough
+//----------------------------------------------------------------------------
+
+bool Thread::SetNumaNode (uintsys u_Node)
+{
+    if (!SetAffinity (NumaNodeProcessors (u_Node)))
+    {
+        return false;
+    }
+
+    n_NumaNode_ = (intsys) u_Node;
+
+    return true;
+}
+
+//+---------------------------------------------------------------------------
+//  Method:     SetName
+//
+//  Synopsis:   Only remembered, since naming a thread needs Windows 10
+//----------------------------------------------------------------------------
+
+void Thread::SetName (const String& str_Name)
+{
+    str_Name_ = str_Name;
+}
+
 uintsys Thread::GetId () const
 {
     return (uintsys)dw_ThreadId_;
@@ -0,0 +1,227 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       AsciiCaseTest.cpp
+//
+//  Synopsis:   Test program for AsciiCase and NoCaseHash
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Test.h"
+
+using namespace mikestoolbox;
+
+static uint32 gu_Seed = 12345;
+
+static uintsys Random (uintsys u_Limit)
+{
+    gu_Seed = gu_Seed * 1103515245 + 12345;
+
+    return (gu_Seed >> 8) % u_Limit;
+}
+
+//  Mostly letters, with the bytes on either side of each range and a
+//  few from the upper half thrown in
+
+static String RandomBytes (uintsys u_Length)
+{
+    static const char ac_Edges[] = "@AZ[`az{\x80\xC1\xDA\xE1\xFA\xFF";
+
+    String str;
+
+    for (uintsys u = 0; u < u_Length; ++u)
+    {
+        switch (Random (4))
+        {
+            case 0:  str.Append (ac_Edges[Random (sizeof(ac_Edges) - 1)]);
+                     break;
+            case 1:  str.Append ((char) Random (256)); break;
+            default: str.Append ((char) ('a' + Random (26))); break;
+        }
+    }
+
+    return str;
+}
+
+static String SimpleLower (const String& str)
+{
+    String str_Result;
+
+    for (uintsys u = 0; u < str.Length(); ++u)
+    {
+        str_Result.Append ((char) ByteToLower (str.ByteAt (u)));
+    }
+
+    return str_Result;
+}
+
+static String SimpleUpper (const String& str)
+{
+    String str_Result;
+
+    for (uintsys u = 0; u < str.Length(); ++u)
+    {
+        uchar uc = str.ByteAt (u);
+
+        str_Result.Append ((char) (((uc >= 'a') && (uc <= 'z')) ? (uc - 32)
+                                                                : uc));
+    }
+
+    return str_Result;
+}
+
+static intsys SimpleCompare (const String& str1, const String& str2)
+{
+    for (uintsys u = 0; u < str1.Length(); ++u)
+    {
+        intsys n = ByteCompareNoCase (str1.ByteAt (u), str2.ByteAt (u));
+
+        if (n != 0)
+        {
+            return n;
+        }
+    }
+
+    return 0;
+}
+
+static intsys Compare (const String& str1, const String& str2)
+{
+    return AsciiCase::Compare (str1.PointerToFirstByte(),
+                               str2.PointerToFirstByte(), str1.Length());
+}
+
+static uint32 HashOf (const String& str)
+{
+    return AsciiCase::Hash (str.PointerToFirstByte(), str.Length());
+}
+
+static bool TestEngine (ByteSearchEngine engine)
+{
+    ByteSearch::SetEngine (engine);
+
+    for (uintsys u_Try = 0; u_Try < 5000; ++u_Try)
+    {
+        String str (RandomBytes (Random ((u_Try % 10) ? 80 : 300)));
+        String str_Lower (SimpleLower (str));
+        String str_Upper (SimpleUpper (str));
+        String str_InPlace (str);
+
+        str_InPlace.ToUpperCase();
+
+        bool b_Good = (str.AsLowerCase() == str_Lower) &&
+                      (str.AsUpperCase() == str_Upper) &&
+                      (str_InPlace == str_Upper) &&
+                      (str_InPlace.ToLowerCase() == str_Lower) &&
+                      (Compare (str_Lower, str_Upper) == 0) &&
+                      (HashOf (str_Lower) == HashOf (str_Upper));
+
+        // the same with one byte changed somewhere
+
+        if (b_Good && !str.IsEmpty())
+        {
+            String str_Other (str_Upper);
+
+            str_Other[Random (str.Length())] = (char) Random (256);
+
+            b_Good = (Compare (str, str_Other) ==
+                      SimpleCompare (str, str_Other)) &&
+                     (Compare (str_Other, str) ==
+                      SimpleCompare (str_Other, str));
+        }
+
+        if (!b_Good)
+        {
+            std::cout << ByteSearch::EngineName (engine) << ": \""
+                      << str.Hex() << "\"" << std::endl;
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main (int, char** argv)
+{
+    Tester check (argv[0]);
+
+    String str_Name ("Content-Type: TEXT/html; charset=UTF-8 \xC9");
+
+    check (str_Name.AsLowerCase() ==
+           "content-type: text/html; charset=utf-8 \xC9");
+    check (str_Name.AsUpperCase() ==
+           "CONTENT-TYPE: TEXT/HTML; CHARSET=UTF-8 \xC9");
+    check (str_Name.Segment (0, 12).AsUpperCase() == "CONTENT-TYPE");
+
+    String str_Shared (str_Name);
+
+    str_Shared.ToLowerCase();
+
+    check (str_Shared == "content-type: text/html; charset=utf-8 \xC9");
+    check (str_Name   == "Content-Type: TEXT/html; charset=UTF-8 \xC9");
+
+    check (String ("abc").Compare ("ABD", false) < 0);
+    check (String ("ABD").Compare ("abc", false) > 0);
+    check (String ("[").Compare ("a", false) < 0);
+    check (String ("_").Compare ("A", false) < 0);
+
+    Hash<String,int,NoCaseHash> hash_Headers;
+
+    hash_Headers["Content-Type"]   = 1;
+    hash_Headers["content-LENGTH"] = 2;
+    hash_Headers["CONTENT-TYPE"]   = 3;
+
+    check (hash_Headers.NumItems() == 2);
+    check (hash_Headers.Get ("content-type") == 3);
+    check (hash_Headers.Get ("Content-Length") == 2);
+    check (!hash_Headers.Exists ("Content-Typf"));
+
+    check (TestEngine (BYTE_SEARCH_SCALAR));
+    check (TestEngine (BYTE_SEARCH_SSE2));
+    check (TestEngine (BYTE_SEARCH_AVX2));
+
+    ByteSearch::SetEngine (BYTE_SEARCH_UNKNOWN);
+
+    check.Done();
+
+    return 0;
+}
@@ -0,0 +1,341 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       Base64Test.cpp
+//
+//  Synopsis:   Test program for Base64 and its streaming encoder and
+//              decoder, checking every engine against a simple codec and
+//              the strict decoder's error reporting
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Test.h"
+
+using namespace mikestoolbox;
+
+static uint32 gu_Seed = 12345;
+
+static uintsys Random (uintsys u_Limit)
+{
+    gu_Seed = gu_Seed * 1103515245 + 12345;
+
+    return (gu_Seed >> 8) % u_Limit;
+}
+
+static String RandomBytes (uintsys u_Length)
+{
+    String str;
+
+    for (uintsys u = 0; u < u_Length; ++u)
+    {
+        str.Append ((char) Random (256));
+    }
+
+    return str;
+}
+
+static String SimpleEncode (const String& str)
+{
+    String str_Result;
+
+    uintsys u_Length = str.Length();
+
+    for (uintsys u = 0; u < u_Length; u += 3)
+    {
+        uintsys u_Bits  = 0;
+        uintsys u_Bytes = Minimum (u_Length - u, (uintsys) 3);
+
+        for (uintsys v = 0; v < 3; ++v)
+        {
+            u_Bits = (u_Bits << 8) | ((v < u_Bytes) ? str.ByteAt (u+v) : 0);
+        }
+
+        for (uintsys v = 0; v < 4; ++v)
+        {
+            str_Result.Append ((v <= u_Bytes)
+                               ? gpz_Base64[(u_Bits >> (18 - 6*v)) & 63]
+                               : '=');
+        }
+    }
+
+    return str_Result;
+}
+
+static String SimpleDecode (const String& str)
+{
+    String str_Result;
+
+    uintsys u_Bits  = 0;
+    uintsys u_Count = 0;
+
+    for (uintsys u = 0; u < str.Length(); ++u)
+    {
+        const char* pz = std::strchr (gpz_Base64, str.ByteAt (u));
+
+        if ((pz == 0) || (*pz == 0))
+        {
+            continue;
+        }
+
+        u_Bits = (u_Bits << 6) | (pz - gpz_Base64);
+
+        if (++u_Count % 4 == 0)
+        {
+            str_Result.AppendUint24 (u_Bits & 0xFFFFFF);
+        }
+    }
+
+    if (u_Count % 4 == 2)
+    {
+        str_Result.AppendUint8 ((u_Bits >> 4) & 0xFF);
+    }
+    else if (u_Count % 4 == 3)
+    {
+        str_Result.AppendUint16 ((u_Bits >> 2) & 0xFFFF);
+    }
+
+    return str_Result;
+}
+
+static String StreamEncode (const String& str, uintsys u_LineLength,
+                           const char* pz_EOL)
+{
+    Base64Encoder encoder (u_LineLength, pz_EOL);
+
+    String str_Result;
+
+    for (uintsys u = 0; u < str.Length(); )
+    {
+        uintsys u_Chunk = Random (u % 2 ? 4 : 300);
+
+        str_Result += encoder.Update (str.Segment (u, u_Chunk));
+
+        u += u_Chunk;
+    }
+
+    return str_Result + encoder.Finish();
+}
+
+static String StreamDecode (const String& str, ParseError* p_Error)
+{
+    ParseError error_Unused;
+
+    Base64Decoder decoder;
+    Base64Decoder decoder_Strict (p_Error ? *p_Error : error_Unused);
+
+    Base64Decoder& d = p_Error ? decoder_Strict : decoder;
+
+    String str_Result;
+
+    for (uintsys u = 0; u < str.Length(); )
+    {
+        uintsys u_Chunk = Random (u % 2 ? 5 : 300);
+
+        str_Result += d.Update (str.Segment (u, u_Chunk));
+
+        u += u_Chunk;
+    }
+
+    return str_Result + d.Finish();
+}
+
+static bool StrictError (const char* pz, uintsys u_Errors)
+{
+    ParseError error;
+    ParseError error_Stream;
+
+    String str_Result (String (pz).Base64Decode (error));
+    String str_Stream (StreamDecode (pz, &error_Stream));
+
+    return (error.GetErrors() == u_Errors) &&
+           (error_Stream.GetErrors() == u_Errors) &&
+           (str_Result.IsEmpty() == (u_Errors != 0)) &&
+           ((u_Errors != 0) || (str_Stream == str_Result));
+}
+
+static bool TestEngine (ByteSearchEngine engine)
+{
+    ByteSearch::SetEngine (engine);
+
+    for (uintsys u_Try = 0; u_Try < 2000; ++u_Try)
+    {
+        String str (RandomBytes (Random ((u_Try % 10) ? 200 : 5000)));
+        String str_Encoded (str.Base64Encode());
+
+        if (str_Encoded != SimpleEncode (str))
+        {
+            std::cout << ByteSearch::EngineName (engine)
+                      << ": encoding " << str.Length() << " bytes"
+                      << std::endl;
+
+            return false;
+        }
+
+        ParseError error;
+
+        if ((str_Encoded.Base64Decode() != str) ||
+            (str_Encoded.Base64Decode (error) != str) || !error)
+        {
+            std::cout << ByteSearch::EngineName (engine)
+                      << ": decoding \"" << str_Encoded << "\"" << std::endl;
+
+            return false;
+        }
+
+        // the same fed a few bytes or characters at a time
+
+        uintsys u_LineLength = 4 * Random (30);
+
+        ParseError error_Stream;
+
+        if ((StreamEncode (str, MAX_UINTSYS, "") != str_Encoded) ||
+            (StreamEncode (str, u_LineLength, "\r\n") !=
+             str.Base64Encode (u_LineLength, "\r\n")) ||
+            (StreamDecode (str.Base64Encode (u_LineLength), 0) != str) ||
+            (StreamDecode (str_Encoded, &error_Stream) != str) ||
+            !error_Stream)
+        {
+            std::cout << ByteSearch::EngineName (engine)
+                      << ": streaming " << str.Length() << " bytes"
+                      << std::endl;
+
+            return false;
+        }
+
+        // line breaks and other junk in random places
+
+        String str_Noisy (str.Base64Encode (4 * (1 + Random (30)), "\r\n"));
+
+        for (uintsys u = Random (5); u != 0; --u)
+        {
+            str_Noisy.Insert (" =\t\xC3"[Random(4)],
+                              Random (str_Noisy.Length()));
+        }
+
+        if ((str_Noisy.Base64Decode() != SimpleDecode (str_Noisy)) ||
+            (StreamDecode (str_Noisy, 0) != SimpleDecode (str_Noisy)))
+        {
+            std::cout << ByteSearch::EngineName (engine)
+                      << ": decoding \"" << str_Noisy << "\"" << std::endl;
+
+            return false;
+        }
+    }
+
+    // every byte value in every position of a vector block
+
+    String str_Block (RandomBytes (72).Base64Encode());
+
+    for (uintsys u_Offset = 0; u_Offset < 64; ++u_Offset)
+    {
+        for (uintsys u_Byte = 0; u_Byte < 256; ++u_Byte)
+        {
+            String str (str_Block);
+
+            str.ByteAt (u_Offset) = (uchar) u_Byte;
+
+            if (str.Base64Decode() != SimpleDecode (str))
+            {
+                std::cout << ByteSearch::EngineName (engine)
+                          << ": byte " << u_Byte << " at " << u_Offset
+                          << std::endl;
+
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+int main (int, char** argv)
+{
+    Tester check (argv[0]);
+
+    check (String("").Base64Encode()       == "");
+    check (String("f").Base64Encode()      == "Zg==");
+    check (String("fo").Base64Encode()     == "Zm8=");
+    check (String("foo").Base64Encode()    == "Zm9v");
+    check (String("foob").Base64Encode()   == "Zm9vYg==");
+    check (String("fooba").Base64Encode()  == "Zm9vYmE=");
+    check (String("foobar").Base64Encode() == "Zm9vYmFy");
+
+    check (String("Zm9vYmFy").Base64Decode() == "foobar");
+    check (String("Zm9vYmE").Base64Decode()  == "fooba");
+    check (String("Zm9vYg").Base64Decode()   == "foob");
+    check (String("Zm9vY").Base64Decode()    == "foo");
+    check (String("Zm9v YmFy\n").Base64Decode() == "foobar");
+
+    // lines are rounded down to whole groups, and end with the EOL
+
+    String str_Text ("The quick brown fox jumps over the lazy dog");
+
+    check (String("").Base64Encode (76) == "\n");
+    check (str_Text.Base64Encode (10, "\r\n") ==
+           "VGhlIHF1\r\naWNrIGJy\r\nb3duIGZv\r\neCBqdW1w\r\n"
+           "cyBvdmVy\r\nIHRoZSBs\r\nYXp5IGRv\r\nZw==\r\n");
+    check (str_Text.Base64Encode (0) == str_Text.Base64Encode (76));
+    check (String ('x', Repeat(57)).Base64Encode (76).Length() == 77);
+
+    check (StrictError ("Zm9vYmFy\r\nZm9v\n",  0));
+    check (StrictError ("Zm9vYg==",            0));
+    check (StrictError ("Zm9vYmE=\n",          0));
+    check (StrictError ("Zm9vY\nm\nE=",        0));
+    check (StrictError ("Zm9vYmE",   ParseErrorUnexpectedEndOfData));
+    check (StrictError ("Zm9vYg=",   ParseErrorUnexpectedEndOfData));
+    check (StrictError ("Zm9vY",     ParseErrorUnexpectedEndOfData));
+    check (StrictError ("Zm9v Ym",   ParseErrorIllegalByteSequence));
+    check (StrictError ("Zm9vY===",  ParseErrorIllegalByteSequence));
+    check (StrictError ("Zm9vYh==",  ParseErrorIllegalByteSequence));
+    check (StrictError ("Zm9vYmF=",  ParseErrorIllegalByteSequence));
+    check (StrictError ("Zg==Zg==",  ParseErrorIllegalByteSequence));
+    check (StrictError ("Zm9v=",     ParseErrorIllegalByteSequence));
+
+    check (TestEngine (BYTE_SEARCH_SCALAR));
+    check (TestEngine (BYTE_SEARCH_SSE2));
+    check (TestEngine (BYTE_SEARCH_AVX2));
+
+    ByteSearch::SetEngine (BYTE_SEARCH_UNKNOWN);
+
+    check.Done();
+
+    return 0;
+}
@@ -0,0 +1,221 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       ByteSearchTest.cpp
+//
+//  Synopsis:   Test program for ByteSearch, checking every engine against
+//              a simple search on random haystacks and needles
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Test.h"
+
+using namespace mikestoolbox;
+
+static uint32 gu_Seed = 12345;
+
+static uintsys Random (uintsys u_Limit)
+{
+    gu_Seed = gu_Seed * 1103515245 + 12345;
+
+    return (gu_Seed >> 8) % u_Limit;
+}
+
+static String RandomString (uintsys u_Length)
+{
+    const char* pz_Alphabet = "aAbB-";
+
+    String str;
+
+    for (uintsys u = 0; u < u_Length; ++u)
+    {
+        str.Append (pz_Alphabet[Random(5)]);
+    }
+
+    return str;
+}
+
+static intsys SimpleFind (const String& str_Haystack,
+                          const String& str_Needle, bool b_Case, bool b_Last)
+{
+    uintsys u_Length = str_Haystack.Length();
+    uintsys u_Needle = str_Needle.Length();
+
+    if (u_Needle > u_Length)
+    {
+        return -1;
+    }
+
+    intsys n_Found = -1;
+
+    for (uintsys u = 0; u + u_Needle <= u_Length; ++u)
+    {
+        if (StringCompare (str_Haystack.C() + u, str_Needle.C(), u_Needle,
+                           b_Case) == 0)
+        {
+            n_Found = u;
+
+            if (!b_Last)
+            {
+                break;
+            }
+        }
+    }
+
+    return n_Found;
+}
+
+static intsys EngineFind (const String& str_Haystack,
+                          const String& str_Needle, bool b_Case, bool b_Last)
+{
+    const uchar* p_Haystack = str_Haystack.PointerToFirstByte();
+
+    const uchar* p = b_Last
+        ? ByteSearch::FindLast (p_Haystack, str_Haystack.Length(),
+                                str_Needle.PointerToFirstByte(),
+                                str_Needle.Length(), b_Case)
+        : ByteSearch::Find     (p_Haystack, str_Haystack.Length(),
+                                str_Needle.PointerToFirstByte(),
+                                str_Needle.Length(), b_Case);
+
+    return p ? (p - p_Haystack) : -1;
+}
+
+static bool TestEngine (ByteSearchEngine engine)
+{
+    ByteSearch::SetEngine (engine);
+
+    for (uintsys u_Try = 0; u_Try < 3000; ++u_Try)
+    {
+        String str_Haystack (RandomString (Random (300)));
+        String str_Needle   (RandomString (1 + Random (u_Try % 2 ? 5 : 90)));
+
+        if (!str_Haystack.IsEmpty() && (Random(2) == 0))
+        {
+            uintsys u_Start = Random (str_Haystack.Length());
+
+            str_Needle = str_Haystack.Segment (u_Start, str_Needle.Length());
+
+            if (str_Needle.IsEmpty())
+            {
+                continue;
+            }
+        }
+
+        for (int n = 0; n < 4; ++n)
+        {
+            bool b_Case = (n & 1);
+            bool b_Last = (n & 2);
+
+            if (SimpleFind (str_Haystack, str_Needle, b_Case, b_Last) !=
+                EngineFind (str_Haystack, str_Needle, b_Case, b_Last))
+            {
+                std::cout << ByteSearch::EngineName (engine) << ": \""
+                          << str_Needle << "\" in \"" << str_Haystack
+                          << "\"" << std::endl;
+
+                return false;
+            }
+        }
+    }
+
+    // repetitive input makes the long needle switch to Horspool
+
+    String str_Haystack ('a', Repeat(5000));
+    String str_Needle   ('a', Repeat(100));
+
+    str_Needle += 'b';
+
+    for (int n = 0; n < 2; ++n)
+    {
+        bool b_Last = (n == 1);
+
+        if ((EngineFind (str_Haystack, str_Needle, true, b_Last) != -1) ||
+            (EngineFind (str_Haystack + "b", str_Needle, true, b_Last) !=
+             4900) ||
+            (EngineFind (str_Haystack + "B", str_Needle, false, b_Last) !=
+             4900))
+        {
+            return false;
+        }
+    }
+
+    str_Needle = "B" + String ('A', Repeat(100));
+
+    if ((EngineFind ("b" + str_Haystack, str_Needle, false, true) != 0) ||
+        (EngineFind ("b" + str_Haystack, str_Needle, true, true) != -1))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+int main (int, char** argv)
+{
+    Tester check (argv[0]);
+
+    check (TestEngine (BYTE_SEARCH_SCALAR));
+    check (TestEngine (BYTE_SEARCH_SSE2));
+    check (TestEngine (BYTE_SEARCH_AVX2));
+
+    ByteSearch::SetEngine (BYTE_SEARCH_UNKNOWN);
+
+    check (ByteSearch::Engine() == ByteSearch::BestEngine());
+
+    String str ("The quick brown fox jumps over the lazy dog");
+
+    check (str.FindFirst ("THE", 0, false).Offset() == 0);
+    check (str.FindFirst ("THE", 1, false).Offset() == 31);
+    check (str.FindLast  ("the").Offset() == 31);
+    check (!str.FindLast ("the", 30));
+    check (str.FindLast  ("The", 30).Offset() == 0);
+    check (str.FindLast  ('o').Offset() == 41);
+    check (str.FindLast  ('O', 40, false).Offset() == 26);
+    check (str.FindFirst ('Q', 0, false).Offset() == 4);
+    check (str.Contains  ("LAZY", false));
+    check (!str.Contains ("LAZY"));
+    check (str.Split (" ").NumItems() == 9);
+
+    check.Done();
+
+    return 0;
+}
@@ -0,0 +1,194 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       ConditionTest.cpp
+//
+//  Synopsis:   Test program for Condition class
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Test.h"
+
+using namespace mikestoolbox;
+
+const uintsys NUM_WAITERS = 4;
+
+Condition       gcond_Event;
+Condition       gcond_State;
+Mutex           gmutex_State;
+uintsys         gu_State = 0;
+Atomic<uintsys> gu_Woken (0);
+
+bool StateIsReady ()
+{
+    return gu_State == NUM_WAITERS;
+}
+
+void WaitForEvent (void*)
+{
+    gcond_Event.Wait();
+
+    gu_Woken.Increment();
+}
+
+void WaitForState (void*)
+{
+    MutexLocker locker (gmutex_State);
+
+    gcond_State.Wait (gmutex_State, StateIsReady);
+
+    gu_Woken.Increment();
+}
+
+void SignalLater (void*)
+{
+    millisleep (20);
+
+    gcond_Event.Signal();
+}
+
+static bool WaitForWoken (uintsys u_Count)
+{
+    for (uintsys u = 0; u < 5000; ++u)
+    {
+        if (gu_Woken.Load() >= u_Count)
+        {
+            return gu_Woken.Load() == u_Count;
+        }
+
+        millisleep (1);
+    }
+
+    return false;
+}
+
+int main (int, char** argv)
+{
+    Tester check (argv[0]);
+
+    {
+        Condition cond;
+        Timer     timer;
+
+        check (!cond.Wait (0));
+        check (!cond.Wait (30));
+        check (timer.Elapsed() >= 0.025);
+
+        cond.Signal();
+
+        check (cond.Wait (0));
+        check (!cond.Wait (0));
+
+        cond.Signal();
+        cond.Signal();
+
+        check (cond.Wait (1000));
+        check (!cond.Wait (10));
+
+        Date date (Date::Now());
+
+        date.AddSeconds (0.05);
+
+        timer.Reset();
+
+        check (!cond.WaitUntil (date));
+        check (timer.Elapsed() >= 0.03);
+    }
+
+    {
+        (new SimpleThread (SignalLater, 0))->Run();
+
+        check (gcond_Event.Wait (5000));
+    }
+
+    {
+        for (uintsys u = 0; u < NUM_WAITERS; ++u)
+        {
+            (new SimpleThread (WaitForEvent, 0))->Run();
+        }
+
+        millisleep (50);
+
+        check (gu_Woken.Load() == 0);
+
+        gcond_Event.Signal();
+
+        check (WaitForWoken (1));
+
+        gcond_Event.Broadcast();
+
+        check (WaitForWoken (NUM_WAITERS));
+    }
+
+    {
+        gu_Woken.Store (0);
+
+        for (uintsys u = 0; u < NUM_WAITERS; ++u)
+        {
+            (new SimpleThread (WaitForState, 0))->Run();
+        }
+
+        for (uintsys u = 0; u < NUM_WAITERS; ++u)
+        {
+            millisleep (5);
+
+            MutexLocker locker (gmutex_State);
+
+            ++gu_State;
+
+            gcond_State.Broadcast();
+        }
+
+        check (WaitForWoken (NUM_WAITERS));
+
+        MutexLocker locker (gmutex_State);
+
+        check (gcond_State.Wait (gmutex_State, StateIsReady, 0));
+
+        gu_State = 0;
+
+        check (!gcond_State.Wait (gmutex_State, StateIsReady, 20));
+    }
+
+    check.Done();
+
+    return 0;
+}
@@ -131,6 +131,183 @@ int main (int, char** argv)
 
     check (file.Delete());
 
+    {
+        File file_Atomic ("TestFileAtomic");
+
+        file_Atomic.Delete();
+
+        int n_Flags = FILE_ATOMIC_REPLACE;
+
+        check (!file_Atomic.Write (str_LineA, n_Flags));
+        check (file_Atomic.Write (str_LineA, n_Flags|FILE_CREATE_OK));
+        check (file_Atomic.Size() == 1024);
+        check (!file_Atomic.Write (str_LineB, n_Flags|FILE_CREATE_OK));
+
+        StringList strl_Three;
+
+        strl_Three.Append (str_LineA, str_LineB, str_LineC);
+
+        check (file_Atomic.Write (strl_Three, n_Flags|FILE_REPLACE_EXISTING));
+        check (file_Atomic.Read (str_Contents));
+        check (str_Contents == strl_Three.Join());
+
+        StringList strl_Files (ReadDirectory ("."));
+
+        check (!strl_Files.Grep ("/^TestFileAtomic$/").IsEmpty());
+        check (strl_Files.Grep ("/^\\.TestFileAtomic\\./").IsEmpty());
+
+        check (file_Atomic.Write (strl_Three));
+        check (file_Atomic.Append (strl_Three));
+        check (file_Atomic.Size() == 6144);
+        check (file_Atomic.Delete());
+    }
+
+    {
+        FileWriter writer ("TestFileWriter");
+
+        check (writer.IsOpen());
+
+        writer.SetBufferSize (4096);
+
+        check (writer.Append (str_LineA));
+        check (writer.Append (str_LineB));
+        check (writer.BytesAppended() == 2048);
+        check (writer.BytesWritten()  == 0);
+
+        check (writer.Append (str_LineC));
+        check (writer.Append (str_LineA));
+        check (writer.BytesWritten()  == 4096);
+
+        check (writer.Append (str_LineB));
+        check (writer.Sync());
+        check (writer.BytesWritten() == 5120);
+        check (writer.BytesSynced()  == 5120);
+
+        check (writer.Close());
+        check (!writer.IsOpen());
+        check (!writer.Append (str_LineC));
+
+        File file_Log ("TestFileWriter");
+
+        check (file_Log.Size() == 5120);
+        check (file_Log.Read (str_Contents));
+        check (str_Contents.Match ("^A+\nB+\nC+\nA+\nB+\n$", matches));
+        check (file_Log.Delete());
+    }
+
+    if (File ("/dev/full").Exists())
+    {
+        FileWriter writer ("/dev/full", 0);
+
+        check (writer.Append (str_LineA));
+        check (!writer.Flush());
+        check (writer.Append (str_LineB));
+        check (!writer.Flush());
+        check (writer.BytesAppended() - writer.BytesWritten() == 2048);
+    }
+
+    {
+        File file_Chunks ("TestFileReader");
+
+        check (file_Chunks.Write (str_LineA + str_LineB + str_LineC));
+
+        FileReader reader ("TestFileReader");
+
+        check (reader.IsOpen());
+        check (!reader.IsAtEnd());
+
+        String str_Chunk;
+        String str_All;
+
+        while (reader.Read (str_Chunk, 1000))
+        {
+            check (str_Chunk.Length() <= 1000);
+
+            str_All += str_Chunk;
+        }
+
+        check (reader.IsAtEnd());
+        check (reader.BytesRead() == 3072);
+        check (str_All == str_LineA + str_LineB + str_LineC);
+        check (!reader.Read (str_Chunk));
+        check (str_Chunk.IsEmpty());
+
+        reader.Close();
+
+        check (!reader.IsOpen());
+        check (file_Chunks.Delete());
+
+        FileReader reader_Missing ("TestFileReader");
+
+        check (!reader_Missing.IsOpen());
+        check (!reader_Missing.Read (str_Chunk));
+        check (!reader_Missing.IsAtEnd());
+    }
+
+#ifdef HAVE_INOTIFY
+    {
+        FileWatcher   watcher;
+        FileEventList list_Events;
+
+        check (watcher.IsOpen());
+        check (watcher.Watch ("."));
+        check (!watcher.Wait (list_Events, 0));
+
+        File file_Watched ("TestFileWatched");
+
+        check (file_Watched.Write (str_LineA));
+        check (file_Watched.Append (str_LineB));
+        check (file_Watched.Append (str_LineC));
+
+        check (watcher.Wait (list_Events, 1000));
+        check (list_Events.NumItems() == 1);
+
+        FileEvent event (list_Events.Shift());
+
+        check (event.Path() == "./TestFileWatched");
+        check (event.IsCreate() && event.IsModify() && !event.IsDelete());
+
+        check (file_Watched.Delete());
+        check (watcher.Wait (list_Events, 1000));
+        check (list_Events.NumItems() == 1);
+        check (list_Events[0].Events() == FILE_EVENT_DELETE);
+
+        check (watcher.Unwatch ("."));
+        check (!watcher.Unwatch ("."));
+    }
+
+    {
+        // two events per append, so the kernel's queue has to overflow
+
+        String  str_Limit;
+        uintsys u_Limit = 0;
+
+        FileReader ("/proc/sys/fs/inotify/max_queued_events").Read (str_Limit);
+
+        u_Limit = str_Limit.AsUint();
+
+        if ((u_Limit > 0) && (u_Limit <= 100000))
+        {
+            FileWatcher   watcher;
+            FileEventList list_Events;
+            File          file_Flood ("TestFileFlood");
+
+            check (watcher.Watch ("."));
+
+            for (uintsys u = 0; u <= u_Limit / 2; ++u)
+            {
+                file_Flood.Append ("x");
+            }
+
+            check (watcher.Wait (list_Events, 1000));
+            check (list_Events.NumItems() == 2);
+            check (list_Events[-1].IsOverflow());
+            check (list_Events[-1].Path().IsEmpty());
+            check (file_Flood.Delete());
+        }
+    }
+#endif
+
     check.Done();
 
     return 0;
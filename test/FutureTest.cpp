@@ -0,0 +1,267 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       FutureTest.cpp
+//
+//  Synopsis:   Test program for Future and Promise classes
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Test.h"
+
+using namespace mikestoolbox;
+
+uintsys Square (void* p_Arg)
+{
+    uintsys u = *static_cast<uintsys*> (p_Arg);
+
+    return u * u;
+}
+
+uintsys SlowSquare (void* p_Arg)
+{
+    millisleep (50);
+
+    return Square (p_Arg);
+}
+
+uintsys Fail (void*)
+{
+    throw Exception ("task failed");
+}
+
+String Describe (const uintsys& u)
+{
+    String str ("value ");
+
+    str.Append (u);
+
+    return str;
+}
+
+uintsys Length (const String& str)
+{
+    return str.Length();
+}
+
+uintsys Reject (const String& str)
+{
+    throw StringException ("rejected " + str);
+}
+
+int SlowSeven ()
+{
+    millisleep (50);
+
+    return 7;
+}
+
+int Crash ()
+{
+    throw Exception ("thread failed");
+}
+
+String DescribeExit (const intsys& n)
+{
+    String str ("exit ");
+
+    str.Append (n);
+
+    return str;
+}
+
+int main (int, char** argv)
+{
+    Tester check (argv[0]);
+
+    {
+        Promise<uintsys> promise;
+        Future<uintsys>  future (promise.GetFuture());
+
+        check (future.IsValid());
+        check (!future.IsReady());
+        check (!future.Wait (10));
+
+        Future<String> future_Text (future.Then (Describe));
+
+        check (!future_Text.IsReady());
+        check (promise.SetValue (7));
+        check (!promise.SetValue (8));
+        check (promise.IsSatisfied());
+        check (future.IsReady());
+        check (future.Get() == 7);
+        check (future_Text.IsReady());
+        check (future_Text.Get() == "value 7");
+        check (future_Text.Then (Length).Get() == 7);
+    }
+
+    {
+        Promise<String> promise;
+        Future<uintsys> future (promise.GetFuture().Then (Reject));
+
+        promise.SetValue ("everything");
+
+        check (future.ExceptionCaught());
+        check (future.ExceptionMessage() == "rejected everything");
+
+        bool b_Thrown = false;
+
+        try
+        {
+            future.Get();
+        }
+        catch (StringException& e)
+        {
+            b_Thrown = (e.StringMessage() == "rejected everything");
+        }
+
+        check (b_Thrown);
+        check (future.Then (Describe).ExceptionMessage() ==
+               "rejected everything");
+    }
+
+    {
+        Future<uintsys> future;
+
+        {
+            Promise<uintsys> promise;
+
+            future = promise.GetFuture();
+        }
+
+        check (future.IsReady());
+        check (future.ExceptionMessage() == "broken promise");
+    }
+
+    {
+        ThreadPool pool (4);
+
+        uintsys u_Numbers[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+        List<Future<uintsys> > list_Futures;
+
+        for (uintsys u = 0; u < 8; ++u)
+        {
+            list_Futures.Append (Async (SlowSquare, &u_Numbers[u], pool));
+        }
+
+        Future<List<uintsys> > future_All (WhenAll (list_Futures));
+
+        check (future_All.Wait (5000));
+
+        List<uintsys> list_Squares (future_All.Get());
+
+        check (list_Squares.NumItems() == 8);
+        check (list_Squares[3] == 9);
+        check (list_Squares[7] == 49);
+
+        Future<String> future_Text (Async (Square, &u_Numbers[5], pool)
+                                        .Then (Describe, pool));
+
+        check (future_Text.Wait (5000));
+        check (future_Text.Get() == "value 25");
+
+        list_Futures.Append (Async (Fail, 0, pool));
+
+        Future<List<uintsys> > future_Failed (WhenAll (list_Futures));
+
+        check (future_Failed.Wait (5000));
+        check (future_Failed.ExceptionMessage() == "task failed");
+
+        Promise<uintsys>       promise_Never;
+        List<Future<uintsys> > list_Race;
+
+        list_Race.Append (promise_Never.GetFuture());
+        list_Race.Append (Async (SlowSquare, &u_Numbers[2], pool));
+
+        Future<uintsys> future_Any (WhenAny (list_Race));
+
+        check (future_Any.Wait (5000));
+        check (future_Any.Get() == 1);
+
+        promise_Never.SetValue (0);
+    }
+
+    {
+        SimpleThread* p_Thread = new SimpleThread (SlowSeven);
+
+        Future<intsys> future      (p_Thread->Result());
+        Future<String> future_Text (future.Then (DescribeExit));
+
+        check (!future.Wait (10));
+
+        p_Thread->Run();
+
+        check (future.Wait (5000));
+        check (p_Thread->HasExited());
+        check (future.Get() == 7);
+        check (future_Text.Get() == "exit 7");
+
+        delete p_Thread;
+
+        check (future.Get() == 7);
+
+        p_Thread = new SimpleThread (Crash);
+        future   = p_Thread->Result();
+
+        p_Thread->Run();
+        future.Wait();
+
+        check (future.ExceptionMessage() == "thread failed");
+
+        delete p_Thread;
+    }
+
+    {
+        uintsys u_Six = 6;
+
+        Future<uintsys> future (Async (Square, &u_Six,
+                                       InlineExecutor::Instance()));
+
+        check (future.IsReady());
+        check (future.Get() == 36);
+        check (WhenAll (List<Future<uintsys> >()).Get().IsEmpty());
+    }
+
+    check.Done();
+
+    return 0;
+}
@@ -43,6 +43,25 @@
 
 using namespace mikestoolbox;
 
+//+---------------------------------------------------------------------------
+//  Class:      LengthHash
+//
+//  Synopsis:   A hasher with no Equal, so its keys are compared with ==,
+//              and a poor one, so that different keys share a hash
+//----------------------------------------------------------------------------
+
+class LengthHash
+{
+public:
+
+    typedef uint32 HashInt;
+
+    static HashInt ComputeHash (const String& str)
+    {
+        return (HashInt) str.Length();
+    }
+};
+
 int main (int, char** argv)
 {
     Tester check (argv[0]);
@@ -105,6 +124,15 @@ int main (int, char** argv)
 
     check (hash1(1) == str_Foe);
 
+    Hash<String,int,LengthHash> hash_Length;
+
+    hash_Length(str_Foo) = 1;
+    hash_Length(str_Bar) = 2;
+
+    check (hash_Length(str_Foo) == 1);
+    check (hash_Length(str_Bar) == 2);
+    check (!hash_Length.Exists (str_Baz));
+
     check.Done();
 
     return 0;
@@ -0,0 +1,137 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       HexTest.cpp
+//
+//  Synopsis:   Test program for HexEncoder and HexDecoder
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Test.h"
+
+using namespace mikestoolbox;
+
+static uint32 gu_Seed = 12345;
+
+static uintsys Random (uintsys u_Limit)
+{
+    gu_Seed = gu_Seed * 1103515245 + 12345;
+
+    return (gu_Seed >> 8) % u_Limit;
+}
+
+static String Decode (const String& str, ParseError& error)
+{
+    HexDecoder decoder (error);
+
+    String str_Result;
+
+    for (uintsys u = 0; u < str.Length(); )
+    {
+        uintsys u_Chunk = Random (7);
+
+        str_Result += decoder.Update (str.Segment (u, u_Chunk));
+
+        u += u_Chunk;
+    }
+
+    return str_Result + decoder.Finish();
+}
+
+int main (int, char** argv)
+{
+    Tester check (argv[0]);
+
+    HexEncoder encoder;
+    HexEncoder encoder_Upper (true);
+
+    String str_Bytes ("\x01\xAB\xFF", 3);
+
+    check (encoder.Update (str_Bytes) + encoder.Finish() == "01abff");
+    check (encoder_Upper.Update (str_Bytes) == "01ABFF");
+    check (encoder.Update ("").IsEmpty());
+
+    ParseError error;
+
+    check (Decode ("01abff", error) == str_Bytes && error);
+    check (Decode ("01 AB\r\nfF\n", error) == str_Bytes && error);
+    check (Decode ("", error).IsEmpty() && error);
+
+    bool b_RoundTrip = true;
+
+    for (uintsys u_Try = 0; u_Try < 200; ++u_Try)
+    {
+        String str;
+
+        for (uintsys u = Random (100); u != 0; --u)
+        {
+            str.Append ((char) Random (256));
+        }
+
+        b_RoundTrip = b_RoundTrip && (Decode (str.Hex(), error) == str) &&
+                      (Decode (str.HEX(), error) == str) && error;
+    }
+
+    check (b_RoundTrip);
+
+    check (Decode ("01ab0", error) == String ("\x01\xAB", 2));
+    check (error.GetErrors() == ParseErrorUnexpectedEndOfData);
+
+    error.Clear();
+
+    check (Decode ("01xab", error) == String ("\x01", 1));
+    check (error.GetErrors() == ParseErrorIllegalByteSequence);
+
+    // nothing more is decoded after an error
+
+    error.Clear();
+
+    HexDecoder decoder (error);
+
+    check (decoder.Update ("0-").IsEmpty());
+    check (decoder.Update ("ab").IsEmpty());
+    check (decoder.Finish().IsEmpty());
+    check (error.GetErrors() == ParseErrorIllegalByteSequence);
+
+    check.Done();
+
+    return 0;
+}
@@ -553,6 +553,31 @@ void TestSplit ()
     check (list5[0] == 3);
 }
 
+#ifdef HAVE_MOVE_SEMANTICS
+void TestMove ()
+{
+    List<uintsys> list1 (MakeList (0, 1, 2, 3));
+    List<uintsys> list2 (std::move (list1));
+
+    check (list1.Check());
+    check (list2.Check());
+
+    check (list1.NumItems() == 0);
+    check (list2.NumItems() == 4);
+
+    list1 = std::move (list2);
+
+    check (list1.NumItems() == 4);
+    check (list2.NumItems() == 0);
+
+    list2.Append (uintsys (7));
+
+    check (list2.Check());
+    check (list2.NumItems() == 1);
+    check (list2[0] == 7);
+}
+#endif
+
 int main ()
 {
     TestEnds ();
@@ -567,6 +592,9 @@ int main ()
     TestRemove();
     TestSplice();
     TestSplit();
+#ifdef HAVE_MOVE_SEMANTICS
+    TestMove();
+#endif
 
     check.Done();
 
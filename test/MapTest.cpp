@@ -103,6 +103,31 @@ int main (int, char** argv)
 
         check (TestStandardVector());
 
+#ifdef HAVE_MOVE_SEMANTICS
+        Map<String,String> map3;
+
+        String str_Value ("moved value");
+
+        map3.Set ("key", std::move (str_Value));
+
+        check (map3["key"] == "moved value");
+        check (str_Value.IsEmpty());
+
+        Map<String,String> map4 (std::move (map3));
+
+        check (map4.NumItems() == 1);
+        check (map3.NumItems() == 0);
+
+        map3 = std::move (map4);
+
+        check (map3["key"] == "moved value");
+        check (map4.NumItems() == 0);
+
+        map4.Set ("again", "fine");
+
+        check (map4.NumItems() == 1);
+#endif
+
         check.Done();
     }
     catch (Exception& e)
@@ -0,0 +1,312 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       MultiPatternTest.cpp
+//
+//  Synopsis:   Test program for MultiPattern, checking every engine against
+//              a simple search on random texts and pattern sets
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Test.h"
+
+using namespace mikestoolbox;
+
+static uint32 gu_Seed = 54321;
+
+static uintsys Random (uintsys u_Limit)
+{
+    gu_Seed = gu_Seed * 1103515245 + 12345;
+
+    return (gu_Seed >> 8) % u_Limit;
+}
+
+static String RandomString (uintsys u_Length, const char* pz_Alphabet)
+{
+    uintsys u_Letters = std::strlen (pz_Alphabet);
+
+    String str;
+
+    for (uintsys u = 0; u < u_Length; ++u)
+    {
+        str.Append (pz_Alphabet[Random (u_Letters)]);
+    }
+
+    return str;
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   SimpleFindAll
+//
+//  Synopsis:   Every match as (pattern, offset, length) in the order that
+//              MultiPattern reports them: by where they end, then longest
+//              first, then by pattern index
+//----------------------------------------------------------------------------
+
+static List<uintsys> SimpleFindAll (const String& str_Text,
+                                    const StringList& strl_Patterns,
+                                    bool b_Case)
+{
+    List<uintsys> list;
+
+    uintsys u_Longest = 0;
+
+    for (uintsys u = 0; u < strl_Patterns.NumItems(); ++u)
+    {
+        u_Longest = Maximum (u_Longest, strl_Patterns[u].Length());
+    }
+
+    for (uintsys u_End = 1; u_End <= str_Text.Length(); ++u_End)
+    {
+        for (uintsys u_Length = Minimum (u_Longest, u_End); u_Length > 0;
+             --u_Length)
+        {
+            for (uintsys u = 0; u < strl_Patterns.NumItems(); ++u)
+            {
+                const String str_Pattern (strl_Patterns[u]);
+
+                if ((str_Pattern.Length() == u_Length) &&
+                    (StringCompare (str_Text.C() + u_End - u_Length,
+                                    str_Pattern.C(), u_Length, b_Case) == 0))
+                {
+                    list.Append (u);
+                    list.Append (u_End - u_Length);
+                    list.Append (u_Length);
+                }
+            }
+        }
+    }
+
+    return list;
+}
+
+static List<uintsys> Flatten (const MultiPatternMatchList& list_Matches)
+{
+    List<uintsys> list;
+
+    for (uintsys u = 0; u < list_Matches.NumItems(); ++u)
+    {
+        const MultiPatternMatch match (list_Matches[u]);
+
+        list.Append (match.Pattern());
+        list.Append (match.Offset());
+        list.Append (match.Length());
+    }
+
+    return list;
+}
+
+static bool CheckText (const MultiPattern& patterns, const String& str_Text)
+{
+    List<uintsys> list_Expected (SimpleFindAll (str_Text,
+                                                patterns.Patterns(),
+                                                patterns.IsCaseSensitive()));
+
+    MultiPatternMatchList list_Matches;
+
+    uintsys u_Found = patterns.FindAll (str_Text, list_Matches);
+
+    MultiPatternMatch match;
+
+    bool b_First = patterns.FindFirst (str_Text, match);
+
+    bool b_Ok = (Flatten (list_Matches) == list_Expected) &&
+                (u_Found == list_Matches.NumItems()) &&
+                (patterns.Contains (str_Text) == !list_Expected.IsEmpty()) &&
+                (b_First == !list_Expected.IsEmpty());
+
+    if (b_Ok && b_First)
+    {
+        b_Ok = (match == list_Matches[0]);
+    }
+
+    if (!b_Ok)
+    {
+        std::cout << ByteSearch::EngineName (ByteSearch::Engine())
+                  << ": " << patterns.Patterns().Join (',') << " in \""
+                  << str_Text << "\"" << std::endl;
+    }
+
+    return b_Ok;
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   TestEngine
+//
+//  Synopsis:   Random pattern sets, some with few start bytes so that text
+//              is skipped and some with too many for that
+//----------------------------------------------------------------------------
+
+static bool TestEngine (ByteSearchEngine engine)
+{
+    ByteSearch::SetEngine (engine);
+
+    const char* apz_Patterns[] = { "aAb-", "aAbBcCdDeEfFgGhHiIjJkK-_" };
+    const char* pz_Text        =   "aAbBcdefgh-xyz_ ";
+
+    for (uintsys u_Try = 0; u_Try < 2000; ++u_Try)
+    {
+        const char* pz_Alphabet = apz_Patterns[u_Try % 2];
+
+        StringList strl_Patterns;
+
+        for (uintsys u = Random (8); u > 0; --u)
+        {
+            strl_Patterns.Append (RandomString (1 + Random (4), pz_Alphabet));
+        }
+
+        if (Random (4) == 0)
+        {
+            strl_Patterns.Append ("");
+        }
+
+        String str_Text (RandomString (Random (200), pz_Text));
+
+        for (uintsys u = 0; u < 2; ++u)
+        {
+            MultiPattern patterns (strl_Patterns, u == 0);
+
+            if (!CheckText (patterns, str_Text))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+int main (int, char** argv)
+{
+    Tester check (argv[0]);
+
+    check (TestEngine (BYTE_SEARCH_SCALAR));
+    check (TestEngine (BYTE_SEARCH_SSE2));
+    check (TestEngine (BYTE_SEARCH_AVX2));
+
+    ByteSearch::SetEngine (BYTE_SEARCH_UNKNOWN);
+
+    StringList strl_Words;
+
+    strl_Words.Append ("he", "she", "his", "hers");
+
+    MultiPattern patterns (strl_Words);
+
+    MultiPatternMatchList list;
+
+    check (patterns);
+    check (patterns.NumPatterns() == 4);
+    check (patterns.Pattern (2) == "his");
+    check (patterns.IsCaseSensitive());
+
+    check (patterns.FindAll ("ushers", list) == 3);
+    check ((list[0].Pattern() == 1) && (list[0].Offset() == 1));
+    check ((list[1].Pattern() == 0) && (list[1].Offset() == 2));
+    check ((list[2].Pattern() == 3) && (list[2].Offset() == 2));
+    check (list[2].Length() == 4);
+
+    check (!patterns.Contains ("USHERS"));
+    check (MultiPattern (strl_Words, false).Contains ("USHERS"));
+
+    MultiPatternMatch match;
+
+    check (patterns.FindFirst ("this one", match));
+    check ((match.Pattern() == 2) && (match.Offset() == 1));
+    check (!patterns.FindFirst ("nothing", match));
+
+    // duplicates are all reported, and empty patterns never match
+
+    strl_Words.Append ("she", "");
+
+    patterns = MultiPattern (strl_Words);
+
+    list.Clear();
+
+    check (patterns.FindAll ("she", list) == 3);
+    check ((list[0].Pattern() == 1) && (list[1].Pattern() == 4));
+    check (list[2].Pattern() == 0);
+
+    StringList strl_Empty;
+
+    strl_Empty.Append ("");
+
+    check (!MultiPattern (strl_Empty));
+    check (!MultiPattern (strl_Empty).Contains ("anything"));
+    check (!MultiPattern().Contains ("anything"));
+    check (MultiPattern().NumPatterns() == 0);
+
+    // copies share the tables and moves leave the source empty
+
+    MultiPattern mp_Copy (patterns);
+
+    check (mp_Copy.Contains ("ushers"));
+
+#ifdef HAVE_MOVE_SEMANTICS
+    MultiPattern mp_Moved (std::move (mp_Copy));
+
+    check (mp_Moved.Contains ("ushers"));
+    check (!mp_Copy);
+#endif
+
+    // String and StringList
+
+    String str_Line ("a line that mentions hers");
+
+    check (str_Line.Contains (patterns));
+    check (!String ("nothing at all").Contains (patterns));
+
+    StringList strl_Lines;
+
+    strl_Lines.Append ("first line", "second: she said", "third",
+                       "fourth: his");
+
+    StringList strl_Found (strl_Lines.Grep (patterns));
+
+    check (strl_Found.NumItems() == 2);
+    check (strl_Found[0] == "second: she said");
+    check (strl_Found[1] == "fourth: his");
+
+    check (strl_Lines.Grep (MultiPattern()).IsEmpty());
+
+    check.Done();
+
+    return 0;
+}
@@ -0,0 +1,339 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       MutexTest.cpp
+//
+//  Synopsis:   Test program for AdaptiveMutex, ReadWriteMutex and
+//              MutexProfile classes
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Test.h"
+
+using namespace mikestoolbox;
+
+const uintsys NUM_THREADS    = 8;
+const uintsys NUM_INCREMENTS = 20000;
+
+AdaptiveMutex   gmutex_Count;
+ReadWriteMutex  grwmutex_Pair;
+uintsys         gu_Count = 0;
+uintsys         gu_First = 0;
+uintsys         gu_Second = 0;
+Atomic<uintsys> gu_Torn (0);
+Atomic<uintsys> gu_Done (0);
+Atomic<uintsys> gu_Held (0);
+
+void IncrementCount (void*)
+{
+    for (uintsys u = 0; u < NUM_INCREMENTS; ++u)
+    {
+        AdaptiveMutexLocker locker (gmutex_Count);
+
+        ++gu_Count;
+    }
+
+    gu_Done.Increment();
+}
+
+//+---------------------------------------------------------------------------
+//  Function:   UpdatePair
+//
+//  Synopsis:   Writers keep the two values equal; readers check that they
+//              never see them differ
+//----------------------------------------------------------------------------
+
+void UpdatePair (void* p_Arg)
+{
+    bool b_Writer = (p_Arg != 0);
+
+    for (uintsys u = 0; u < NUM_INCREMENTS; ++u)
+    {
+        if (b_Writer && ((u % 8) == 0))
+        {
+            WriteLocker locker (grwmutex_Pair);
+
+            ++gu_First;
+            ++gu_Second;
+        }
+        else
+        {
+            ReadLocker locker (grwmutex_Pair);
+
+            if (gu_First != gu_Second)
+            {
+                gu_Torn.Increment();
+            }
+        }
+    }
+
+    gu_Done.Increment();
+}
+
+void WritePair (void*)
+{
+    for (uintsys u = 0; u < NUM_INCREMENTS / 8; ++u)
+    {
+        WriteLocker locker (grwmutex_Pair);
+
+        ++gu_First;
+        ++gu_Second;
+    }
+
+    gu_Done.Increment();
+}
+
+void HoldMutex (void* p_Mutex)
+{
+    {
+        MutexLocker locker (*(Mutex*) p_Mutex);
+
+        gu_Held.Store (1);
+
+        millisleep (20);
+    }
+
+    gu_Done.Increment();
+}
+
+static void WaitForThreads (uintsys u_Count)
+{
+    while (gu_Done.Load() < u_Count)
+    {
+        millisleep (1);
+    }
+}
+
+int main (int, char** argv)
+{
+    Tester check (argv[0]);
+
+    {
+        AdaptiveMutex mutex;
+
+        check (mutex.TryLock());
+        check (!mutex.TryLock());
+
+        mutex.Unlock();
+
+        check (mutex.TryLock());
+
+        mutex.Unlock();
+
+        {
+            AdaptiveMutexLocker locker (mutex);
+
+            check (!mutex.TryLock());
+        }
+
+        check (mutex.TryLock());
+
+        mutex.Unlock();
+    }
+
+    {
+        ReadWriteMutex rwmutex;
+
+        check (rwmutex.TryLockShared());
+        check (rwmutex.TryLockShared());
+        check (!rwmutex.TryLock());
+
+        rwmutex.UnlockShared();
+
+        check (!rwmutex.TryLock());
+
+        rwmutex.UnlockShared();
+
+        check (rwmutex.TryLock());
+        check (!rwmutex.TryLock());
+        check (!rwmutex.TryLockShared());
+
+        rwmutex.Unlock();
+
+        {
+            ReadLocker locker (rwmutex);
+
+            check (rwmutex.TryLockShared());
+            check (!rwmutex.TryLock());
+
+            rwmutex.UnlockShared();
+        }
+
+        {
+            WriteLocker locker (rwmutex);
+
+            check (!rwmutex.TryLockShared());
+        }
+
+        check (rwmutex.TryLock());
+
+        rwmutex.Unlock();
+    }
+
+    {
+        for (uintsys u = 0; u < NUM_THREADS; ++u)
+        {
+            (new SimpleThread (IncrementCount, 0))->Run();
+        }
+
+        WaitForThreads (NUM_THREADS);
+
+        check (gu_Count == NUM_THREADS * NUM_INCREMENTS);
+    }
+
+    {
+        gu_Done.Store (0);
+
+        for (uintsys u = 0; u < NUM_THREADS; ++u)
+        {
+            void* p_Writer = ((u % 2) == 0) ? &gu_Done : 0;
+
+            (new SimpleThread (UpdatePair, p_Writer))->Run();
+        }
+
+        WaitForThreads (NUM_THREADS);
+
+        uintsys u_Writes = (NUM_THREADS / 2) * (NUM_INCREMENTS / 8);
+
+        check (gu_Torn.Load() == 0);
+        check (gu_First == u_Writes);
+        check (gu_Second == u_Writes);
+    }
+
+    // writers all asleep behind a reader get through once it leaves
+
+    {
+        gu_Done.Store (0);
+        gu_First  = 0;
+        gu_Second = 0;
+
+        grwmutex_Pair.LockShared();
+
+        for (uintsys u = 0; u < NUM_THREADS; ++u)
+        {
+            (new SimpleThread (WritePair, 0))->Run();
+        }
+
+        millisleep (20);
+
+        grwmutex_Pair.UnlockShared();
+
+        WaitForThreads (NUM_THREADS);
+
+        check (gu_First == NUM_THREADS * (NUM_INCREMENTS / 8));
+        check (gu_Second == gu_First);
+    }
+
+    {
+        MutexProfile::Reset();
+
+        {
+            Mutex mutex ("MutexTest");
+
+            for (uintsys u = 0; u < 10; ++u)
+            {
+                MutexLocker locker (mutex);
+            }
+
+            check (mutex.TryLock());
+
+            mutex.Unlock();
+
+            gu_Done.Store (0);
+
+            (new SimpleThread (HoldMutex, &mutex))->Run();
+
+            while (gu_Held.Load() == 0)
+            {
+                millisleep (1);
+            }
+
+            {
+                MutexLocker locker (mutex);
+            }
+
+            WaitForThreads (1);
+        }
+
+        MutexStatsList list_Stats (MutexProfile::Snapshot());
+
+        if (MutexProfile::IsEnabled())
+        {
+            MutexStats stats;
+
+            for (ListIter<MutexStats> iter (list_Stats); iter; ++iter)
+            {
+                if (iter->Name() == "MutexTest")
+                {
+                    stats = *iter;
+                }
+            }
+
+            check (stats.Acquisitions() == 13);
+            check (stats.Contentions() == 1);
+            check (stats.MaxWait() > 0.005);
+            check (stats.MaxHold() > 0.015);
+            check (stats.TotalHold() >= stats.MaxHold());
+            check (MutexProfile::Report().Contains ("MutexTest"));
+
+            MutexProfile::Reset();
+
+            list_Stats = MutexProfile::Snapshot();
+
+            uint64 u_Acquisitions = 0;
+
+            for (ListIter<MutexStats> iter (list_Stats); iter; ++iter)
+            {
+                u_Acquisitions += iter->Acquisitions();
+            }
+
+            check (u_Acquisitions == 0);
+        }
+        else
+        {
+            check (list_Stats.IsEmpty());
+        }
+    }
+
+    check.Done();
+
+    return 0;
+}
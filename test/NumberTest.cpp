@@ -0,0 +1,430 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       NumberTest.cpp
+//
+//  Synopsis:   Test program for Number, checked against printf and strtod
+//              on random integers, doubles and decimal text
+//----------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include "mikestoolbox-1.2.h"
+#include "Test.h"
+
+using namespace mikestoolbox;
+
+static uint32 gu_Seed = 12345;
+
+static uintsys Random (uintsys u_Limit)
+{
+    gu_Seed = gu_Seed * 1103515245 + 12345;
+
+    return (gu_Seed >> 8) % u_Limit;
+}
+
+static uint64 Random64 ()
+{
+    uint64 u = 0;
+
+    for (uintsys n = 0; n < 4; ++n)
+    {
+        u = (u << 16) | Random (0x10000);
+    }
+
+    return u;
+}
+
+static double BitsToDouble (uint64 u)
+{
+    double d = 0;
+
+    std::memcpy (&d, &u, 8);
+
+    return d;
+}
+
+static bool SameBits (double d1, double d2)
+{
+    return std::memcmp (&d1, &d2, 8) == 0;
+}
+
+//  A finite double: any bit pattern, a short decimal like the ones found
+//  in measurements, or a subnormal with only a few significant bits
+
+static double RandomDouble ()
+{
+    switch (Random (4))
+    {
+        case 0:  return (double) Random (1000000) / 100;
+        case 1:  return (double) (Random64() >> 20) * 1e-7;
+        case 2:  return BitsToDouble (Random64() >> (12 + Random (52)));
+        default: break;
+    }
+
+    double d = BitsToDouble (Random64());
+
+    return (d - d == 0) ? d : 1.5;
+}
+
+//  The old digit-at-a-time conversion
+
+static String SimpleFormat (uint64 u, bool b_Negative)
+{
+    String str;
+
+    do
+    {
+        str.Append ((char) ('0' + u % 10));
+
+        u /= 10;
+    }
+    while (u != 0);
+
+    if (b_Negative)
+    {
+        str.Append ('-');
+    }
+
+    str.Reverse();
+
+    return str;
+}
+
+//  The number of significant digits printf needs for d to read back
+
+static uintsys PrintfDigits (double d)
+{
+    char ac[40];
+
+    for (int n_Precision = 0; n_Precision < 17; ++n_Precision)
+    {
+        snprintf (ac, sizeof(ac), "%.*e", n_Precision, d);
+
+        if (std::strtod (ac, 0) == d)
+        {
+            return n_Precision + 1;
+        }
+    }
+
+    return 17;
+}
+
+static uintsys SignificantDigits (const String& str)
+{
+    uintsys u_First = MAX_UINTSYS;
+    uintsys u_Last  = 0;
+    uintsys u_Count = 0;
+
+    for (uintsys u = 0; (u < str.Length()) && (str[u] != 'e'); ++u)
+    {
+        if ((str[u] >= '0') && (str[u] <= '9'))
+        {
+            if (str[u] != '0')
+            {
+                u_First = Minimum (u_First, u_Count);
+                u_Last  = u_Count;
+            }
+
+            ++u_Count;
+        }
+    }
+
+    return (u_First == MAX_UINTSYS) ? 1 : u_Last - u_First + 1;
+}
+
+static bool SamePrint (double d, const DoubleFormat& format,
+                       const char* pz_Format, int n_Precision)
+{
+    char ac1[400];
+    char ac2[400];
+
+    intsys n1 = format.Print (d, ac1, sizeof(ac1));
+    intsys n2 = snprintf (ac2, sizeof(ac2), pz_Format, n_Precision, d);
+
+    if ((n1 != n2) || (std::strcmp (ac1, ac2) != 0))
+    {
+        std::cout << pz_Format << " " << n_Precision << ": " << ac1
+                  << " != " << ac2 << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+int main (int, char** argv)
+{
+    Tester check (argv[0]);
+
+    // integers
+
+    check (String (int64 (0))            == "0");
+    check (String (int32 (-7))           == "-7");
+    check (String (uint16 (65535))       == "65535");
+    check (String (int64 (MIN_INTSYS))   == "-9223372036854775808");
+    check (String (uint64 (MAX_UINTSYS)) == "18446744073709551615");
+
+    {
+        bool b_OK = true;
+
+        for (uintsys u_Try = 0; u_Try < 200000; ++u_Try)
+        {
+            uint64 u = Random64() >> Random (64);
+            int64  n = (int64) Random64() >> Random (64);
+
+            String str_Uint (u);
+            String str_Int  (n);
+            String str_Sum ("x");
+
+            str_Sum += n;
+
+            b_OK = b_OK && (str_Uint == SimpleFormat (u, false))
+                        && (str_Int  == SimpleFormat (n < 0 ? 0 - (uint64) n
+                                                            : (uint64) n,
+                                                      n < 0))
+                        && (str_Sum  == "x" + str_Int)
+                        && ((uint64) str_Uint.AsUint() == u)
+                        && ((int64)  str_Int.AsInt()   == n);
+        }
+
+        check (b_OK);
+    }
+
+    check (String (" \t+42").AsInt()                == 42);
+    check (String ("12abc").AsInt()                 == 12);
+    check (String ("-").AsInt()                     == 0);
+    check (String ("9223372036854775808").AsInt()   == MAX_INTSYS);
+    check (String ("-99999999999999999999").AsInt() == MIN_INTSYS);
+    check (String ("-1").AsUint()                   == MAX_UINTSYS);
+    check (String ("18446744073709551616").AsUint() == MAX_UINTSYS);
+
+    // shortest digits read back exactly, and are never longer than what
+    // printf needs (they can be shorter when d is a power of two, where
+    // the gap below is half the gap above)
+
+    {
+        DoubleFormat format;
+
+        format.UseShortestDigits();
+
+        bool b_OK = true;
+
+        for (uintsys u_Try = 0; b_OK && (u_Try < 300000); ++u_Try)
+        {
+            double d = RandomDouble();
+            String str (d, format);
+
+            b_OK = (std::strtod (str.C(), 0) == d)
+                && (str.AsDouble() == d)
+                && (SignificantDigits (str) <= PrintfDigits (d));
+
+            if (!b_OK)
+            {
+                std::cout << str << std::endl;
+            }
+        }
+
+        check (b_OK);
+    }
+
+    check (String (0.1)  == "0.1");
+    check (String (-0.0) == "-0");
+    check (String (1e21) == "1e+21");
+
+    // subnormals have too few bits for their shortest digits to be padded
+
+    check (String (5e-324)   == "4.9406565e-324");
+    check (String (1e-323)   == "9.8813129e-324");
+    check (String (2.5e-323) == "2.4703282e-323");
+    check (String (4.9e-322) == "4.8912499e-322");
+    check (String (1e-320)   == "9.9998887e-321");
+
+    {
+        DoubleFormat format;
+
+        format.UseShortestDigits();
+
+        check (String (0.1 + 0.2, format) == "0.30000000000000004");
+        check (String (1e16, format)      == "10000000000000000");
+        check (String (1e17, format)      == "1e+17");
+        check (String (5e-324, format)    == "4.9406564584124654e-324" ||
+               String (5e-324, format)    == "5e-324");
+
+        format.UseScientificNotation();
+
+        check (String (1234.5, format) == "1.2345e+03");
+
+        format.UseDecimalNotation();
+
+        check (String (1.5e-5, format) == "0.000015");
+
+        format.AutoSelectNotation();
+        format.SetPrecision (3);
+
+        check (String (1.0 / 3, format) == "0.333");
+
+        format.SetPrecision (-1);   // printf's default of 6
+
+        check (String (1.0 / 3, format) == "0.333333");
+    }
+
+    // the fast path of Print matches printf, whatever the precision
+
+    {
+        static const char* const apz_Format[] = { "%1.*g", "%1.*e", "%1.*f" };
+
+        bool b_OK = true;
+
+        for (uintsys u_Try = 0; b_OK && (u_Try < 300000); ++u_Try)
+        {
+            double d = RandomDouble();
+
+            if (Random (8) == 0)
+            {
+                d = 0.0;
+            }
+
+            if (Random (2) == 0)
+            {
+                d = -d;
+            }
+
+            int          n_Precision = (int) Random (18);
+            uintsys      u_Notation  = Random (3);
+            DoubleFormat format;
+
+            format.SetPrecision (n_Precision);
+
+            if (u_Notation == 1)
+            {
+                format.UseScientificNotation();
+            }
+            else if (u_Notation == 2)
+            {
+                format.UseDecimalNotation();
+            }
+
+            b_OK = SamePrint (d, format, apz_Format[u_Notation],
+                              n_Precision);
+        }
+
+        check (b_OK);
+    }
+
+    // decimal text with up to 25 digits reads the same as with strtod
+
+    {
+        bool b_OK = true;
+
+        for (uintsys u_Try = 0; b_OK && (u_Try < 500000); ++u_Try)
+        {
+            String  str (Random (2) ? "-" : "");
+            uintsys u_Digits = 1 + Random (25);
+            uintsys u_Point  = Random (u_Digits + 1);
+
+            for (uintsys u = 0; u < u_Digits; ++u)
+            {
+                if (u == u_Point)
+                {
+                    str.Append ('.');
+                }
+
+                str.Append ((char) ('0' + Random (10)));
+            }
+
+            if (Random (2) == 0)
+            {
+                str.Append ('e');
+                str.Append ((int32) Random (700) - 350);
+            }
+
+            double d = 0;
+
+            uintsys u_Used = Number::ParseDouble (str.C(), str.Length(), d);
+
+            char*  p_End = 0;
+            double d_Std = std::strtod (str.C(), &p_End);
+
+            b_OK = SameBits (d, d_Std) && (u_Used == str.Length())
+                && (p_End == str.C() + str.Length());
+
+            if (!b_OK)
+            {
+                std::cout << str << std::endl;
+            }
+        }
+
+        check (b_OK);
+    }
+
+    {
+        static const char* const apz_Text[] =
+        {
+            "  1.5", "1e", "1e+", "1.e5", ".5e-3", "-0.0", "1e400", "1e-400",
+            "inf", "-nan", "0x1p3", "2.4703282292062328e-324",
+            "2.4703282292062327e-324", "9007199254740993",
+            "9007199254740992.5", "1.7976931348623158e308", "x", ""
+        };
+
+        bool b_OK = true;
+
+        for (uintsys u = 0; u < sizeof(apz_Text) / sizeof(apz_Text[0]); ++u)
+        {
+            const char* pz = apz_Text[u];
+
+            double d = 0;
+
+            uintsys u_Used = Number::ParseDouble (pz, std::strlen (pz), d);
+
+            char*  p_End = 0;
+            double d_Std = std::strtod (pz, &p_End);
+
+            b_OK = b_OK && SameBits (d, d_Std) && (pz + u_Used == p_End);
+        }
+
+        check (b_OK);
+    }
+
+    check.Done();
+
+    return 0;
+}
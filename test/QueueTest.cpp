@@ -0,0 +1,297 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       QueueTest.cpp
+//
+//  Synopsis:   Test program for SPSCQueue and MPMCQueue classes
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Test.h"
+
+using namespace mikestoolbox;
+
+const uintsys NUM_ITEMS   = 100000;
+const uintsys NUM_THREADS = 4;
+
+MPMCQueue<uintsys> gqueue_Work (64);
+Atomic<uintsys>    gu_Sum (0);
+Atomic<uintsys>    gu_Done (0);
+
+void Producer (void* p_Arg)
+{
+    uintsys u_First = reinterpret_cast<uintsys> (p_Arg) * NUM_ITEMS;
+
+    for (uintsys u = 1; u <= NUM_ITEMS; ++u)
+    {
+        gqueue_Work.Push (u_First + u);
+    }
+
+    gu_Done.Increment();
+}
+
+void Consumer (void*)
+{
+    uintsys u_Item;
+
+    while (gqueue_Work.Pop (u_Item))
+    {
+        gu_Sum.FetchAdd (u_Item);
+    }
+
+    gu_Done.Increment();
+}
+
+MPMCQueue<uintsys>* gp_Race = 0;
+Atomic<uintsys>     gu_Pushed (0);
+Atomic<uintsys>     gu_Popped (0);
+
+void RaceProducer (void*)
+{
+    while (gp_Race->Push (1))
+    {
+        gu_Pushed.Increment();
+    }
+
+    gu_Done.Increment();
+}
+
+void RaceConsumer (void*)
+{
+    uintsys u_Item;
+
+    while (gp_Race->Pop (u_Item))
+    {
+        gu_Popped.Increment();
+    }
+
+    gu_Done.Increment();
+}
+
+SPSCQueue<uintsys>  gqueue_Pair (4);
+Atomic<bool>        gb_Stop (false);
+
+void PairProducer (void*)
+{
+    for (uintsys u = 0; u < NUM_ITEMS; ++u)
+    {
+        gqueue_Pair.Push (u);
+    }
+
+    gqueue_Pair.Close();
+}
+
+void PairConsumer (void*)
+{
+    uintsys u_Item;
+
+    while (gqueue_Pair.Pop (u_Item))
+    {
+        // nothing
+    }
+
+    gb_Stop.Store (true);
+}
+
+SPSCQueue<uintsys>  gqueue_Later (4);
+
+void PushLater (void*)
+{
+    millisleep (20);
+
+    gqueue_Later.Push (42);
+}
+
+int main (int, char** argv)
+{
+    Tester check (argv[0]);
+
+    {
+        SPSCQueue<String> queue (3);
+
+        check (queue.Capacity() == 4);
+        check (queue.IsEmpty());
+
+        String str_Item;
+
+        check (!queue.TryPop (str_Item));
+        check (!queue.Pop (str_Item, 10));
+
+        check (queue.TryPush ("one"));
+        check (queue.TryPush ("two"));
+        check (queue.Push ("three"));
+        check (queue.Push ("four", 0));
+        check (!queue.TryPush ("five"));
+        check (!queue.Push ("five", 10));
+        check (queue.NumItems() == 4);
+
+        check (queue.TryPop (str_Item) && str_Item == "one");
+        check (queue.Pop (str_Item) && str_Item == "two");
+        check (queue.TryPush ("five"));
+
+        queue.Close();
+
+        check (queue.IsClosed());
+        check (!queue.TryPush ("six"));
+        check (queue.Pop (str_Item) && str_Item == "three");
+        check (queue.Pop (str_Item) && str_Item == "four");
+        check (queue.Pop (str_Item) && str_Item == "five");
+        check (!queue.Pop (str_Item));
+    }
+
+    {
+        MPMCQueue<String> queue (4);
+
+        check (queue.Capacity() == 4);
+
+        String str_Item;
+
+        check (!queue.TryPop (str_Item));
+
+        for (uintsys u = 0; u < 10; ++u)
+        {
+            check (queue.TryPush (String (u)));
+            check (queue.TryPop (str_Item) && str_Item == String (u));
+        }
+
+        check (queue.Push ("a") && queue.Push ("b"));
+        check (queue.Push ("c") && queue.Push ("d"));
+        check (!queue.Push ("e", 10));
+        check (queue.NumItems() == 4);
+
+        check (queue.Pop (str_Item, 10) && str_Item == "a");
+
+        queue.Close();
+
+        check (!queue.Push ("e"));
+        check (queue.Pop (str_Item) && str_Item == "b");
+        check (queue.Pop (str_Item) && str_Item == "c");
+        check (queue.Pop (str_Item) && str_Item == "d");
+        check (!queue.Pop (str_Item));
+        check (queue.IsEmpty());
+    }
+
+    {
+        for (uintsys u = 0; u < NUM_THREADS; ++u)
+        {
+            (new SimpleThread (Producer, reinterpret_cast<void*> (u)))->Run();
+            (new SimpleThread (Consumer, 0))->Run();
+        }
+
+        while (gu_Done.Load() < NUM_THREADS)
+        {
+            millisleep (1);
+        }
+
+        gqueue_Work.Close();
+
+        while (gu_Done.Load() < 2 * NUM_THREADS)
+        {
+            millisleep (1);
+        }
+
+        uintsys u_Total = NUM_THREADS * NUM_ITEMS;
+
+        check (gu_Sum.Load() == u_Total * (u_Total + 1) / 2);
+        check (gqueue_Work.IsEmpty());
+    }
+
+    // every Push which returns true is popped, even when Close() lands
+    // while producers are part way through pushing
+
+    for (uintsys u_Round = 0; u_Round < 20; ++u_Round)
+    {
+        gu_Done.Store (0);
+
+        gp_Race = new MPMCQueue<uintsys> (8);
+
+        for (uintsys u = 0; u < NUM_THREADS; ++u)
+        {
+            (new SimpleThread (RaceProducer, 0))->Run();
+            (new SimpleThread (RaceConsumer, 0))->Run();
+        }
+
+        millisleep (5);
+
+        gp_Race->Close();
+
+        while (gu_Done.Load() < 2 * NUM_THREADS)
+        {
+            millisleep (1);
+        }
+
+        check (gu_Popped.Load() == gu_Pushed.Load());
+        check (gp_Race->IsDrained());
+
+        delete gp_Race;
+    }
+
+    // the consumer never sees more items than the queue holds
+
+    {
+        (new SimpleThread (PairProducer, 0))->Run();
+        (new SimpleThread (PairConsumer, 0))->Run();
+
+        bool b_OK = true;
+
+        while (!gb_Stop.Load())
+        {
+            b_OK = b_OK && (gqueue_Pair.NumItems() <= 4);
+        }
+
+        check (b_OK);
+        check (gqueue_Pair.IsEmpty());
+    }
+
+    // a sleeping Pop wakes when an item arrives
+
+    {
+        uintsys u_Item = 0;
+
+        (new SimpleThread (PushLater, 0))->Run();
+
+        check (gqueue_Later.Pop (u_Item) && (u_Item == 42));
+    }
+
+    check.Done();
+
+    return 0;
+}
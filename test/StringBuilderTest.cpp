@@ -0,0 +1,153 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       StringBuilderTest.cpp
+//
+//  Synopsis:   Test program for StringBuilder class
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Test.h"
+
+using namespace mikestoolbox;
+
+int main (int, char** argv)
+{
+    Tester check (argv[0]);
+
+    try
+    {
+        StringBuilder sb;
+
+        check (sb.IsEmpty());
+        check (sb.NumPieces() == 0);
+        check (sb.ToString() == "");
+
+        String str_Large ('x', Repeat(1000));
+
+        sb.Append (str_Large);
+        sb.Append (str_Large);
+
+        check (sb.Length() == 2000);
+        check (sb.NumPieces() == 2);
+        check (sb.Pieces()[0].C() == str_Large.C());  // shared, not copied
+
+        // small fragments are gathered into a piece of their own
+
+        sb += "a";
+        sb += 'b';
+        sb += String ("c");
+
+        check (sb.NumPieces() == 3);
+        check (sb.Length() == 2003);
+        check (str_Large.Length() == 1000);
+
+        sb.Prepend ("<<");
+
+        check (sb.NumPieces() == 4);
+        check (sb.ToString().StartsWith ("<<xxx"));
+        check (sb.ToString().EndsWith ("xxabc"));
+
+        sb.Insert (2, "[");
+        sb.Insert (503, "|");
+        sb.Insert (sb.Length(), ">>");
+
+        String str (sb.ToString());
+
+        check (str.Length() == 2009);
+        check (str.Head (4) == "<<[x");
+        check (str[503] == '|');
+        check (str[502] == 'x' && str[504] == 'x');
+        check (str.Tail (5) == "abc>>");
+        check (str_Large.Length() == 1000);
+        check (str_Large.Count ('x') == 1000);
+
+        bool b_Threw = false;
+
+        try
+        {
+            sb.Insert (sb.Length() + 1, "!");
+        }
+        catch (Exception&)
+        {
+            b_Threw = true;
+        }
+
+        check (b_Threw);
+
+        StringBuilder sb2 (sb);
+
+        sb2.Append (sb2);
+
+        check (sb2.Length() == 2 * str.Length());
+        check (sb2.ToString() == str + str);
+        check (sb.ToString() == str);
+
+        check (sb.Flatten() == str);
+        check (sb.NumPieces() == 1);
+        check (sb.Length() == str.Length());
+
+        sb.Clear();
+
+        check (sb.IsEmpty());
+        check (sb.Flatten() == "");
+
+        File file ("TestStringBuilder");
+
+        check (file.Write (sb2));
+        check (file.Size() == sb2.Length());
+        check (file.Append (StringBuilder (String ("tail"))));
+
+        String str_Contents;
+
+        check (file.Read (str_Contents));
+        check (str_Contents == sb2.ToString() + "tail");
+        check (file.Delete());
+    }
+    catch (Exception& e)
+    {
+        std::cout << "Exception caught: " << e.Message() << std::endl;
+    }
+
+    check.Done();
+
+    return 0;
+}
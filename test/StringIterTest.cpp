@@ -47,6 +47,10 @@ bool TestExtractUint8  ();
 bool TestExtractUint16 ();
 bool TestExtractUint24 ();
 bool TestExtractUint32 (uintsys u_TopByte);
+bool TestExtractUint64 ();
+bool TestExtractFloat  ();
+bool TestExtractArrays (ByteSearchEngine engine);
+bool TestExtractBits   ();
 
 int main (int, char** argv)
 {
@@ -56,6 +60,15 @@ int main (int, char** argv)
     check (TestExtractUint16());
     check (TestExtractUint24());
     check (TestExtractUint32 (0xA6));
+    check (TestExtractUint64());
+    check (TestExtractFloat());
+    check (TestExtractArrays (BYTE_SEARCH_SCALAR));
+    check (TestExtractArrays (BYTE_SEARCH_SSE2));
+    check (TestExtractArrays (BYTE_SEARCH_AVX2));
+
+    ByteSearch::SetEngine (BYTE_SEARCH_UNKNOWN);
+
+    check (TestExtractBits());
 
     check.Done();
 
@@ -243,3 +256,303 @@ bool TestExtractUint32 (uintsys u_TopByte)
     return b_Success;
 }
 
+static uint32 gu_Seed = 12345;
+
+static uintsys Random (uintsys u_Limit)
+{
+    gu_Seed = gu_Seed * 1103515245 + 12345;
+
+    return (gu_Seed >> 8) % u_Limit;
+}
+
+static String RandomBytes (uintsys u_Length)
+{
+    String str;
+
+    for (uintsys u=0; u<u_Length; ++u)
+    {
+        str.AppendUint8 (Random (256));
+    }
+
+    return str;
+}
+
+//  Assembles u_Width bytes the slow way
+
+static uint64 Assemble (const uchar* p, uintsys u_Width, bool b_LittleEndian)
+{
+    uint64 u = 0;
+
+    for (uintsys u_Byte=0; u_Byte<u_Width; ++u_Byte)
+    {
+        uintsys u_Index = b_LittleEndian ? (u_Width - 1 - u_Byte) : u_Byte;
+
+        u = (u << 8) | p[u_Index];
+    }
+
+    return u;
+}
+
+bool TestExtractUint64 ()
+{
+    String str ("\x01\x23\x45\x67\x89\xAB\xCD\xEF\x55", 9);
+
+    StringIter iter (str);
+
+    uint64     u = 0;
+    ParseError error;
+
+    bool b_Success = iter.ExtractUint64 (u, error) &&
+                     (u == 0x0123456789ABCDEFULL);
+
+    b_Success = b_Success && !iter.ExtractUint64 (u, error);
+
+    // a new iterator for each pass rather than assigning str to iter
+    // again: GCC cannot see that str still holds the block which iter
+    // lets go of, and warns of a use after free at -O3
+
+    StringIter iter_Little (str);
+
+    iter_Little.SetLittleEndian();
+
+    b_Success = b_Success && iter_Little.ExtractUint64 (u, error) &&
+                (u == 0xEFCDAB8967452301ULL);
+
+    StringIter iter_Offset (str, 1);
+
+    b_Success = b_Success && iter_Offset.ExtractUint64LE (u, error) &&
+                (u == 0x55EFCDAB89674523ULL);
+
+    return b_Success && !iter_Offset.ExtractUint64BE (u, error);
+}
+
+bool TestExtractFloat ()
+{
+    String str;
+
+    str.AppendUint32 (0x40490FDB);    // 3.14159274f
+    str.AppendUint32 (0x400921FB);    // 3.141592653589793
+    str.AppendUint32 (0x54442D18);
+
+    StringIter iter (str);
+
+    float      f = 0;
+    double     d = 0;
+    ParseError error;
+
+    bool b_Success = iter.ExtractFloat (f, error) && (f == 3.14159274f) &&
+                     iter.ExtractDouble (d, error) &&
+                     (d == 3.141592653589793) &&
+                     !iter.ExtractFloat (f, error);
+
+    String str_LE;
+
+    str_LE.AppendUint32 (0xDB0F4940);
+    str_LE.AppendUint32 (0x182D4454);
+    str_LE.AppendUint32 (0xFB210940);
+
+    iter = str_LE;
+
+    iter.SetLittleEndian();
+
+    return b_Success && iter.ExtractFloat (f, error) && (f == 3.14159274f) &&
+           iter.ExtractDouble (d, error) && (d == 3.141592653589793) &&
+           !iter.ExtractDouble (d, error);
+}
+
+//+---------------------------------------------------------------------------
+//  Synopsis:   Extracts arrays of every width in both byte orders, at odd
+//              offsets and lengths, and compares them with values
+//              assembled a byte at a time
+//----------------------------------------------------------------------------
+
+bool TestExtractArrays (ByteSearchEngine engine)
+{
+    bool b_Same = true;
+
+    uint16 au16 [400];
+    uint32 au32 [100];
+    uint64 au64 [100];
+
+    ByteSearch::SetEngine (engine);
+
+    for (uintsys u_Round=0; u_Round<2000; ++u_Round)
+    {
+        uintsys u_Width  = 2 << Random (3);
+        uintsys u_Count  = Random (100);
+        uintsys u_Offset = Random (8);
+        bool    b_Little = (Random (2) == 1);
+
+        String str (RandomBytes (u_Offset + u_Count * u_Width));
+
+        StringIter iter (str);
+        ParseError error;
+
+        iter += u_Offset;
+
+        if (b_Little)
+        {
+            iter.SetLittleEndian();
+        }
+
+        bool b_OK = false;
+
+        switch (u_Width)
+        {
+            case 2:
+                b_OK = iter.ExtractUint16Array (au16, u_Count, error);
+                break;
+
+            case 4:
+                b_OK = iter.ExtractUint32Array (au32, u_Count, error);
+                break;
+
+            default:
+                b_OK = iter.ExtractUint64Array (au64, u_Count, error);
+                break;
+        }
+
+        b_Same = b_Same && b_OK && !iter;
+
+        const uchar* p = str.PointerToFirstByte() + u_Offset;
+
+        for (uintsys u=0; u<u_Count; ++u)
+        {
+            uint64 u_Actual = 0;
+
+            switch (u_Width)
+            {
+                case 2:  u_Actual = au16[u]; break;
+                case 4:  u_Actual = au32[u]; break;
+                default: u_Actual = au64[u]; break;
+            }
+
+            b_Same = b_Same && (u_Actual == Assemble (p + u * u_Width,
+                                                      u_Width, b_Little));
+        }
+
+        // one value too many extracts nothing
+
+        iter = str;
+
+        iter += u_Offset;
+
+        uintsys u_TooMany = u_Count * u_Width / 2 + 1;
+
+        b_Same = b_Same && !iter.ExtractUint16Array (au16, u_TooMany, error);
+        b_Same = b_Same && (!iter || (iter.Offset() == u_Offset));
+    }
+
+    String str;
+
+    str.AppendUint32 (0x40490FDB);
+    str.AppendUint32 (0x400921FB);
+    str.AppendUint32 (0x54442D18);
+
+    float      af [1];
+    double     ad [1];
+    StringIter iter (str);
+    ParseError error;
+
+    return b_Same && iter.ExtractFloatArray (af, 1, error) &&
+           (af[0] == 3.14159274f) && iter.ExtractDoubleArray (ad, 1, error) &&
+           (ad[0] == 3.141592653589793) && !iter;
+}
+
+//+---------------------------------------------------------------------------
+//  Synopsis:   Extracts runs of random widths, switching byte order now and
+//              then, and compares them with bits read one at a time
+//----------------------------------------------------------------------------
+
+static uint64 ReferenceBits (const String& str, uintsys u_Position,
+                             uintsys u_NumBits, bool b_LittleEndian)
+{
+    const uchar* p = str.PointerToFirstByte();
+
+    uint64 u = 0;
+
+    for (uintsys u_Bit=0; u_Bit<u_NumBits; ++u_Bit)
+    {
+        uintsys u_Index = u_Position + u_Bit;
+        uint64  u_Value = 0;
+
+        if (b_LittleEndian)
+        {
+            u_Value = (p[u_Index / 8] >> (u_Index % 8)) & 1;
+
+            u |= u_Value << u_Bit;
+        }
+        else
+        {
+            u_Value = (p[u_Index / 8] >> (7 - (u_Index % 8))) & 1;
+
+            u = (u << 1) | u_Value;
+        }
+    }
+
+    return u;
+}
+
+bool TestExtractBits ()
+{
+    bool b_Same = true;
+
+    uintsys u_MaxBits = Minimum<uintsys> (StringBitIter::MAX_EXTRACT_BITS,
+                                          NumberOfBits<uintsys>());
+
+    for (uintsys u_Round=0; u_Round<2000; ++u_Round)
+    {
+        String str (RandomBytes (Random (40)));
+
+        StringBitIter iter (str);
+        ParseError    error;
+
+        uintsys u_Position = 0;
+        uintsys u_Total    = str.Length() * 8;
+        bool    b_Little   = false;
+
+        while (u_Position < u_Total)
+        {
+            if (Random (8) == 0)
+            {
+                b_Little = !b_Little;
+
+                if (b_Little)
+                {
+                    iter.SetLittleEndian();
+                }
+                else
+                {
+                    iter.SetBigEndian();
+                }
+            }
+
+            uintsys u_NumBits = Random (u_MaxBits + 1);
+            uintsys u         = 0;
+
+            bool b_OK = iter.ExtractBits (u_NumBits, u, error);
+
+            if (u_Position + u_NumBits > u_Total)
+            {
+                b_Same = b_Same && !b_OK && iter;
+
+                continue;
+            }
+
+            b_Same = b_Same && b_OK &&
+                     (u == ReferenceBits (str, u_Position, u_NumBits,
+                                          b_Little));
+
+            u_Position += u_NumBits;
+        }
+
+        b_Same = b_Same && !iter;
+    }
+
+    StringBitIter iter ("abcdefghijkl");
+    ParseError    error;
+    uintsys       u = 0;
+
+    return b_Same && !iter.ExtractBits (u_MaxBits + 1, u, error) &&
+           iter.ExtractBits (8, u, error) && (u == 'a');
+}
@@ -0,0 +1,299 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+//+---------------------------------------------------------------------------
+//  File:       StringSplitIterTest.cpp
+//
+//  Synopsis:   Test program for StringSplitIter, StringLineIter and
+//              ShellParseIter
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Test.h"
+
+using namespace mikestoolbox;
+
+static uint32 gu_Seed = 12345;
+
+static uintsys Random (uintsys u_Limit)
+{
+    gu_Seed = gu_Seed * 1103515245 + 12345;
+
+    return (gu_Seed >> 8) % u_Limit;
+}
+
+static String RandomText (const char* pz_Chars, uintsys u_Length)
+{
+    uintsys u_NumChars = std::strlen (pz_Chars);
+
+    String str;
+
+    for (uintsys u = 0; u < u_Length; ++u)
+    {
+        str.Append (pz_Chars[Random (u_NumChars)]);
+    }
+
+    return str;
+}
+
+//  Joins the pieces with '|' so a whole split can be checked at once
+
+static String Pieces (StringSplitIter iter)
+{
+    String str;
+
+    for (; iter; ++iter)
+    {
+        str.Append (*iter);
+        str.Append ('|');
+    }
+
+    return str;
+}
+
+static String Pieces (StringList strl)
+{
+    String str;
+
+    while (!strl.IsEmpty())
+    {
+        str.Append (strl.Shift());
+        str.Append ('|');
+    }
+
+    return str;
+}
+
+//  The character-at-a-time ShellParse that ShellParseIter replaced
+
+static StringList SimpleShellParse (const String& str, bool& b_Error)
+{
+    StringList strl;
+    String     str_Element;
+
+    bool b_Escaped = false;
+    bool b_InQuote = false;
+    char c_Quote   = '"';
+
+    for (uintsys u = 0; u < str.Length(); ++u)
+    {
+        char c = str[u];
+
+        if (b_Escaped)
+        {
+            b_Escaped = false;
+
+            str_Element += c;
+        }
+        else if (c == '\\')
+        {
+            b_Escaped = true;
+        }
+        else if (b_InQuote)
+        {
+            if (c == c_Quote)
+            {
+                b_InQuote = false;
+            }
+            else
+            {
+                str_Element += c;
+            }
+        }
+        else if (std::isspace ((uchar) c))
+        {
+            strl.AppendNonEmpty (str_Element);
+
+            str_Element.Clear();
+        }
+        else if ((c == '\'') || (c == '"'))
+        {
+            b_InQuote = true;
+            c_Quote   = c;
+        }
+        else
+        {
+            str_Element += c;
+        }
+    }
+
+    strl.AppendNonEmpty (str_Element);
+
+    b_Error = b_InQuote || b_Escaped;
+
+    return strl;
+}
+
+int main (int, char** argv)
+{
+    Tester check (argv[0]);
+
+    {
+        String str ("alpha,beta,,gamma,");
+
+        check (Pieces (StringSplitIter (str, ',')) == "alpha|beta||gamma||");
+        check (Pieces (StringSplitIter (str, ',', 2)) ==
+               "alpha|beta,,gamma,|");
+        check (Pieces (StringSplitIter (str, ",,")) == "alpha,beta|gamma,|");
+        check (Pieces (StringSplitIter (str, "A", 0, false)) ==
+               "|lph|,bet|,,g|mm|,|");
+        check (Pieces (StringSplitIter (str, "")) ==
+               "a|l|p|h|a|,|b|e|t|a|,|,|g|a|m|m|a|,|");
+        check (Pieces (StringSplitIter ("", ',')).IsEmpty());
+        check (Pieces (StringSplitIter ("x", ',')) == "x|");
+
+        StringSplitIter iter (str, ',');
+
+        check (iter && (*iter == "alpha") && (iter.Offset() == 0));
+        check ((++iter)->Length() == 4 && (iter.Offset() == 6));
+        check ((++iter)->IsEmpty() && (iter.Offset() == 11));
+        check (*++iter == "gamma");
+        check ((++iter)->IsEmpty() && (iter.Offset() == str.Length()));
+        check (!++iter && !iter.IsValid());
+    }
+
+    {
+        PerlRegex rex_Digits ("\\d+");
+        PerlRegex rex_Commas (",*");
+        PerlRegex rex_Behind ("(?<=b)");
+
+        check (Pieces (StringSplitIter ("a1b22c333", rex_Digits)) ==
+               "a|b|c||");
+        check (Pieces (StringSplitIter ("1a", rex_Digits)) == "|a|");
+        check (Pieces (StringSplitIter ("a1b22c", rex_Digits, 2)) ==
+               "a|b22c|");
+        check (Pieces (StringSplitIter ("a,,b", rex_Commas)) == "a|b|");
+        check (Pieces (StringSplitIter ("ab", rex_Commas)) == "a|b|");
+        check (Pieces (StringSplitIter ("abcabc", rex_Behind)) ==
+               "ab|cab|c|");
+        check (Pieces (StringSplitIter ("", rex_Digits)).IsEmpty());
+
+        // lookbehind sees the text before the piece
+
+        PerlRegex rex_Repeat ("(?<=,),");
+
+        check (Pieces (StringSplitIter ("x,,,y", rex_Repeat)) == "x,||y|");
+    }
+
+    {
+        bool b_Same = true;
+
+        for (uintsys u = 0; u < 5000; ++u)
+        {
+            String  str     (RandomText ("abAB,,,", Random (30)));
+            String  str_Sep (RandomText ("aB,", Random (3)));
+            char    c_Sep   = ",a"[Random (2)];
+            uintsys u_Max   = Random (5);
+            bool    b_Case  = (Random (2) == 0);
+
+            b_Same = b_Same &&
+                (Pieces (StringSplitIter (str, str_Sep, u_Max, b_Case)) ==
+                 Pieces (str.Split (str_Sep, u_Max, b_Case))) &&
+                (Pieces (StringSplitIter (str, c_Sep, u_Max, b_Case)) ==
+                 Pieces (str.Split (c_Sep, u_Max, b_Case)));
+        }
+
+        check (b_Same);
+    }
+
+    {
+        String str ("one\ntwo\n\nthree");
+
+        StringLineIter iter (str);
+
+        check (iter && (*iter == "one\n"));
+        check (*++iter == "two\n");
+        check (*++iter == "\n");
+        check (*++iter == "three");
+        check (!++iter);
+
+        check (!StringLineIter (""));
+        check (!++StringLineIter ("one\n"));
+
+        StringList strl (String ("a\nb\n").LineBreak());
+
+        check (strl.NumItems() == 2);
+        check (strl.Shift() == "a\n" && strl.Shift() == "b\n");
+    }
+
+    {
+        String         str_Word;
+        ParseError     error;
+        ShellParseIter iter ("  cp -r 'My Files' \"a \\\"b\\\"\" c\\ d ''  ");
+
+        check (iter.Next (str_Word, error) && (str_Word == "cp"));
+        check (iter.Next (str_Word, error) && (str_Word == "-r"));
+        check (iter.Next (str_Word, error) && (str_Word == "My Files"));
+        check (iter.Next (str_Word, error) && (str_Word == "a \"b\""));
+        check (iter.Next (str_Word, error) && (str_Word == "c d"));
+        check (!iter.Next (str_Word, error) && error.IsOK());
+
+        ShellParseIter iter_Quote ("echo 'oops");
+
+        check (iter_Quote.Next (str_Word, error) && (str_Word == "echo"));
+        check (!iter_Quote.Next (str_Word, error) && !error.IsOK());
+
+        error.Clear();
+
+        check (String ("a b\\").ShellParse (error).IsEmpty() && !error);
+    }
+
+    {
+        bool b_Same = true;
+
+        for (uintsys u = 0; u < 20000; ++u)
+        {
+            String str (RandomText ("ab  \t'\"\\", Random (20)));
+
+            bool       b_Error = false;
+            ParseError error;
+            StringList strl_Simple (SimpleShellParse (str, b_Error));
+            StringList strl        (str.ShellParse (error));
+
+            b_Same = b_Same && (error.IsOK() != b_Error) &&
+                     (b_Error ? strl.IsEmpty() : (strl == strl_Simple));
+        }
+
+        check (b_Same);
+    }
+
+    check.Done();
+
+    return 0;
+}
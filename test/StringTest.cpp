@@ -49,6 +49,18 @@ bool UTF8Test  ();
 bool UTF16Test ();
 bool UTF32Test ();
 
+#if defined(PLATFORM_UNIX) && !defined(SINGLE_THREADED)
+static void* FillCache (void*)
+{
+    for (uintsys u = 0; u < 100; ++u)
+    {
+        String str_Block ('x', Repeat(100));
+    }
+
+    return 0;
+}
+#endif
+
 int main (int, char** argv)
 {
     Tester check (argv[0]);
@@ -463,6 +475,214 @@ int main (int, char** argv)
         check (UTF8Test());
         check (UTF16Test());
         check (UTF32Test());
+
+        // HeapMemory block cache
+
+        {
+            MemoryCache::Trim();
+
+            MemoryCacheStats before (MemoryCache::ThreadStats());
+
+            for (uintsys u = 0; u < 100; ++u)
+            {
+                String str_Block ('x', Repeat(100));
+            }
+
+            MemoryCacheStats after (MemoryCache::ThreadStats());
+
+            check (after.Hits() - before.Hits() >= 99);
+            check (after.Recycled() - before.Recycled() >= 100);
+            check (after.BytesCached() > 0);
+            check (MemoryCache::Stats().Hits() >= after.Hits());
+
+            String str_Reused ('y', Repeat(100));
+
+            check (str_Reused == String ('y', Repeat(100)));
+
+            MemoryCache::Trim();
+
+            check (MemoryCache::ThreadStats().BytesCached() == 0);
+
+            uintsys u_Limit = MemoryCache::Limit();
+
+            MemoryCache::SetLimit (0);
+
+            before = MemoryCache::ThreadStats();
+
+            {
+                String str_Uncached ('z', Repeat(100));
+            }
+
+            after = MemoryCache::ThreadStats();
+
+            check (after.Recycled() == before.Recycled());
+            check (after.Hits() == before.Hits());
+
+            MemoryCache::SetLimit (u_Limit);
+
+#if defined(PLATFORM_UNIX) && !defined(SINGLE_THREADED)
+            // a thread not started through Thread still frees its cache
+
+            pthread_t h_Thread;
+
+            check (pthread_create (&h_Thread, 0, FillCache, 0) == 0);
+            check (pthread_join (h_Thread, 0) == 0);
+
+            check (MemoryCache::Stats().BytesCached() ==
+                   MemoryCache::ThreadStats().BytesCached());
+#endif
+        }
+
+        // secure strings
+
+        {
+            String str_Plain ("plain");
+            String str_Secret ("secret");
+
+            check (!str_Plain.IsSecure());
+
+            str_Secret.SetSecure();
+
+            check (str_Secret.IsSecure());
+
+            String str_Copy (str_Secret);
+
+            check (str_Copy.IsSecure());
+
+            str_Copy += " and more";
+
+            check (str_Copy.IsSecure());
+            check (str_Copy == "secret and more");
+            check (str_Secret == "secret");
+
+            str_Copy.Clear();
+
+            check (str_Copy.IsEmpty());
+
+            str_Secret.Append ('x', Repeat(1000));
+
+            check (str_Secret.IsSecure());
+            check (str_Secret.Length() == 1006);
+
+            str_Secret.Destroy();
+
+            check (str_Secret.IsEmpty());
+
+            // a secure string stays secure when assigned to or cleared,
+            // and the source is left as it was
+
+            String str_Key ("key");
+
+            str_Key.SetSecure();
+
+            str_Key = str_Plain;
+
+            check (str_Key.IsSecure());
+            check (str_Key == "plain");
+            check (!str_Plain.IsSecure());
+
+            String str_Shared (str_Key);
+
+            str_Key.Clear();
+
+            check (str_Key.IsSecure());
+            check (str_Key.IsEmpty());
+            check (str_Shared == "plain");
+
+            str_Key = "literal";
+
+            check (str_Key.IsSecure());
+
+            str_Key = String ("temporary");
+
+            check (str_Key.IsSecure());
+            check (str_Key == "temporary");
+
+            HeapMemory::SetDefaultSecure (true);
+
+            String str_Default ("default");
+
+            check (String (str_Default).IsSecure());
+
+            HeapMemory::SetDefaultSecure (false);
+        }
+
+        // growth of large strings
+
+        {
+            String str_Chunk ('a', Repeat(100000));
+            String str_Large;
+
+            for (uintsys u = 0; u < 30; ++u)
+            {
+                str_Large.Append (str_Chunk);
+            }
+
+            check (str_Large.Length() == 3000000);
+            check (str_Large.Count ('a') == 3000000);
+
+            str_Large.EraseFront (1000);
+            str_Large.Append ('b', Repeat(5000000));
+
+            check (str_Large.Length() == 7999000);
+            check (str_Large.Count ('b') == 5000000);
+            check (str_Large[0] == 'a');
+            check (str_Large[-1] == 'b');
+
+            String str_Shared (str_Large);
+
+            str_Large.Prepend (str_Chunk);
+
+            check (str_Large.Length() == 8099000);
+            check (str_Shared.Length() == 7999000);
+
+            bool b_Threw = false;
+
+            try
+            {
+                HeapMemory::SetGrowthFactor (0.5);
+            }
+            catch (Exception&)
+            {
+                b_Threw = true;
+            }
+
+            check (b_Threw);
+        }
+
+#ifdef HAVE_MOVE_SEMANTICS
+        {
+            String str_From ("moved along");
+            String str_To   (std::move (str_From));
+
+            check (str_To == "moved along");
+            check (str_From.IsEmpty());
+
+            str_From = "reused";
+            str_To   = std::move (str_From);
+
+            check (str_To == "reused");
+            check (str_From.IsEmpty());
+
+            StringList strl;
+
+            strl.Append (String ("temporary"));
+            strl.Append (std::move (str_To));
+
+            check (strl.NumItems() == 2);
+            check (strl.Join (",") == "temporary,reused");
+            check (str_To.IsEmpty());
+
+            StringList strl_Moved (std::move (strl));
+
+            check (strl_Moved.NumItems() == 2);
+            check (strl.IsEmpty());
+
+            strl.Append ("still usable");
+
+            check (strl.NumItems() == 1);
+        }
+#endif
     }
     catch (Exception& e)
     {
@@ -0,0 +1,282 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+//+---------------------------------------------------------------------------
+//  File:       StringViewTest.cpp
+//
+//  Synopsis:   Test program for StringView
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Test.h"
+
+using namespace mikestoolbox;
+
+static uint32 gu_Seed = 12345;
+
+static uintsys Random (uintsys u_Limit)
+{
+    gu_Seed = gu_Seed * 1103515245 + 12345;
+
+    return (gu_Seed >> 8) % u_Limit;
+}
+
+//  Short runs of a few letters and commas, so patterns turn up often
+
+static String RandomText (uintsys u_Length)
+{
+    static const char ac_Chars[] = "abAB,,;";
+
+    String str;
+
+    for (uintsys u = 0; u < u_Length; ++u)
+    {
+        str.Append (ac_Chars[Random (sizeof(ac_Chars) - 1)]);
+    }
+
+    return str;
+}
+
+static bool SameList (StringList strl, StringViewList list)
+{
+    if (strl.NumItems() != list.NumItems())
+    {
+        return false;
+    }
+
+    while (!strl.IsEmpty())
+    {
+        if (String (list.Shift()) != strl.Shift())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static intsys Offset (const StringIter& iter)
+{
+    return iter ? (intsys) iter.Offset() : -1;
+}
+
+int main (int, char** argv)
+{
+    Tester check (argv[0]);
+
+    {
+        StringView view;
+
+        check (view.IsEmpty() && (view.Length() == 0));
+        check (view == "");
+        check (view.Split (',').IsEmpty());
+        check (view.FindFirst ('a') == -1);
+        check (String (view).IsEmpty());
+    }
+
+    {
+        String     str  ("GET /index.html HTTP/1.1");
+        StringView view (str);
+
+        check (view.Length() == str.Length());
+        check (view.PointerToFirstChar() == str.PointerToFirstChar());
+        check (view == "GET /index.html HTTP/1.1");
+        check (view.FirstChar() == 'G' && view.LastChar() == '1');
+        check (view[4] == '/');
+
+        check (view.Head (3) == "GET");
+        check (view.Tail (8) == "HTTP/1.1");
+        check (view.Tail (100) == view);
+        check (view.Segment (4, 11) == "/index.html");
+        check (view.Segment (-3, 100) == "1.1");
+        check (view.Segment (100, 1).IsEmpty());
+        check (str.SegmentView (4, 11) == String (str.Segment (4, 11)));
+
+        check (view.FindFirst (' ') == 3);
+        check (view.FindLast (' ') == 15);
+        check (view.FindFirst ("HTTP") == 16);
+        check (view.FindFirst ("http") == -1);
+        check (view.FindFirst ("http", 0, false) == 16);
+        check (view.FindFirst (' ', 4) == 15);
+        check (view.FindLast ('/', 10) == 4);
+        check (view.Contains (String ("index")) && !view.Contains ('#'));
+
+        check (view.StartsWith ("GET ") && !view.StartsWith ("get "));
+        check (view.StartsWith ("get ", false));
+        check (view.EndsWith ("1.1") && !view.EndsWith ("x1.1"));
+
+        StringView view_Path (view);
+
+        view_Path.EraseFront (4);
+        view_Path.EraseEnd (9);
+
+        check (view_Path == "/index.html");
+
+        view_Path.EraseFront (100);
+
+        check (view_Path.IsEmpty());
+
+        check (view.Compare ("GET") > 0);
+        check (view.Compare ("get /INDEX.HTML http/1.1", false) == 0);
+        check (StringView ("abc") < StringView ("abd"));
+        check (StringView ("ab")  < StringView ("abc"));
+        check (StringView ("\xFF") > StringView ("a"));
+
+        String str_Copy;
+
+        str_Copy.Append (view.Segment (4, 6));
+        str_Copy.Append (str_Copy.SegmentView (1, 5));
+
+        check (str_Copy == "/indexindex");
+    }
+
+    {
+        String     str ("-42,18446744073709551615,2.5e-3,  7x,");
+        StringList strl (str.Split (','));
+
+        StringViewList list (str.SplitView (','));
+
+        check (SameList (strl, list));
+        check (list[0].AsInt() == -42);
+        check (list[1].AsUint() == MAX_UINTSYS);
+        check (list[2].AsDouble() == 0.0025);
+        check (list[3].AsInt() == 7);
+        check (list[4].AsInt() == 0);
+
+        // the bytes that follow a view must not be parsed with it
+
+        check (StringView ("123456", 3).AsInt() == 123);
+        check (StringView ("1.5e10", 3).AsDouble() == 1.5);
+    }
+
+    {
+        String str (RandomText (2000));
+
+        bool b_Same = true;
+
+        for (uintsys u = 0; u < 3000; ++u)
+        {
+            String str_Text (str.Segment (Random (2000), Random (40)));
+            String str_Pattern (RandomText (Random (3)));
+
+            uintsys u_Max  = Random (4);
+            bool    b_Case = (Random (2) == 0);
+
+            StringView view (str_Text);
+
+            b_Same = b_Same &&
+                SameList (str_Text.Split (str_Pattern, u_Max, b_Case),
+                          view.Split (str_Pattern, u_Max, b_Case)) &&
+                SameList (str_Text.Split (u_Max),
+                          str_Text.SplitView ("", u_Max));
+
+            intsys n_Offset = (intsys) Random (45) - 5;
+
+            StringIter iter_First (str_Text.FindFirst (str_Pattern, n_Offset,
+                                                       b_Case));
+            StringIter iter_Last  (str_Text.FindLast  (str_Pattern, n_Offset,
+                                                       b_Case));
+
+            b_Same = b_Same &&
+                (view.FindFirst (str_Pattern, n_Offset, b_Case) ==
+                 Offset (iter_First)) &&
+                (view.FindLast (str_Pattern, n_Offset, b_Case) ==
+                 Offset (iter_Last)) &&
+                (view.Compare (str_Pattern, b_Case) ==
+                 str_Text.Compare (str_Pattern, b_Case)) &&
+                (view.StartsWith (str_Pattern, b_Case) ==
+                 str_Text.StartsWith (str_Pattern, b_Case)) &&
+                (view.EndsWith (str_Pattern, b_Case) ==
+                 str_Text.EndsWith (str_Pattern, b_Case));
+        }
+
+        check (b_Same);
+    }
+
+    {
+        String str ("Content-Type");
+
+        StringView view (str);
+
+        check (FowlerNollVoHash32::ComputeHash (view) ==
+               FowlerNollVoHash32::ComputeHash (str));
+        check (NoCaseHash::ComputeHash (StringView ("CONTENT-type")) ==
+               NoCaseHash::ComputeHash (str));
+        check (NoCaseHash::Equal (view, StringView ("content-TYPE")));
+
+        Hash<StringView,int> hash;
+
+        hash["Host"] = 1;
+        hash[view]   = 2;
+
+        check (hash.NumItems() == 2);
+        check (hash[StringView ("Host")] == 1);
+        check (hash[str.SegmentView (0, 12)] == 2);
+        check (!hash.Exists (str.SegmentView (0, 7)));
+    }
+
+    {
+        // a shared view keeps the String's bytes alive and unchanged
+
+        StringView     view;
+        StringViewList list;
+
+        {
+            String str ("alpha,beta,gamma");
+
+            view = StringView (str, true);
+            list = view.Split (',');
+
+            str.ToUpperCase();
+            str.Append (",delta");
+
+            check (str == "ALPHA,BETA,GAMMA,delta");
+        }
+
+        check (view == "alpha,beta,gamma");
+        check (list.NumItems() == 3);
+        check (list.Shift() == "alpha");
+        check (list.Pop() == "gamma");
+        check (String (view.Tail (5)) == "gamma");
+    }
+
+    check.Done();
+
+    return 0;
+}
@@ -0,0 +1,231 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       ThreadAffinityTest.cpp
+//
+//  Synopsis:   Test program for Thread placement, priority and naming
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Test.h"
+
+using namespace mikestoolbox;
+
+//+---------------------------------------------------------------------------
+//  Class:      ProbeThread
+//
+//  Synopsis:   Records what the system reports about the thread from inside
+//              it, so the checks do not rely on Thread reading its own
+//              settings back
+//----------------------------------------------------------------------------
+
+class ProbeThread : public Thread
+{
+public:
+
+    explicit ProbeThread (uintsys u_StackSize=0)
+        : Thread (u_StackSize)
+        , list_Processors_ ()
+        , str_Name_        ()
+        , u_StackSize_     (0)
+        , n_Nice_          (0)
+        , n_Policy_        (-1)
+        , n_MemoryPolicy_  (-1)
+        , u_Done_          (0)
+    {
+        // nothing
+    }
+
+    void WaitUntilDone ()
+    {
+        while (u_Done_.Load() == 0)
+        {
+            millisleep (1);
+        }
+    }
+
+    List<uintsys> list_Processors_;
+    String        str_Name_;
+    uintsys       u_StackSize_;
+    intsys        n_Nice_;
+    intsys        n_Policy_;
+    intsys        n_MemoryPolicy_;
+
+private:
+
+    Atomic<uintsys> u_Done_;
+
+    intsys Main_ ();
+};
+
+intsys ProbeThread::Main_ ()
+{
+#ifdef HAVE_THREAD_AFFINITY
+    cpu_set_t set;
+
+    CPU_ZERO (&set);
+
+    if (sched_getaffinity (0, sizeof(set), &set) == 0)
+    {
+        for (uintsys u = 0; u < CPU_SETSIZE; ++u)
+        {
+            if (CPU_ISSET (u, &set))
+            {
+                list_Processors_.Append (u);
+            }
+        }
+    }
+
+    char sz_Name[32] = "";
+
+    pthread_getname_np (pthread_self(), sz_Name, sizeof(sz_Name));
+
+    str_Name_ = sz_Name;
+
+    pthread_attr_t attrs;
+
+    if (pthread_getattr_np (pthread_self(), &attrs) == 0)
+    {
+        size_t u_Size = 0;
+
+        pthread_attr_getstacksize (&attrs, &u_Size);
+        pthread_attr_destroy (&attrs);
+
+        u_StackSize_ = u_Size;
+    }
+
+    n_Nice_   = getpriority (PRIO_PROCESS, (id_t) syscall (SYS_gettid));
+    n_Policy_ = sched_getscheduler (0);
+
+    int n_Mode = -1;
+
+    if (syscall (SYS_get_mempolicy, &n_Mode, 0, 0, 0, 0) == 0)
+    {
+        n_MemoryPolicy_ = n_Mode;
+    }
+#endif
+
+    u_Done_.Store (1);
+
+    return 0;
+}
+
+int main (int, char** argv)
+{
+    Tester check (argv[0]);
+
+    check (NumNumaNodes() >= 1);
+    check (!NumaNodeProcessors (0).IsEmpty());
+
+#ifdef HAVE_THREAD_AFFINITY
+    {
+        uintsys      u_Last   = NumProcessors() - 1;
+        ProbeThread* p_Thread = new ProbeThread;
+
+        check (p_Thread->SetAffinity (u_Last));
+        check (p_Thread->Affinity() == List<uintsys> (u_Last));
+        check (!p_Thread->SetAffinity (List<uintsys>()));
+
+        p_Thread->SetName ("probe-with-a-long-name");
+        p_Thread->SetPriority (THREAD_PRIORITY_LOWEST);
+
+        check (p_Thread->Name() == "probe-with-a-long-name");
+
+        p_Thread->Run();
+        p_Thread->WaitUntilDone();
+
+        check (p_Thread->list_Processors_ == List<uintsys> (u_Last));
+        check (p_Thread->str_Name_ == "probe-with-a-lo");
+        check (p_Thread->n_Nice_ == 10);
+
+        while (!p_Thread->HasExited())
+        {
+            millisleep (1);
+        }
+
+        check (!p_Thread->SetAffinity (u_Last));
+        check (p_Thread->Affinity().IsEmpty());
+        check (!p_Thread->SetPolicy (THREAD_POLICY_BATCH));
+
+        p_Thread->SetName ("finished");
+        p_Thread->SetPriority (THREAD_PRIORITY_HIGHEST);
+
+        check (p_Thread->Name() == "finished");
+    }
+
+    {
+        ProbeThread* p_Thread = new ProbeThread (16 * 1024 * 1024);
+
+        check (p_Thread->SetPolicy (THREAD_POLICY_BATCH));
+        check (p_Thread->SetNumaNode (0));
+
+        p_Thread->Run();
+        p_Thread->WaitUntilDone();
+
+        check (p_Thread->list_Processors_ == NumaNodeProcessors (0));
+        check (p_Thread->u_StackSize_ >= 16 * 1024 * 1024);
+        check (p_Thread->n_Policy_ == SCHED_BATCH);
+        check (p_Thread->n_MemoryPolicy_ == MPOL_PREFERRED);
+    }
+#endif
+
+    {
+        Thread::SetDefaultStackSize (12 * 1024 * 1024);
+
+        ProbeThread* p_Thread = new ProbeThread;
+
+        Thread::SetDefaultStackSize (0);
+
+        check (p_Thread->SetPolicy (THREAD_POLICY_NORMAL));
+
+        p_Thread->Run();
+        p_Thread->WaitUntilDone();
+
+#ifdef HAVE_THREAD_AFFINITY
+        check (p_Thread->u_StackSize_ >= 12 * 1024 * 1024);
+        check (p_Thread->n_Policy_ == SCHED_OTHER);
+#endif
+    }
+
+    check.Done();
+
+    return 0;
+}
@@ -0,0 +1,220 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       ThreadPoolTest.cpp
+//
+//  Synopsis:   Test program for ThreadPool class
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Test.h"
+
+using namespace mikestoolbox;
+
+const uintsys NUM_TASKS = 10000;
+
+Atomic<uintsys> gu_Count (0);
+
+void Increment (void*)
+{
+    gu_Count.Increment();
+}
+
+void Throw (void*)
+{
+    throw Exception ("task failed");
+}
+
+void SumRange (uintsys u_Begin, uintsys u_End, void* p_Arg)
+{
+    Atomic<uintsys>* p_Sum = static_cast<Atomic<uintsys>*> (p_Arg);
+
+    uintsys u_Sum = 0;
+
+    for (uintsys u = u_Begin; u < u_End; ++u)
+    {
+        u_Sum += u;
+    }
+
+    p_Sum->FetchAdd (u_Sum);
+}
+
+//+---------------------------------------------------------------------------
+//  Class:      FanOutTask
+//
+//  Synopsis:   Submits child tasks from inside the pool and waits for them
+//----------------------------------------------------------------------------
+
+class FanOutTask : public Task
+{
+public:
+
+    FanOutTask (ThreadPool& pool, uintsys u_Depth)
+        : pool_ (pool), u_Depth_ (u_Depth) { }
+
+private:
+
+    ThreadPool& pool_;
+    uintsys     u_Depth_;
+
+    void Main_ ()
+    {
+        gu_Count.Increment();
+
+        if (u_Depth_ == 0)
+        {
+            return;
+        }
+
+        TaskHandle handle1 (pool_.Submit (new FanOutTask (pool_, u_Depth_-1)));
+        TaskHandle handle2 (pool_.Submit (new FanOutTask (pool_, u_Depth_-1)));
+
+        handle1.Wait();
+        handle2.Wait();
+    }
+};
+
+int main (int, char** argv)
+{
+    Tester check (argv[0]);
+
+    {
+        ThreadPool pool (4);
+
+        check (pool.NumThreads() == 4);
+        check (!pool.IsStopped());
+
+        List<TaskHandle> list_Handles;
+
+        for (uintsys u = 0; u < NUM_TASKS; ++u)
+        {
+            list_Handles.Append (pool.Submit (Increment, 0));
+        }
+
+        for (uintsys u = 0; u < NUM_TASKS; ++u)
+        {
+            list_Handles[u].Wait();
+        }
+
+        check (gu_Count.Load() == NUM_TASKS);
+        check (list_Handles[0].IsDone());
+        check (!list_Handles[0].ExceptionCaught());
+
+        TaskHandle handle (pool.Submit (Throw, 0));
+
+        check (handle.Wait (5000));
+        check (handle.ExceptionCaught());
+        check (handle.ExceptionMessage() == "task failed");
+
+        gu_Count.Store (0);
+
+        handle = pool.Submit (new FanOutTask (pool, 10));
+        handle.Wait();
+
+        check (gu_Count.Load() == 2047);
+
+        Atomic<uintsys> u_Sum (0);
+
+        pool.ParallelFor (0, 100000, SumRange, &u_Sum);
+
+        check (u_Sum.Load() == 4999950000ULL);
+
+        u_Sum.Store (0);
+
+        pool.ParallelFor (10, 11, SumRange, &u_Sum, 1000);
+
+        check (u_Sum.Load() == 10);
+
+        gu_Count.Store (0);
+
+        for (uintsys u = 0; u < NUM_TASKS; ++u)
+        {
+            pool.Submit (Increment, 0);
+        }
+
+        pool.Stop();
+
+        check (pool.IsStopped());
+
+        bool b_Thrown = false;
+
+        try
+        {
+            pool.Submit (Increment, 0);
+        }
+        catch (Exception&)
+        {
+            b_Thrown = true;
+        }
+
+        check (b_Thrown);
+    }
+
+    check (gu_Count.Load() == NUM_TASKS);
+
+    for (uintsys u = 0; u < 20; ++u)
+    {
+        ThreadPool pool (4);    // destroyed before the workers get going
+    }
+
+    check (true);
+
+    {
+        ThreadPool pool (4);
+
+        millisleep (50);        // let the workers go to sleep
+
+        check (!pool.IsStopped());
+    }
+
+    check (true);
+
+    {
+        TaskHandle handle;
+
+        check (!handle.IsValid());
+        check (handle.IsDone());
+    }
+
+    check.Done();
+
+    return 0;
+}
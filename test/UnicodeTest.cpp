@@ -0,0 +1,352 @@
+/*
+  Copyright (C) 2002-2024 Michael S. D'Errico.  All Rights Reserved.
+
+  This source code is the property of Michael S. D'Errico and is
+  protected under international copyright laws.
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of version 3 of the GNU General Public License as
+  published by the Free Software Foundation.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+  A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT
+  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+  Options for Contacting the Author:
+
+    email name:   mikestoolbox
+    email domain: pobox.com
+    X/Twitter:    @mikestoolbox
+    mail:         Michael D'Errico
+                  10161 Park Run Drive, Suite 150
+                  Las Vegas, NV 89145
+*/
+
+//+---------------------------------------------------------------------------
+//  File:       UnicodeTest.cpp
+//
+//  Synopsis:   Test program for the Unicode validator and transcoders
+//----------------------------------------------------------------------------
+
+#include "mikestoolbox-1.2.h"
+#include "Test.h"
+
+using namespace mikestoolbox;
+
+static uint32 gu_Seed = 12345;
+
+static uintsys Random (uintsys u_Limit)
+{
+    gu_Seed = gu_Seed * 1103515245 + 12345;
+
+    return (gu_Seed >> 8) % u_Limit;
+}
+
+//  The old character-at-a-time check, plus the surrogates that
+//  StringIter::ParseUTF8Char lets through
+
+static bool SimpleIsValid (const String& str)
+{
+    ParseError error;
+    uintsys    u = 0;
+
+    StringIter iter (str);
+
+    while (iter.ParseUTF8Char (u, error))
+    {
+        if ((u >= 0xD800) && (u <= 0xDFFF))
+        {
+            return false;
+        }
+    }
+
+    return !iter;
+}
+
+static bool IsValid (const String& str)
+{
+    return Unicode::IsValidUTF8 (str.PointerToFirstByte(), str.Length());
+}
+
+//  Builds text with the mix of one- to four-byte characters asked for
+
+static String RandomText (uintsys u_NumChars, uintsys u_Mix)
+{
+    String str;
+
+    for (uintsys u = 0; u < u_NumChars; ++u)
+    {
+        switch (Random (u_Mix))
+        {
+            case 0:  str.AppendUTF8 (0x10000 + Random (0x100000)); break;
+            case 1:  str.AppendUTF8 (0x4E00  + Random (0x5000));   break;
+            case 2:  str.AppendUTF8 (0x80    + Random (0x780));    break;
+            default: str.AppendUTF8 (0x20    + Random (0x5F));     break;
+        }
+    }
+
+    return str;
+}
+
+static bool TestEngine (ByteSearchEngine engine)
+{
+    ByteSearch::SetEngine (engine);
+
+    const char* pz_Engine = ByteSearch::EngineName (engine);
+
+    // every code point there is, in all three forms
+
+    String str_UTF8;
+    String str_UTF16;
+    String str_UTF32;
+
+    for (uintsys u = 0; u <= MAX_UNICODE_CODE_POINT; ++u)
+    {
+        if (u == 0xD800)
+        {
+            u = 0xE000;
+        }
+
+        str_UTF8.AppendUTF8   (u);
+        str_UTF16.AppendUTF16 (u);
+        str_UTF32.AppendUTF32 (u);
+    }
+
+    if (!str_UTF8.IsValidUTF8() ||
+        (UTF8ToUTF16 (str_UTF8)  != str_UTF16) ||
+        (UTF8ToUTF32 (str_UTF8)  != str_UTF32) ||
+        (UTF16ToUTF8 (str_UTF16) != str_UTF8)  ||
+        (UTF32ToUTF8 (str_UTF32) != str_UTF8))
+    {
+        std::cout << pz_Engine << ": all code points" << std::endl;
+
+        return false;
+    }
+
+    String str_Latin1;
+    String str_Latin1UTF8;
+
+    for (uintsys u = 0; u < 256; ++u)
+    {
+        str_Latin1.Append ((char) u);
+        str_Latin1UTF8.AppendUTF8 (u);
+    }
+
+    str_Latin1     += str_Latin1     + String ('a', Repeat(100));
+    str_Latin1UTF8 += str_Latin1UTF8 + String ('a', Repeat(100));
+
+    if (Latin1ToUTF8 (str_Latin1) != str_Latin1UTF8)
+    {
+        std::cout << pz_Engine << ": Latin-1" << std::endl;
+
+        return false;
+    }
+
+    // any two bytes followed by a few telling ones, straddling the end
+    // of a 16 and a 32 byte block, after some ASCII or a CJK character
+
+    static const uchar auc_Third[] = { 0x41, 0x80, 0x9F, 0xBF, 0xC3 };
+
+    String str_Prefix ('a', Repeat(29));
+
+    for (uintsys u_Prefix = 0; u_Prefix < 2; ++u_Prefix)
+    {
+        for (uintsys a = 0x80; a < 0x100; ++a)
+        {
+            for (uintsys b = 0; b < 0x100; ++b)
+            {
+                for (uintsys c = 0; c < sizeof(auc_Third); ++c)
+                {
+                    for (uintsys d = 0; d < 3; ++d)
+                    {
+                        String str (str_Prefix);
+
+                        str.Append ((char) a);
+                        str.Append ((char) b);
+                        str.Append ((char) auc_Third[c]);
+                        str.Append ((char) auc_Third[d]);
+
+                        if (IsValid (str) != SimpleIsValid (str))
+                        {
+                            std::cout << pz_Engine << ": " << a << " "
+                                      << b << " " << c << " " << d
+                                      << std::endl;
+
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+
+        str_Prefix = String ('a', Repeat(27));
+        str_Prefix.AppendUTF8 (0x6587);
+    }
+
+    // valid text with a few bytes changed, of every length up to some
+    // blocks, checked and converted
+
+    for (uintsys u_Try = 0; u_Try < 20000; ++u_Try)
+    {
+        String str (RandomText (Random (80), 2 + u_Try % 6));
+
+        for (uintsys u = Random (4); (u != 0) && !str.IsEmpty(); --u)
+        {
+            str[Random (str.Length())] = (char) Random (256);
+        }
+
+        if (Random (4) == 0)
+        {
+            str.Truncate (Random (str.Length() + 1));
+        }
+
+        bool b_Valid = SimpleIsValid (str);
+
+        ParseError error16;
+        ParseError error32;
+
+        uchar* p16 = new uchar[2*str.Length() + 1];
+        uchar* p32 = new uchar[4*str.Length() + 1];
+
+        uintsys n16 = Unicode::UTF8ToUTF16 (str.PointerToFirstByte(),
+                                            str.Length(), p16, error16);
+        uintsys n32 = Unicode::UTF8ToUTF32 (str.PointerToFirstByte(),
+                                            str.Length(), p32, error32);
+        bool b_Same = (IsValid (str) == b_Valid) &&
+                      (error16.IsOK() == b_Valid) &&
+                      (error32.IsOK() == b_Valid);
+
+        if (b_Same && b_Valid)
+        {
+            String str16 (p16, n16);
+            String str32 (p32, n32);
+
+            b_Same = (UTF16ToUTF8 (str16) == str) &&
+                     (UTF32ToUTF8 (str32) == str);
+        }
+
+        delete [] p16;
+        delete [] p32;
+
+        if (!b_Same)
+        {
+            std::cout << pz_Engine << ": \"" << str.Hex() << "\""
+                      << std::endl;
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static uintsys Errors16 (const String& str)
+{
+    ParseError error;
+
+    uchar auc[64];
+
+    Unicode::UTF16ToUTF8 (str.PointerToFirstByte(), str.Length(), auc,
+                          error);
+
+    return error.GetErrors();
+}
+
+static uintsys Errors32 (const String& str)
+{
+    ParseError error;
+
+    uchar auc[64];
+
+    Unicode::UTF32ToUTF8 (str.PointerToFirstByte(), str.Length(), auc,
+                          error);
+
+    return error.GetErrors();
+}
+
+static uintsys Errors8 (const String& str)
+{
+    ParseError error;
+
+    uchar auc[64];
+
+    Unicode::UTF8ToUTF16 (str.PointerToFirstByte(), str.Length(), auc,
+                          error);
+
+    return error.GetErrors();
+}
+
+int main (int, char** argv)
+{
+    Tester check (argv[0]);
+
+    check (String().IsValidUTF8());
+    check (String ("plain ASCII").IsValidUTF8());
+    check (String ("caf\xC3\xA9").IsValidUTF8());
+    check (!String ("caf\xE9").IsValidUTF8());
+    check (!String ("\xED\xA0\x80").IsValidUTF8());
+
+    check (Errors8 ("\xC0\x80")         == ParseErrorResultOutOfRange);
+    check (Errors8 ("\xF4\x90\x80\x80") == ParseErrorResultOutOfRange);
+    check (Errors8 ("\xED\xBF\xBF")     == ParseErrorUnicodeSurrogate);
+    check (Errors8 ("\xE2\x82")         == ParseErrorUnexpectedEndOfData);
+    check (Errors8 ("\xE2\x82\x41")     == ParseErrorIllegalByteSequence);
+    check (Errors8 ("\x80")             == ParseErrorIllegalByteSequence);
+
+    check (Errors16 (String ("\xDC\x00\x00\x41", 4)) ==
+           ParseErrorUnicodeSurrogate);
+    check (Errors16 (String ("\xD8\x00\x00\x41", 4)) ==
+           ParseErrorUnicodeSurrogate);
+    check (Errors16 (String ("\xD8\x00", 2)) == ParseErrorUnicodeSurrogate);
+    check (Errors16 (String ("\x00\x41\x00", 3)) ==
+           ParseErrorUnexpectedEndOfData);
+
+    check (Errors32 (String ("\x00\x11\x00\x00", 4)) ==
+           ParseErrorResultOutOfRange);
+    check (Errors32 (String ("\x00\x00\xD8\x00", 4)) ==
+           ParseErrorUnicodeSurrogate);
+    check (Errors32 (String ("\x00\x00\x00", 3)) ==
+           ParseErrorUnexpectedEndOfData);
+
+    check (Latin1ToUTF8 ("caf\xE9") == "caf\xC3\xA9");
+    check (UTF8ToUTF16 ("") == "");
+
+    bool b_Threw = false;
+
+    try
+    {
+        UTF8ToUTF32 ("caf\xE9");
+    }
+    catch (const Exception&)
+    {
+        b_Threw = true;
+    }
+
+    check (b_Threw);
+
+    check (TestEngine (BYTE_SEARCH_SCALAR));
+    check (TestEngine (BYTE_SEARCH_SSE2));
+    check (TestEngine (BYTE_SEARCH_AVX2));
+
+    ByteSearch::SetEngine (BYTE_SEARCH_UNKNOWN);
+
+    check.Done();
+
+    return 0;
+}